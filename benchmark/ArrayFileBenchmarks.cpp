@@ -0,0 +1,83 @@
+#include <benchmark/benchmark.h>
+
+#include <filesystem>
+#include <fstream>
+#include <span>
+#include <vector>
+
+#include <BenchmarkUtils.hpp>
+#include <LuminolMaths/ArrayFile.hpp>
+
+using namespace Luminol::Maths;
+using namespace Luminol::Benchmarks;
+
+namespace {
+
+[[nodiscard]] auto matrix_file_path() -> std::filesystem::path {
+    return std::filesystem::temp_directory_path() /
+           "LuminolMaths.ArrayFileBenchmarks.bin";
+}
+
+/// Writes `count` random matrices to the benchmark file.
+auto write_matrix_file(size_t count) -> void {
+    const auto matrices = random_matrices<float, 4, 4>(count);
+    write_array_file(matrix_file_path(), std::span<const Matrix4x4f>{matrices});
+}
+
+/// Loading by reading one matrix at a time, the baseline for mapping.
+auto stream_matrices(benchmark::State& state) -> void {
+    const auto count = static_cast<size_t>(state.range(0));
+    write_matrix_file(count);
+
+    for (auto _ : state) {
+        auto stream = std::ifstream{matrix_file_path(), std::ios::binary};
+        stream.seekg(sizeof(ArrayFileHeader));
+
+        auto matrices = std::vector<Matrix4x4f>{};
+        auto matrix = Matrix4x4f::zero();
+        for (size_t i = 0; i < count; ++i) {
+            stream.read(reinterpret_cast<char*>(&matrix), sizeof(matrix));
+            matrices.push_back(matrix);
+        }
+        benchmark::DoNotOptimize(matrices.data());
+    }
+
+    set_processed<Matrix4x4f>(state);
+    std::filesystem::remove(matrix_file_path());
+}
+
+/// Mapping the file and reading the last matrix, pages are read on demand.
+auto map_matrices(benchmark::State& state) -> void {
+    const auto count = static_cast<size_t>(state.range(0));
+    write_matrix_file(count);
+
+    for (auto _ : state) {
+        const auto file = MappedArrayFile<Matrix4x4f>{matrix_file_path()};
+        benchmark::DoNotOptimize(file.elements().back()[3][3]);
+    }
+
+    set_processed<Matrix4x4f>(state);
+    std::filesystem::remove(matrix_file_path());
+}
+
+auto write_matrices(benchmark::State& state) -> void {
+    const auto count = static_cast<size_t>(state.range(0));
+    const auto matrices = random_matrices<float, 4, 4>(count);
+
+    for (auto _ : state) {
+        write_array_file(
+            matrix_file_path(), std::span<const Matrix4x4f>{matrices}
+        );
+    }
+
+    set_processed<Matrix4x4f>(state);
+    std::filesystem::remove(matrix_file_path());
+}
+
+}  // namespace
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-non-const-global-variables)
+BENCHMARK(stream_matrices)->Apply(batch_sizes<max_matrix_batch_size>);
+BENCHMARK(map_matrices)->Apply(batch_sizes<max_matrix_batch_size>);
+BENCHMARK(write_matrices)->Apply(batch_sizes<max_matrix_batch_size>);
+// NOLINTEND(cppcoreguidelines-avoid-non-const-global-variables)
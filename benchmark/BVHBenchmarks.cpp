@@ -0,0 +1,190 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include <BenchmarkUtils.hpp>
+#include <LuminolMaths/BVH.hpp>
+
+using namespace Luminol::Maths;
+using namespace Luminol::Benchmarks;
+
+namespace {
+
+/// The number of queries run against the tree per iteration.
+constexpr auto query_count = size_t{1024};
+
+template <typename T>
+[[nodiscard]] auto random_points(size_t count, uint32_t seed = 1)
+    -> std::vector<Vector<T, 3>> {
+    auto points = random_vectors<T, 3>(count, seed);
+    for (auto& point : points) {
+        point *= T{100};
+    }
+    return points;
+}
+
+/// Arguments: the number of points and the number of threads, 0 for one per
+/// hardware thread.
+template <typename T>
+auto build_bvh(benchmark::State& state) -> void {
+    const auto count = static_cast<size_t>(state.range(0));
+    const auto options =
+        BVHOptions{.thread_count = static_cast<size_t>(state.range(1))};
+    const auto points = random_points<T>(count);
+
+    for (auto _ : state) {
+        auto bvh = BVH<T>::from_points(points, options);
+        benchmark::DoNotOptimize(bvh);
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <typename T>
+auto nearest_bvh(benchmark::State& state) -> void {
+    const auto count = static_cast<size_t>(state.range(0));
+    const auto points = random_points<T>(count);
+    const auto queries = random_points<T>(query_count, 2);
+    const auto bvh = BVH<T>::from_points(points);
+
+    for (auto _ : state) {
+        for (const auto& query : queries) {
+            auto nearest = bvh.nearest(query);
+            benchmark::DoNotOptimize(nearest);
+        }
+    }
+
+    state.SetItemsProcessed(
+        state.iterations() * static_cast<int64_t>(query_count)
+    );
+}
+
+/// Scans every point for each query, the baseline of `nearest_bvh`.
+template <typename T>
+auto nearest_linear(benchmark::State& state) -> void {
+    const auto count = static_cast<size_t>(state.range(0));
+    const auto points = random_points<T>(count);
+    const auto queries = random_points<T>(query_count, 2);
+
+    for (auto _ : state) {
+        for (const auto& query : queries) {
+            auto best = std::numeric_limits<T>::infinity();
+            auto best_index = size_t{0};
+            for (size_t i = 0; i < points.size(); ++i) {
+                const auto offset = points[i] - query;
+                const auto distance = offset.dot(offset);
+                if (distance < best) {
+                    best = distance;
+                    best_index = i;
+                }
+            }
+            benchmark::DoNotOptimize(best_index);
+        }
+    }
+
+    state.SetItemsProcessed(
+        state.iterations() * static_cast<int64_t>(query_count)
+    );
+}
+
+template <typename T>
+auto query_ray_bvh(benchmark::State& state) -> void {
+    const auto count = static_cast<size_t>(state.range(0));
+    const auto boxes = [&] {
+        auto result = std::vector<AABB<T>>{};
+        for (const auto& point : random_points<T>(count)) {
+            result.push_back(
+                AABB<T>::from_center_extent(point, {T{0.5}, T{0.5}, T{0.5}})
+            );
+        }
+        return result;
+    }();
+    const auto origins = random_points<T>(query_count, 2);
+    const auto directions = random_vectors<T, 3>(query_count, 3);
+    const auto bvh = BVH<T>{boxes};
+
+    auto hits = std::vector<uint32_t>{};
+    for (auto _ : state) {
+        for (size_t i = 0; i < query_count; ++i) {
+            hits.clear();
+            bvh.query_ray(origins[i], directions[i], T{100}, hits);
+            benchmark::DoNotOptimize(hits.data());
+        }
+    }
+
+    state.SetItemsProcessed(
+        state.iterations() * static_cast<int64_t>(query_count)
+    );
+}
+
+/// Arguments: the number of points and the percentage of them moving each
+/// iteration, refitting the whole tree at 100.
+template <typename T>
+auto refit_bvh(benchmark::State& state) -> void {
+    const auto count = static_cast<size_t>(state.range(0));
+    const auto stride = static_cast<size_t>(100 / state.range(1));
+    const auto points = random_points<T>(count);
+
+    auto bounds = std::vector<AABB<T>>{};
+    for (const auto& point : points) {
+        bounds.emplace_back(point, point);
+    }
+    auto bvh = BVH<T>{bounds};
+
+    auto moved = std::vector<uint32_t>{};
+    for (size_t i = 0; i < count; i += stride) {
+        moved.push_back(static_cast<uint32_t>(i));
+    }
+
+    for (auto _ : state) {
+        for (const auto index : moved) {
+            const auto offset = Vector<T, 3>{T{0.01}, 0, 0};
+            bounds[index] = AABB<T>{
+                bounds[index].min() + offset, bounds[index].max() + offset
+            };
+        }
+
+        if (stride == 1) {
+            bvh.refit(bounds);
+        } else {
+            bvh.refit(bounds, moved);
+        }
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+auto build_sizes(benchmark::internal::Benchmark* benchmark) -> void {
+    benchmark->ArgNames({"count", "threads"})
+        ->ArgsProduct({{10'000, 100'000, 1'000'000}, {1, 0}})
+        ->UseRealTime()
+        ->Unit(benchmark::kMillisecond);
+}
+
+auto query_sizes(benchmark::internal::Benchmark* benchmark) -> void {
+    benchmark->RangeMultiplier(10)->Range(1'000, 1'000'000);
+}
+
+auto refit_sizes(benchmark::internal::Benchmark* benchmark) -> void {
+    benchmark->ArgNames({"count", "percent"})
+        ->ArgsProduct({{100'000, 1'000'000}, {5, 100}});
+}
+
+}  // namespace
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-non-const-global-variables)
+BENCHMARK_TEMPLATE(build_bvh, float)->Apply(build_sizes);
+BENCHMARK_TEMPLATE(build_bvh, double)->Apply(build_sizes);
+BENCHMARK_TEMPLATE(nearest_bvh, float)->Apply(query_sizes);
+BENCHMARK_TEMPLATE(nearest_bvh, double)->Apply(query_sizes);
+BENCHMARK_TEMPLATE(nearest_linear, float)->RangeMultiplier(10)->Range(
+    1'000, 100'000
+);
+BENCHMARK_TEMPLATE(query_ray_bvh, float)->Apply(query_sizes);
+BENCHMARK_TEMPLATE(query_ray_bvh, double)->Apply(query_sizes);
+BENCHMARK_TEMPLATE(refit_bvh, float)->Apply(refit_sizes);
+BENCHMARK_TEMPLATE(refit_bvh, double)->Apply(refit_sizes);
+// NOLINTEND(cppcoreguidelines-avoid-non-const-global-variables)
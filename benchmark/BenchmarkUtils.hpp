@@ -0,0 +1,105 @@
+#pragma once
+
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include <LuminolMaths/Matrix.hpp>
+#include <LuminolMaths/Transform.hpp>
+#include <LuminolMaths/Units/Angle.hpp>
+#include <LuminolMaths/Vector.hpp>
+
+namespace Luminol::Benchmarks {
+
+/// The largest batch of vectors and scalars, 10M elements.
+constexpr auto max_batch_size = int64_t{10'000'000};
+
+/// The largest batch of matrices, capped so a 4x4 double batch stays in RAM.
+constexpr auto max_matrix_batch_size = int64_t{1'000'000};
+
+/**
+ * \brief Runs the benchmark over batches from 1 element up to `max_size`,
+ * growing by a factor of 10.
+ */
+template <int64_t MaxSize = max_batch_size>
+auto batch_sizes(benchmark::internal::Benchmark* benchmark) -> void {
+    benchmark->RangeMultiplier(10)->Range(1, MaxSize);
+}
+
+/**
+ * \brief Reports the number of elements and bytes processed per iteration, so
+ * the results can be compared across batch sizes.
+ */
+template <typename Element>
+auto set_processed(benchmark::State& state) -> void {
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    state.SetBytesProcessed(
+        state.iterations() * state.range(0) *
+        static_cast<int64_t>(sizeof(Element))
+    );
+}
+
+template <typename T>
+[[nodiscard]] auto random_values(size_t count, uint32_t seed = 1)
+    -> std::vector<T> {
+    auto generator = std::mt19937{seed};
+    auto distribution = std::uniform_real_distribution<T>{T{-1}, T{1}};
+
+    auto values = std::vector<T>(count);
+    for (auto& value : values) {
+        value = distribution(generator);
+    }
+    return values;
+}
+
+template <typename T, size_t N>
+[[nodiscard]] auto random_vectors(size_t count, uint32_t seed = 1)
+    -> std::vector<Maths::Vector<T, N>> {
+    const auto values = random_values<T>(count * N, seed);
+
+    auto vectors = std::vector<Maths::Vector<T, N>>(count);
+    for (size_t i = 0; i < count; ++i) {
+        for (size_t j = 0; j < N; ++j) {
+            vectors[i][j] = values[i * N + j];
+        }
+    }
+    return vectors;
+}
+
+template <typename T, size_t M, size_t N>
+[[nodiscard]] auto random_matrices(size_t count, uint32_t seed = 1)
+    -> std::vector<Maths::Matrix<T, M, N>> {
+    const auto values = random_values<T>(count * M * N, seed);
+
+    auto matrices = std::vector<Maths::Matrix<T, M, N>>(
+        count, Maths::Matrix<T, M, N>::zero()
+    );
+    for (size_t i = 0; i < count; ++i) {
+        for (size_t row = 0; row < M; ++row) {
+            for (size_t column = 0; column < N; ++column) {
+                matrices[i][row][column] =
+                    values[(i * M + row) * N + column];
+            }
+        }
+    }
+    return matrices;
+}
+
+/**
+ * \brief Returns a fixed affine transform combining a non-uniform scale, two
+ * rotations and a translation, so no term of the matrix is trivial.
+ */
+template <typename T>
+[[nodiscard]] auto make_transform() -> Maths::Matrix<T, 4, 4> {
+    using Radians = Units::Angle<T, Units::Radian>;
+
+    return Maths::Transform::scale_4x4(Maths::Vector<T, 3>{2, 3, 4}) *
+           Maths::Transform::rotate_x<T, 4>(Radians{T{0.5}}) *
+           Maths::Transform::rotate_z<T, 4>(Radians{T{-1.25}}) *
+           Maths::Transform::translate_4x4(Maths::Vector<T, 3>{-1, 5, 7});
+}
+
+}  // namespace Luminol::Benchmarks
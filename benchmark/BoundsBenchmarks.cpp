@@ -0,0 +1,138 @@
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+#include <BenchmarkUtils.hpp>
+#include <LuminolMaths/AABB.hpp>
+#include <LuminolMaths/BitMask.hpp>
+#include <LuminolMaths/Sphere.hpp>
+#include <LuminolMaths/Transform.hpp>
+#include <LuminolMaths/TransformBatch.hpp>
+
+using namespace Luminol::Maths;
+using namespace Luminol::Benchmarks;
+
+namespace {
+
+template <typename T>
+[[nodiscard]] auto random_boxes(size_t count) -> std::vector<AABB<T>> {
+    const auto centers = random_vectors<T, 3>(count, 1);
+    const auto extents = random_vectors<T, 3>(count, 2);
+
+    auto boxes = std::vector<AABB<T>>(count);
+    for (size_t i = 0; i < count; ++i) {
+        const auto extent = Vector<T, 3>{
+            std::fabs(extents[i].x()),
+            std::fabs(extents[i].y()),
+            std::fabs(extents[i].z()),
+        } * T{0.1};
+        boxes[i] = AABB<T>::from_center_extent(centers[i], extent);
+    }
+    return boxes;
+}
+
+template <typename T>
+auto transform_boxes(benchmark::State& state) -> void {
+    const auto count = static_cast<size_t>(state.range(0));
+    const auto matrix = make_transform<T>();
+    const auto boxes = random_boxes<T>(count);
+
+    auto out = std::vector<AABB<T>>(count);
+
+    for (auto _ : state) {
+        transform<T>(matrix, boxes, out);
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+
+    set_processed<AABB<T>>(state);
+}
+
+/// Transforms the eight corners of every box and merges them, the baseline
+/// of Arvo's method.
+template <typename T>
+auto transform_box_corners(benchmark::State& state) -> void {
+    const auto count = static_cast<size_t>(state.range(0));
+    const auto matrix = make_transform<T>();
+    const auto boxes = random_boxes<T>(count);
+
+    auto out = std::vector<AABB<T>>(count);
+
+    for (auto _ : state) {
+        for (size_t i = 0; i < count; ++i) {
+            const auto& box = boxes[i];
+
+            auto corners = std::array<Vector<T, 3>, 8>{};
+            for (size_t j = 0; j < corners.size(); ++j) {
+                corners[j] = {
+                    (j & 1) != 0 ? box.max().x() : box.min().x(),
+                    (j & 2) != 0 ? box.max().y() : box.min().y(),
+                    (j & 4) != 0 ? box.max().z() : box.min().z(),
+                };
+            }
+            Transform::transform_points<T>(matrix, corners);
+
+            out[i] = AABB<T>::from_points(corners);
+        }
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+
+    set_processed<AABB<T>>(state);
+}
+
+template <typename T>
+auto overlap_boxes(benchmark::State& state) -> void {
+    const auto count = static_cast<size_t>(state.range(0));
+    const auto boxes = random_boxes<T>(count);
+    const auto probe = AABB<T>{{T{-0.5}, T{-0.5}, T{-0.5}}, {0, 0, 0}};
+
+    auto overlapping = std::vector<uint64_t>(BitMask::word_count(count));
+
+    for (auto _ : state) {
+        overlaps<T>(probe, boxes, overlapping);
+        benchmark::DoNotOptimize(overlapping.data());
+        benchmark::ClobberMemory();
+    }
+
+    set_processed<AABB<T>>(state);
+}
+
+template <typename T>
+auto transform_spheres(benchmark::State& state) -> void {
+    const auto count = static_cast<size_t>(state.range(0));
+    const auto matrix = make_transform<T>();
+    const auto centers = random_vectors<T, 3>(count, 1);
+    const auto radii = random_values<T>(count, 2);
+
+    auto spheres = std::vector<Sphere<T>>(count);
+    for (size_t i = 0; i < count; ++i) {
+        spheres[i] = Sphere<T>{centers[i], std::fabs(radii[i]) * T{0.1}};
+    }
+
+    auto out = std::vector<Sphere<T>>(count);
+
+    for (auto _ : state) {
+        transform<T>(matrix, spheres, out);
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+
+    set_processed<Sphere<T>>(state);
+}
+
+}  // namespace
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-non-const-global-variables)
+BENCHMARK_TEMPLATE(transform_boxes, float)->Apply(batch_sizes);
+BENCHMARK_TEMPLATE(transform_boxes, double)->Apply(batch_sizes);
+BENCHMARK_TEMPLATE(transform_box_corners, float)->Apply(batch_sizes);
+BENCHMARK_TEMPLATE(transform_box_corners, double)->Apply(batch_sizes);
+BENCHMARK_TEMPLATE(overlap_boxes, float)->Apply(batch_sizes);
+BENCHMARK_TEMPLATE(overlap_boxes, double)->Apply(batch_sizes);
+BENCHMARK_TEMPLATE(transform_spheres, float)->Apply(batch_sizes);
+BENCHMARK_TEMPLATE(transform_spheres, double)->Apply(batch_sizes);
+// NOLINTEND(cppcoreguidelines-avoid-non-const-global-variables)
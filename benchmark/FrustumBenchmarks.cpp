@@ -0,0 +1,99 @@
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+#include <BenchmarkUtils.hpp>
+#include <LuminolMaths/BitMask.hpp>
+#include <LuminolMaths/Frustum.hpp>
+#include <LuminolMaths/Transform.hpp>
+#include <LuminolMaths/VectorBatch.hpp>
+
+using namespace Luminol::Maths;
+using namespace Luminol::Benchmarks;
+
+namespace {
+
+/// A camera looking at the unit cube of the random values, so roughly half
+/// of the objects are culled.
+template <typename T>
+[[nodiscard]] auto make_frustum() -> Frustum<T> {
+    using Degrees = Luminol::Units::Angle<T, Luminol::Units::Degree>;
+
+    const auto view = Transform::left_handed_look_at_matrix<T>({
+        .eye = {T{0.5}, 0, -2},
+        .target = {T{0.5}, 0, 0},
+        .up_vector = {0, 1, 0},
+    });
+    const auto projection =
+        Transform::left_handed_perspective_projection_matrix<T>({
+            .fov = Degrees{45},
+            .aspect_ratio = T{16} / T{9},
+            .near_plane = T{0.1},
+            .far_plane = T{2.5},
+        });
+
+    return Frustum<T>{view * projection};
+}
+
+template <typename T>
+auto cull_spheres(benchmark::State& state) -> void {
+    const auto count = static_cast<size_t>(state.range(0));
+    const auto frustum = make_frustum<T>();
+    const auto centers = VectorBatch<T, 3>{random_vectors<T, 3>(count)};
+
+    auto radii = random_values<T>(count, 2);
+    for (auto& radius : radii) {
+        radius = std::fabs(radius) * T{0.05};
+    }
+
+    auto visible = std::vector<uint64_t>(BitMask::word_count(count));
+
+    for (auto _ : state) {
+        frustum.cull_spheres(centers, radii, visible);
+        benchmark::DoNotOptimize(visible.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <typename T>
+auto cull_boxes(benchmark::State& state) -> void {
+    const auto count = static_cast<size_t>(state.range(0));
+    const auto frustum = make_frustum<T>();
+    const auto centers = random_vectors<T, 3>(count);
+    const auto extents = random_vectors<T, 3>(count, 2);
+
+    auto mins = VectorBatch<T, 3>{count};
+    auto maxs = VectorBatch<T, 3>{count};
+    for (size_t i = 0; i < count; ++i) {
+        const auto extent = Vector<T, 3>{
+            std::fabs(extents[i].x()),
+            std::fabs(extents[i].y()),
+            std::fabs(extents[i].z()),
+        } * T{0.05};
+        mins.set(i, centers[i] - extent);
+        maxs.set(i, centers[i] + extent);
+    }
+
+    auto visible = std::vector<uint64_t>(BitMask::word_count(count));
+
+    for (auto _ : state) {
+        frustum.cull_boxes(mins, maxs, visible);
+        benchmark::DoNotOptimize(visible.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+}  // namespace
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-non-const-global-variables)
+BENCHMARK_TEMPLATE(cull_spheres, float)->Apply(batch_sizes);
+BENCHMARK_TEMPLATE(cull_spheres, double)->Apply(batch_sizes);
+BENCHMARK_TEMPLATE(cull_boxes, float)->Apply(batch_sizes);
+BENCHMARK_TEMPLATE(cull_boxes, double)->Apply(batch_sizes);
+// NOLINTEND(cppcoreguidelines-avoid-non-const-global-variables)
@@ -0,0 +1,199 @@
+#include <benchmark/benchmark.h>
+
+#include <BenchmarkUtils.hpp>
+#include <LuminolMaths/LUDecomposition.hpp>
+#include <LuminolMaths/Matrix.hpp>
+
+using namespace Luminol::Maths;
+using namespace Luminol::Benchmarks;
+
+namespace {
+
+struct Add {
+    template <typename Matrix>
+    auto operator()(const Matrix& lhs, const Matrix& rhs) const {
+        return lhs + rhs;
+    }
+};
+
+struct Subtract {
+    template <typename Matrix>
+    auto operator()(const Matrix& lhs, const Matrix& rhs) const {
+        return lhs - rhs;
+    }
+};
+
+struct Multiply {
+    template <typename Matrix>
+    auto operator()(const Matrix& lhs, const Matrix& rhs) const {
+        return lhs * rhs;
+    }
+};
+
+struct Scale {
+    template <typename T, size_t M, size_t N>
+    auto operator()(const Matrix<T, M, N>& matrix) const {
+        return matrix * T{1.5};
+    }
+};
+
+struct Transpose {
+    template <typename Matrix>
+    auto operator()(const Matrix& matrix) const {
+        return matrix.transpose();
+    }
+};
+
+struct Determinant {
+    template <typename Matrix>
+    auto operator()(const Matrix& matrix) const {
+        return matrix.determinant();
+    }
+};
+
+struct Inverse {
+    template <typename Matrix>
+    auto operator()(const Matrix& matrix) const {
+        return matrix.inverse();
+    }
+};
+
+struct AffineInverse {
+    template <typename Matrix>
+    auto operator()(const Matrix& matrix) const {
+        return matrix.affine_inverse();
+    }
+};
+
+struct LUInverse {
+    template <typename T, size_t N>
+    auto operator()(const Matrix<T, N, N>& matrix) const {
+        return LUDecomposition{matrix}.inverse();
+    }
+};
+
+template <typename T, size_t N, typename Operation>
+auto matrix_binary(benchmark::State& state) -> void {
+    const auto count = static_cast<size_t>(state.range(0));
+    const auto lhs = random_matrices<T, N, N>(count, 1);
+    const auto rhs = random_matrices<T, N, N>(count, 2);
+
+    auto out = std::vector<Matrix<T, N, N>>(count, Matrix<T, N, N>::zero());
+
+    for (auto _ : state) {
+        for (size_t i = 0; i < count; ++i) {
+            out[i] = Operation{}(lhs[i], rhs[i]);
+        }
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+
+    set_processed<Matrix<T, N, N>>(state);
+}
+
+template <typename T, size_t N, typename Operation>
+auto matrix_unary(benchmark::State& state) -> void {
+    const auto count = static_cast<size_t>(state.range(0));
+    const auto matrices = random_matrices<T, N, N>(count);
+
+    using Result = decltype(Operation{}(matrices[0]));
+    auto out = std::vector<Result>(count, Operation{}(matrices.front()));
+
+    for (auto _ : state) {
+        for (size_t i = 0; i < count; ++i) {
+            out[i] = Operation{}(matrices[i]);
+        }
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+
+    set_processed<Matrix<T, N, N>>(state);
+}
+
+/// The product of an MxK and a KxN matrix.
+template <typename T, size_t M, size_t K, size_t N>
+auto matrix_product(benchmark::State& state) -> void {
+    const auto count = static_cast<size_t>(state.range(0));
+    const auto lhs = random_matrices<T, M, K>(count, 1);
+    const auto rhs = random_matrices<T, K, N>(count, 2);
+
+    auto out = std::vector<Matrix<T, M, N>>(count, Matrix<T, M, N>::zero());
+
+    for (auto _ : state) {
+        for (size_t i = 0; i < count; ++i) {
+            out[i] = lhs[i] * rhs[i];
+        }
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+
+    set_processed<Matrix<T, M, N>>(state);
+}
+
+/// Affine matrices with a random linear block and the last column [0 0 0 1].
+template <typename T, size_t N, typename Operation>
+auto matrix_affine(benchmark::State& state) -> void {
+    const auto count = static_cast<size_t>(state.range(0));
+    auto matrices = random_matrices<T, N, N>(count);
+    for (auto& matrix : matrices) {
+        for (size_t i = 0; i < N; ++i) {
+            matrix[i][N - 1] = i == N - 1 ? T{1} : T{0};
+        }
+    }
+
+    using Result = decltype(Operation{}(matrices[0]));
+    auto out = std::vector<Result>(count, Operation{}(matrices.front()));
+
+    for (auto _ : state) {
+        for (size_t i = 0; i < count; ++i) {
+            out[i] = Operation{}(matrices[i]);
+        }
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+
+    set_processed<Matrix<T, N, N>>(state);
+}
+
+constexpr auto matrix_batch_sizes = batch_sizes<max_matrix_batch_size>;
+
+}  // namespace
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-non-const-global-variables)
+#define LUMINOL_MATRIX_BENCHMARKS(T, N)                                    \
+    BENCHMARK_TEMPLATE(matrix_binary, T, N, Add)                           \
+        ->Apply(matrix_batch_sizes);                                       \
+    BENCHMARK_TEMPLATE(matrix_binary, T, N, Subtract)                      \
+        ->Apply(matrix_batch_sizes);                                       \
+    BENCHMARK_TEMPLATE(matrix_binary, T, N, Multiply)                      \
+        ->Apply(matrix_batch_sizes);                                       \
+    BENCHMARK_TEMPLATE(matrix_unary, T, N, Scale)                          \
+        ->Apply(matrix_batch_sizes);                                       \
+    BENCHMARK_TEMPLATE(matrix_unary, T, N, Transpose)                      \
+        ->Apply(matrix_batch_sizes);                                       \
+    BENCHMARK_TEMPLATE(matrix_unary, T, N, Determinant)                    \
+        ->Apply(matrix_batch_sizes);                                       \
+    BENCHMARK_TEMPLATE(matrix_unary, T, N, Inverse)                        \
+        ->Apply(matrix_batch_sizes);                                       \
+    BENCHMARK_TEMPLATE(matrix_unary, T, N, LUInverse)                      \
+        ->Apply(matrix_batch_sizes)
+
+LUMINOL_MATRIX_BENCHMARKS(float, 2);
+LUMINOL_MATRIX_BENCHMARKS(double, 2);
+LUMINOL_MATRIX_BENCHMARKS(float, 3);
+LUMINOL_MATRIX_BENCHMARKS(double, 3);
+LUMINOL_MATRIX_BENCHMARKS(float, 4);
+LUMINOL_MATRIX_BENCHMARKS(double, 4);
+
+BENCHMARK_TEMPLATE(matrix_affine, float, 4, AffineInverse)
+    ->Apply(matrix_batch_sizes);
+BENCHMARK_TEMPLATE(matrix_affine, double, 4, AffineInverse)
+    ->Apply(matrix_batch_sizes);
+
+BENCHMARK_TEMPLATE(matrix_product, float, 3, 4, 4)->Apply(matrix_batch_sizes);
+BENCHMARK_TEMPLATE(matrix_product, double, 3, 4, 4)->Apply(matrix_batch_sizes);
+BENCHMARK_TEMPLATE(matrix_product, float, 4, 4, 3)->Apply(matrix_batch_sizes);
+BENCHMARK_TEMPLATE(matrix_product, double, 4, 4, 3)->Apply(matrix_batch_sizes);
+BENCHMARK_TEMPLATE(matrix_product, float, 3, 4, 3)->Apply(matrix_batch_sizes);
+BENCHMARK_TEMPLATE(matrix_product, double, 3, 4, 3)->Apply(matrix_batch_sizes);
+// NOLINTEND(cppcoreguidelines-avoid-non-const-global-variables)
@@ -0,0 +1,76 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include <BenchmarkUtils.hpp>
+#include <LuminolMaths/FrameScratch.hpp>
+#include <LuminolMaths/Transform.hpp>
+#include <LuminolMaths/TransformBatch.hpp>
+
+using namespace Luminol::Maths;
+using namespace Luminol::Benchmarks;
+
+namespace {
+
+/// The largest frame, 1M points.
+constexpr auto max_frame_size = int64_t{1'000'000};
+
+/**
+ * \brief A frame transforming points and computing a mask from them, with the
+ * temporaries allocated from the heap.
+ */
+auto frame_heap(benchmark::State& state) -> void {
+    const auto count = static_cast<size_t>(state.range(0));
+    const auto points = random_vectors<float, 3>(count);
+    const auto matrix = Transform::translate_4x4(Vector3f{1, 2, 3});
+
+    for (auto _ : state) {
+        auto transformed = std::vector<Vector3f>(count);
+        Transform::transform_points(
+            matrix, std::span<const Vector3f>{points}, std::span{transformed}
+        );
+
+        auto mask = std::vector<uint8_t>(count);
+        for (size_t i = 0; i < count; ++i) {
+            mask[i] = transformed[i].z() > 3.0F ? 1 : 0;
+        }
+        benchmark::DoNotOptimize(mask.data());
+    }
+
+    set_processed<Vector3f>(state);
+}
+
+/// The same frame, with the temporaries allocated from a `FrameScratch`.
+auto frame_scratch(benchmark::State& state) -> void {
+    const auto count = static_cast<size_t>(state.range(0));
+    const auto points = random_vectors<float, 3>(count);
+    const auto matrix = Transform::translate_4x4(Vector3f{1, 2, 3});
+
+    auto scratch = FrameScratch{};
+
+    for (auto _ : state) {
+        scratch.begin_frame();
+
+        const auto transformed = scratch.allocate<Vector3f>(count);
+        Transform::transform_points(
+            matrix, std::span<const Vector3f>{points}, transformed
+        );
+
+        const auto mask = scratch.allocate<uint8_t>(count);
+        for (size_t i = 0; i < count; ++i) {
+            mask[i] = transformed[i].z() > 3.0F ? 1 : 0;
+        }
+        benchmark::DoNotOptimize(mask.data());
+    }
+
+    set_processed<Vector3f>(state);
+}
+
+}  // namespace
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-non-const-global-variables)
+BENCHMARK(frame_heap)->Apply(batch_sizes<max_frame_size>);
+BENCHMARK(frame_scratch)->Apply(batch_sizes<max_frame_size>);
+// NOLINTEND(cppcoreguidelines-avoid-non-const-global-variables)
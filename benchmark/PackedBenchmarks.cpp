@@ -0,0 +1,111 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <span>
+#include <vector>
+
+#include <BenchmarkUtils.hpp>
+#include <LuminolMaths/Packed.hpp>
+
+using namespace Luminol::Maths;
+using namespace Luminol::Benchmarks;
+
+namespace {
+
+/// Copying full precision vectors, the baseline for decoding packed ones.
+auto copy_vectors(benchmark::State& state) -> void {
+    const auto count = static_cast<size_t>(state.range(0));
+    const auto vectors = random_vectors<float, 3>(count);
+
+    auto out = std::vector<Vector3f>(count);
+
+    for (auto _ : state) {
+        std::copy(vectors.begin(), vectors.end(), out.begin());
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+
+    set_processed<Vector3f>(state);
+}
+
+template <PackedComponent P>
+auto encode_vectors(benchmark::State& state) -> void {
+    const auto count = static_cast<size_t>(state.range(0));
+    const auto vectors = random_vectors<float, 3>(count);
+
+    auto out = std::vector<Vector<P, 3>>(count);
+
+    for (auto _ : state) {
+        encode(vectors, std::span{out});
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+
+    set_processed<Vector3f>(state);
+}
+
+template <PackedComponent P>
+auto decode_vectors(benchmark::State& state) -> void {
+    const auto count = static_cast<size_t>(state.range(0));
+    const auto vectors = random_vectors<float, 3>(count);
+
+    auto packed = std::vector<Vector<P, 3>>(count);
+    encode(vectors, std::span{packed});
+
+    auto out = std::vector<Vector3f>(count);
+
+    for (auto _ : state) {
+        decode(packed, std::span{out});
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+
+    set_processed<Vector3f>(state);
+}
+
+auto encode_octahedral(benchmark::State& state) -> void {
+    const auto count = static_cast<size_t>(state.range(0));
+    const auto vectors = random_vectors<float, 3>(count);
+
+    auto out = std::vector<OctahedralNormal>(count);
+
+    for (auto _ : state) {
+        encode(vectors, std::span{out});
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+
+    set_processed<Vector3f>(state);
+}
+
+auto decode_octahedral(benchmark::State& state) -> void {
+    const auto count = static_cast<size_t>(state.range(0));
+    const auto vectors = random_vectors<float, 3>(count);
+
+    auto normals = std::vector<OctahedralNormal>(count);
+    encode(vectors, std::span{normals});
+
+    auto out = std::vector<Vector3f>(count);
+
+    for (auto _ : state) {
+        decode(normals, std::span{out});
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+
+    set_processed<Vector3f>(state);
+}
+
+}  // namespace
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-non-const-global-variables)
+BENCHMARK(copy_vectors)->Apply(batch_sizes);
+BENCHMARK_TEMPLATE(encode_vectors, Half)->Apply(batch_sizes);
+BENCHMARK_TEMPLATE(encode_vectors, Snorm8)->Apply(batch_sizes);
+BENCHMARK_TEMPLATE(encode_vectors, Snorm16)->Apply(batch_sizes);
+BENCHMARK_TEMPLATE(decode_vectors, Half)->Apply(batch_sizes);
+BENCHMARK_TEMPLATE(decode_vectors, Snorm8)->Apply(batch_sizes);
+BENCHMARK_TEMPLATE(decode_vectors, Snorm16)->Apply(batch_sizes);
+BENCHMARK(encode_octahedral)->Apply(batch_sizes);
+BENCHMARK(decode_octahedral)->Apply(batch_sizes);
+// NOLINTEND(cppcoreguidelines-avoid-non-const-global-variables)
@@ -0,0 +1,284 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <vector>
+
+#include <BenchmarkUtils.hpp>
+#include <LuminolMaths/Execution.hpp>
+#include <LuminolMaths/ExecutionStd.hpp>
+#include <LuminolMaths/Transform.hpp>
+#include <LuminolMaths/TransformBatch.hpp>
+#include <LuminolMaths/TransformHierarchy.hpp>
+#include <LuminolMaths/TransformTrs.hpp>
+#include <LuminolMaths/VectorBatch.hpp>
+
+using namespace Luminol::Maths;
+using namespace Luminol::Benchmarks;
+
+namespace {
+
+template <typename T>
+auto transform_points(benchmark::State& state) -> void {
+    const auto count = static_cast<size_t>(state.range(0));
+    const auto matrix = make_transform<T>();
+    const auto points = random_vectors<T, 3>(count);
+
+    auto out = std::vector<Vector<T, 3>>(count);
+
+    for (auto _ : state) {
+        Transform::transform_points(matrix, points, out);
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+
+    set_processed<Vector<T, 3>>(state);
+}
+
+template <typename T>
+auto transform_directions(benchmark::State& state) -> void {
+    const auto count = static_cast<size_t>(state.range(0));
+    const auto matrix = make_transform<T>();
+    const auto directions = random_vectors<T, 3>(count);
+
+    auto out = std::vector<Vector<T, 3>>(count);
+
+    for (auto _ : state) {
+        Transform::transform_directions(matrix, directions, out);
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+
+    set_processed<Vector<T, 3>>(state);
+}
+
+template <typename T>
+auto transform_vectors(benchmark::State& state) -> void {
+    const auto count = static_cast<size_t>(state.range(0));
+    const auto matrix = make_transform<T>();
+    const auto vectors = random_vectors<T, 4>(count);
+
+    auto out = std::vector<Vector<T, 4>>(count);
+
+    for (auto _ : state) {
+        Transform::transform_vectors(matrix, vectors, out);
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+
+    set_processed<Vector<T, 4>>(state);
+}
+
+template <typename T>
+auto transform_point_batch(benchmark::State& state) -> void {
+    const auto count = static_cast<size_t>(state.range(0));
+    const auto matrix = make_transform<T>();
+    const auto points = VectorBatch<T, 3>{random_vectors<T, 3>(count)};
+
+    auto out = VectorBatch<T, 3>{count};
+
+    for (auto _ : state) {
+        Transform::transform_points(matrix, points, out);
+        benchmark::DoNotOptimize(out.x().data());
+        benchmark::ClobberMemory();
+    }
+
+    set_processed<Vector<T, 3>>(state);
+}
+
+/// Transforms the largest batch of points on a pool with the given number of
+/// threads, measuring how the chunked kernels scale with the core count.
+template <typename T>
+auto transform_points_parallel(benchmark::State& state) -> void {
+    const auto count = static_cast<size_t>(max_batch_size);
+    const auto matrix = make_transform<T>();
+    const auto points = random_vectors<T, 3>(count);
+
+    auto pool = Execution::ThreadPool{static_cast<size_t>(state.range(0))};
+    auto out = std::vector<Vector<T, 3>>(count);
+
+    for (auto _ : state) {
+        Transform::transform_points(pool, matrix, points, out);
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * max_batch_size);
+    state.SetBytesProcessed(
+        state.iterations() * max_batch_size *
+        static_cast<int64_t>(sizeof(Vector<T, 3>))
+    );
+}
+
+/// Runs the parallel benchmarks from 1 to 16 threads.
+auto thread_counts(benchmark::internal::Benchmark* benchmark) -> void {
+    benchmark->ArgName("threads")
+        ->RangeMultiplier(2)
+        ->Range(1, 16)
+        ->UseRealTime()
+        ->Unit(benchmark::kMillisecond);
+}
+
+/// A tree where every node has 8 children, stored breadth first like a scene
+/// graph loaded level by level.
+template <typename T>
+[[nodiscard]] auto make_hierarchy(size_t count) -> TransformHierarchy<T> {
+    const auto translations = random_vectors<T, 3>(count);
+
+    auto hierarchy = TransformHierarchy<T>{};
+    hierarchy.reserve(count);
+
+    hierarchy.add({.translation = translations[0]});
+    for (size_t i = 1; i < count; ++i) {
+        hierarchy.add(
+            {.translation = translations[i]}, static_cast<uint32_t>((i - 1) / 8)
+        );
+    }
+    hierarchy.update();
+    return hierarchy;
+}
+
+/// Arguments: the number of nodes and the percentage of them moving each
+/// frame, taken from the deepest level like the props of a scene. A
+/// percentage of 100 recomputes every world matrix.
+template <typename T, bool Parallel = false>
+auto update_hierarchy(benchmark::State& state) -> void {
+    const auto count = static_cast<size_t>(state.range(0));
+    const auto moving = count * static_cast<size_t>(state.range(1)) / 100;
+
+    auto hierarchy = make_hierarchy<T>(count);
+    const auto offset = Vector<T, 3>{T{0.01}, T{0}, T{0}};
+
+    for (auto _ : state) {
+        for (size_t i = count - moving; i < count; ++i) {
+            const auto index = static_cast<uint32_t>(i);
+            hierarchy.set_translation(
+                index, hierarchy.local(index).translation + offset
+            );
+        }
+        if (moving == count) {
+            hierarchy.invalidate();
+        }
+
+        auto updated = size_t{0};
+        if constexpr (Parallel) {
+            updated = hierarchy.update(std::execution::par_unseq);
+        } else {
+            updated = hierarchy.update();
+        }
+        benchmark::DoNotOptimize(updated);
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+auto hierarchy_sizes(benchmark::internal::Benchmark* benchmark) -> void {
+    benchmark->ArgNames({"count", "percent"})
+        ->ArgsProduct({{10'000, 100'000, 1'000'000}, {5, 100}})
+        ->UseRealTime();
+}
+
+/// Builds one model matrix per element from a rotation angle.
+template <typename T, Precision P = Precision::Exact>
+auto compose_transforms(benchmark::State& state) -> void {
+    using Radians = Luminol::Units::Angle<T, Luminol::Units::Radian>;
+
+    const auto count = static_cast<size_t>(state.range(0));
+    const auto angles = random_values<T>(count);
+    const auto translations = random_vectors<T, 3>(count);
+
+    auto out = std::vector<Matrix<T, 4, 4>>(count, Matrix<T, 4, 4>::zero());
+
+    for (auto _ : state) {
+        for (size_t i = 0; i < count; ++i) {
+            out[i] = Transform::rotate_y<T, 4, P>(Radians{angles[i]}) *
+                     Transform::translate_4x4(translations[i]);
+        }
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+
+    set_processed<Matrix<T, 4, 4>>(state);
+}
+
+/// Builds one model matrix per element from Euler angles by chaining the
+/// individual transforms.
+template <typename T>
+auto compose_trs_products(benchmark::State& state) -> void {
+    using Radians = Luminol::Units::Angle<T, Luminol::Units::Radian>;
+
+    const auto count = static_cast<size_t>(state.range(0));
+    const auto translations = random_vectors<T, 3>(count, 1);
+    const auto rotations = random_vectors<T, 3>(count, 2);
+    const auto scales = random_vectors<T, 3>(count, 3);
+
+    auto out = std::vector<Matrix<T, 4, 4>>(count, Matrix<T, 4, 4>::zero());
+
+    for (auto _ : state) {
+        for (size_t i = 0; i < count; ++i) {
+            out[i] = Transform::scale_4x4(scales[i]) *
+                     Transform::rotate_x<T, 4>(Radians{rotations[i].x()}) *
+                     Transform::rotate_y<T, 4>(Radians{rotations[i].y()}) *
+                     Transform::rotate_z<T, 4>(Radians{rotations[i].z()}) *
+                     Transform::translate_4x4(translations[i]);
+        }
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+
+    set_processed<Matrix<T, 4, 4>>(state);
+}
+
+/// Builds one model matrix per element from Euler angles with the batched
+/// `trs`.
+template <typename T, Precision P = Precision::Exact>
+auto compose_trs_batch(benchmark::State& state) -> void {
+    const auto count = static_cast<size_t>(state.range(0));
+    const auto translations = VectorBatch<T, 3>{random_vectors<T, 3>(count, 1)};
+    const auto rotations = VectorBatch<T, 3>{random_vectors<T, 3>(count, 2)};
+    const auto scales = VectorBatch<T, 3>{random_vectors<T, 3>(count, 3)};
+
+    auto out = std::vector<Matrix<T, 4, 4>>(count, Matrix<T, 4, 4>::zero());
+
+    for (auto _ : state) {
+        Transform::trs<P>(translations, rotations, scales, out);
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+
+    set_processed<Matrix<T, 4, 4>>(state);
+}
+
+constexpr auto matrix_batch_sizes = batch_sizes<max_matrix_batch_size>;
+
+}  // namespace
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-non-const-global-variables)
+BENCHMARK_TEMPLATE(transform_points, float)->Apply(batch_sizes);
+BENCHMARK_TEMPLATE(transform_points, double)->Apply(batch_sizes);
+BENCHMARK_TEMPLATE(transform_directions, float)->Apply(batch_sizes);
+BENCHMARK_TEMPLATE(transform_directions, double)->Apply(batch_sizes);
+BENCHMARK_TEMPLATE(transform_vectors, float)->Apply(batch_sizes);
+BENCHMARK_TEMPLATE(transform_vectors, double)->Apply(batch_sizes);
+BENCHMARK_TEMPLATE(transform_point_batch, float)->Apply(batch_sizes);
+BENCHMARK_TEMPLATE(transform_point_batch, double)->Apply(batch_sizes);
+BENCHMARK_TEMPLATE(transform_points_parallel, float)->Apply(thread_counts);
+BENCHMARK_TEMPLATE(transform_points_parallel, double)->Apply(thread_counts);
+BENCHMARK_TEMPLATE(update_hierarchy, float)->Apply(hierarchy_sizes);
+BENCHMARK_TEMPLATE(update_hierarchy, double)->Apply(hierarchy_sizes);
+BENCHMARK_TEMPLATE(update_hierarchy, float, true)->Apply(hierarchy_sizes);
+BENCHMARK_TEMPLATE(compose_transforms, float)->Apply(matrix_batch_sizes);
+BENCHMARK_TEMPLATE(compose_transforms, double)->Apply(matrix_batch_sizes);
+BENCHMARK_TEMPLATE(compose_transforms, float, Precision::Fast)
+    ->Apply(matrix_batch_sizes);
+BENCHMARK_TEMPLATE(compose_transforms, double, Precision::Fast)
+    ->Apply(matrix_batch_sizes);
+BENCHMARK_TEMPLATE(compose_trs_products, float)->Apply(matrix_batch_sizes);
+BENCHMARK_TEMPLATE(compose_trs_products, double)->Apply(matrix_batch_sizes);
+BENCHMARK_TEMPLATE(compose_trs_batch, float)->Apply(matrix_batch_sizes);
+BENCHMARK_TEMPLATE(compose_trs_batch, double)->Apply(matrix_batch_sizes);
+BENCHMARK_TEMPLATE(compose_trs_batch, float, Precision::Fast)
+    ->Apply(matrix_batch_sizes);
+BENCHMARK_TEMPLATE(compose_trs_batch, double, Precision::Fast)
+    ->Apply(matrix_batch_sizes);
+// NOLINTEND(cppcoreguidelines-avoid-non-const-global-variables)
@@ -0,0 +1,77 @@
+#include <benchmark/benchmark.h>
+
+#include <filesystem>
+#include <span>
+
+#include <BenchmarkUtils.hpp>
+#include <Demo/TransformTool.hpp>
+#include <LuminolMaths/ArrayFile.hpp>
+#include <LuminolMaths/Transform.hpp>
+
+using namespace Luminol::Maths;
+using namespace Luminol::Benchmarks;
+namespace TransformTool = Luminol::Demo::TransformTool;
+
+namespace {
+
+[[nodiscard]] auto input_path() -> std::filesystem::path {
+    return std::filesystem::temp_directory_path() /
+           "LuminolMaths.TransformToolBenchmarks.Input.bin";
+}
+
+[[nodiscard]] auto output_path() -> std::filesystem::path {
+    return std::filesystem::temp_directory_path() /
+           "LuminolMaths.TransformToolBenchmarks.Output.bin";
+}
+
+/// Transforms an array file of random points into another, reading,
+/// transforming and writing overlapped as luminol-transform does. The bytes
+/// processed count the input points, so the result reads as GB/s end to end.
+auto transform_file(benchmark::State& state, const Matrix4x4f& matrix)
+    -> void {
+    const auto count = static_cast<size_t>(state.range(0));
+    const auto points = random_vectors<float, 3>(count);
+    write_array_file(input_path(), std::span<const Vector3f>{points});
+
+    auto options = TransformTool::Options{};
+    options.matrix = matrix;
+    options.input = input_path();
+    options.output = output_path();
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(TransformTool::run(options));
+    }
+
+    set_processed<Vector3f>(state);
+    std::filesystem::remove(input_path());
+    std::filesystem::remove(output_path());
+}
+
+auto transform_file_affine(benchmark::State& state) -> void {
+    transform_file(
+        state,
+        Transform::translate_4x4(Vector3f{1, 2, 3}) *
+            Transform::scale_4x4(Vector3f{2, 2, 2})
+    );
+}
+
+auto transform_file_projective(benchmark::State& state) -> void {
+    transform_file(
+        state,
+        Transform::left_handed_perspective_projection_matrix(
+            Transform::PerspectiveMatrixParams<float>{
+                .fov = Luminol::Units::Degrees_f{90},
+                .aspect_ratio = 1.5F,
+                .near_plane = 0.5F,
+                .far_plane = 100,
+            }
+        )
+    );
+}
+
+}  // namespace
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-non-const-global-variables)
+BENCHMARK(transform_file_affine)->Apply(batch_sizes<>)->UseRealTime();
+BENCHMARK(transform_file_projective)->Apply(batch_sizes<>)->UseRealTime();
+// NOLINTEND(cppcoreguidelines-avoid-non-const-global-variables)
@@ -0,0 +1,233 @@
+#include <benchmark/benchmark.h>
+
+#include <span>
+#include <vector>
+
+#include <BenchmarkUtils.hpp>
+#include <LuminolMaths/Units/Angle.hpp>
+#include <LuminolMaths/Units/Convert.hpp>
+#include <LuminolMaths/Units/Force.hpp>
+#include <LuminolMaths/Units/Length.hpp>
+#include <LuminolMaths/Units/Time.hpp>
+#include <LuminolMaths/Units/UnitArray.hpp>
+#include <LuminolMaths/Units/VectorQuantity.hpp>
+#include <LuminolMaths/Units/Velocity.hpp>
+
+using namespace Luminol::Units;
+using namespace Luminol::Benchmarks;
+
+namespace {
+
+template <typename T, typename U>
+[[nodiscard]] auto random_units(size_t count, uint32_t seed = 1)
+    -> std::vector<Unit<T, U>> {
+    const auto values = random_values<T>(count, seed);
+    return {values.begin(), values.end()};
+}
+
+template <typename T>
+auto length_conversion(benchmark::State& state) -> void {
+    const auto count = static_cast<size_t>(state.range(0));
+    const auto lengths = random_units<T, Kilometer>(count);
+
+    auto out = std::vector<Length<T, Millimeter>>(count, T{0});
+
+    for (auto _ : state) {
+        for (size_t i = 0; i < count; ++i) {
+            out[i] = lengths[i].template as<Millimeter>();
+        }
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+
+    set_processed<Length<T, Kilometer>>(state);
+}
+
+template <typename T>
+auto length_conversion_bulk(benchmark::State& state) -> void {
+    const auto count = static_cast<size_t>(state.range(0));
+    const auto lengths = random_values<T>(count);
+
+    auto out = std::vector<T>(count);
+
+    for (auto _ : state) {
+        convert<Kilometer, Millimeter, T>(lengths, out);
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+
+    set_processed<T>(state);
+}
+
+template <typename T>
+auto angle_conversion(benchmark::State& state) -> void {
+    const auto count = static_cast<size_t>(state.range(0));
+    const auto angles = random_units<T, Degree>(count);
+
+    auto out = std::vector<Angle<T, Radian>>(count, T{0});
+
+    for (auto _ : state) {
+        for (size_t i = 0; i < count; ++i) {
+            out[i] = angles[i].template as<Radian>();
+        }
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+
+    set_processed<Angle<T, Degree>>(state);
+}
+
+/// Adds lengths of different units, which converts the right-hand side.
+template <typename T>
+auto mixed_unit_addition(benchmark::State& state) -> void {
+    const auto count = static_cast<size_t>(state.range(0));
+    const auto meters = random_units<T, Meter>(count, 1);
+    const auto centimeters = random_units<T, Centimeter>(count, 2);
+
+    auto out = std::vector<Length<T, Meter>>(count, T{0});
+
+    for (auto _ : state) {
+        for (size_t i = 0; i < count; ++i) {
+            out[i] = meters[i] + centimeters[i];
+        }
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+
+    set_processed<Length<T, Meter>>(state);
+}
+
+/// Accumulates an array of lengths of another unit into an array of lengths,
+/// converting once per array.
+template <typename T>
+auto mixed_unit_array_addition(benchmark::State& state) -> void {
+    const auto count = static_cast<size_t>(state.range(0));
+    const auto meter_values = random_values<T>(count, 1);
+    const auto centimeter_values = random_values<T>(count, 2);
+
+    auto meters = UnitArray<T, Meter>{std::span{meter_values}};
+    const auto centimeters =
+        UnitArray<T, Centimeter>{std::span{centimeter_values}};
+
+    for (auto _ : state) {
+        meters += centimeters;
+        benchmark::DoNotOptimize(meters.values().data());
+        benchmark::ClobberMemory();
+    }
+
+    set_processed<Length<T, Meter>>(state);
+}
+
+template <typename T>
+auto velocity_from_length_and_time(benchmark::State& state) -> void {
+    const auto count = static_cast<size_t>(state.range(0));
+    const auto lengths = random_units<T, Kilometer>(count, 1);
+    const auto times = random_units<T, Hour>(count, 2);
+
+    using Result = Velocity<T, KilometerPerHour>;
+    auto out = std::vector<Result>(count, T{0});
+
+    for (auto _ : state) {
+        for (size_t i = 0; i < count; ++i) {
+            out[i] = lengths[i] / times[i];
+        }
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+
+    set_processed<Length<T, Kilometer>>(state);
+}
+
+template <typename T>
+auto force_from_mass_and_acceleration(benchmark::State& state) -> void {
+    const auto count = static_cast<size_t>(state.range(0));
+    const auto masses = random_units<T, Gram>(count, 1);
+
+    auto accelerations = std::vector<Acceleration<T, MeterPerSecondSquared>>{};
+    for (const auto value : random_values<T>(count, 2)) {
+        accelerations.push_back({{value}});
+    }
+
+    auto out = std::vector<Force<T, Newton>>(count, T{0});
+
+    for (auto _ : state) {
+        for (size_t i = 0; i < count; ++i) {
+            out[i] = masses[i] * accelerations[i];
+        }
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+
+    set_processed<Mass<T, Gram>>(state);
+}
+
+template <typename T>
+auto raw_vector_integration(benchmark::State& state) -> void {
+    const auto count = static_cast<size_t>(state.range(0));
+    const auto velocities = random_vectors<T, 3>(count, 1);
+    auto positions = random_vectors<T, 3>(count, 2);
+
+    // Kilometers per hour times seconds, converted to meters by hand.
+    const auto step = T{0.016} * T{1000} / T{3600};
+
+    for (auto _ : state) {
+        for (size_t i = 0; i < count; ++i) {
+            positions[i] += velocities[i] * step;
+        }
+        benchmark::DoNotOptimize(positions.data());
+        benchmark::ClobberMemory();
+    }
+
+    set_processed<Luminol::Maths::Vector<T, 3>>(state);
+}
+
+template <typename T>
+auto vector_quantity_integration(benchmark::State& state) -> void {
+    const auto count = static_cast<size_t>(state.range(0));
+
+    auto velocities = std::vector<VectorQuantity<T, KilometerPerHour, 3>>{};
+    for (const auto& vector : random_vectors<T, 3>(count, 1)) {
+        velocities.emplace_back(vector);
+    }
+    auto positions = std::vector<VectorQuantity<T, Meter, 3>>{};
+    for (const auto& vector : random_vectors<T, 3>(count, 2)) {
+        positions.emplace_back(vector);
+    }
+
+    const auto step = Time<T, Second>{T{0.016}};
+
+    for (auto _ : state) {
+        for (size_t i = 0; i < count; ++i) {
+            positions[i] += velocities[i] * step;
+        }
+        benchmark::DoNotOptimize(positions.data());
+        benchmark::ClobberMemory();
+    }
+
+    set_processed<VectorQuantity<T, Meter, 3>>(state);
+}
+
+}  // namespace
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-non-const-global-variables)
+BENCHMARK_TEMPLATE(length_conversion, float)->Apply(batch_sizes);
+BENCHMARK_TEMPLATE(length_conversion, double)->Apply(batch_sizes);
+BENCHMARK_TEMPLATE(length_conversion_bulk, float)->Apply(batch_sizes);
+BENCHMARK_TEMPLATE(length_conversion_bulk, double)->Apply(batch_sizes);
+BENCHMARK_TEMPLATE(angle_conversion, float)->Apply(batch_sizes);
+BENCHMARK_TEMPLATE(angle_conversion, double)->Apply(batch_sizes);
+BENCHMARK_TEMPLATE(mixed_unit_addition, float)->Apply(batch_sizes);
+BENCHMARK_TEMPLATE(mixed_unit_addition, double)->Apply(batch_sizes);
+BENCHMARK_TEMPLATE(mixed_unit_array_addition, float)->Apply(batch_sizes);
+BENCHMARK_TEMPLATE(mixed_unit_array_addition, double)->Apply(batch_sizes);
+BENCHMARK_TEMPLATE(velocity_from_length_and_time, float)->Apply(batch_sizes);
+BENCHMARK_TEMPLATE(velocity_from_length_and_time, double)->Apply(batch_sizes);
+BENCHMARK_TEMPLATE(force_from_mass_and_acceleration, float)
+    ->Apply(batch_sizes);
+BENCHMARK_TEMPLATE(force_from_mass_and_acceleration, double)
+    ->Apply(batch_sizes);
+BENCHMARK_TEMPLATE(raw_vector_integration, float)->Apply(batch_sizes);
+BENCHMARK_TEMPLATE(raw_vector_integration, double)->Apply(batch_sizes);
+BENCHMARK_TEMPLATE(vector_quantity_integration, float)->Apply(batch_sizes);
+BENCHMARK_TEMPLATE(vector_quantity_integration, double)->Apply(batch_sizes);
+// NOLINTEND(cppcoreguidelines-avoid-non-const-global-variables)
@@ -0,0 +1,195 @@
+#include <benchmark/benchmark.h>
+
+#include <BenchmarkUtils.hpp>
+#include <LuminolMaths/Lazy.hpp>
+#include <LuminolMaths/Vector.hpp>
+
+using namespace Luminol::Maths;
+using namespace Luminol::Benchmarks;
+
+namespace {
+
+struct Add {
+    template <typename Vector>
+    auto operator()(const Vector& lhs, const Vector& rhs) const {
+        return lhs + rhs;
+    }
+};
+
+struct Subtract {
+    template <typename Vector>
+    auto operator()(const Vector& lhs, const Vector& rhs) const {
+        return lhs - rhs;
+    }
+};
+
+struct Multiply {
+    template <typename Vector>
+    auto operator()(const Vector& lhs, const Vector& rhs) const {
+        return lhs * rhs;
+    }
+};
+
+struct Dot {
+    template <typename Vector>
+    auto operator()(const Vector& lhs, const Vector& rhs) const {
+        return lhs.dot(rhs);
+    }
+};
+
+struct Cross {
+    template <typename Vector>
+    auto operator()(const Vector& lhs, const Vector& rhs) const {
+        return lhs.cross(rhs);
+    }
+};
+
+struct Scale {
+    template <typename T, size_t N>
+    auto operator()(const Vector<T, N>& vector) const {
+        return vector * T{1.5};
+    }
+};
+
+struct Divide {
+    template <typename T, size_t N>
+    auto operator()(const Vector<T, N>& vector) const {
+        return vector / T{1.5};
+    }
+};
+
+struct Negate {
+    template <typename Vector>
+    auto operator()(const Vector& vector) const {
+        return -vector;
+    }
+};
+
+struct Length {
+    template <typename Vector>
+    auto operator()(const Vector& vector) const {
+        return vector.length();
+    }
+};
+
+struct Normalized {
+    template <typename Vector>
+    auto operator()(const Vector& vector) const {
+        return vector.normalized();
+    }
+};
+
+struct FastNormalized {
+    template <typename Vector>
+    auto operator()(const Vector& vector) const {
+        return vector.template normalized<Precision::Fast>();
+    }
+};
+
+/// The integrator step `a + b * s - c`, one temporary per operator.
+struct EagerChain {
+    template <typename T, size_t N>
+    auto operator()(
+        const Vector<T, N>& a, const Vector<T, N>& b, const Vector<T, N>& c
+    ) const {
+        return a + b * T{1.5} - c;
+    }
+};
+
+/// The same step fused into a single loop by the lazy expressions.
+struct LazyChain {
+    template <typename T, size_t N>
+    auto operator()(
+        const Vector<T, N>& a, const Vector<T, N>& b, const Vector<T, N>& c
+    ) const {
+        return Vector<T, N>{Lazy::lazy(a) + Lazy::lazy(b) * T{1.5} - c};
+    }
+};
+
+template <typename T, size_t N, typename Operation>
+auto vector_binary(benchmark::State& state) -> void {
+    const auto count = static_cast<size_t>(state.range(0));
+    const auto lhs = random_vectors<T, N>(count, 1);
+    const auto rhs = random_vectors<T, N>(count, 2);
+
+    using Result = decltype(Operation{}(lhs[0], rhs[0]));
+    auto out = std::vector<Result>(count);
+
+    for (auto _ : state) {
+        for (size_t i = 0; i < count; ++i) {
+            out[i] = Operation{}(lhs[i], rhs[i]);
+        }
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+
+    set_processed<Vector<T, N>>(state);
+}
+
+template <typename T, size_t N, typename Operation>
+auto vector_unary(benchmark::State& state) -> void {
+    const auto count = static_cast<size_t>(state.range(0));
+    const auto vectors = random_vectors<T, N>(count);
+
+    using Result = decltype(Operation{}(vectors[0]));
+    auto out = std::vector<Result>(count);
+
+    for (auto _ : state) {
+        for (size_t i = 0; i < count; ++i) {
+            out[i] = Operation{}(vectors[i]);
+        }
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+
+    set_processed<Vector<T, N>>(state);
+}
+
+template <typename T, size_t N, typename Operation>
+auto vector_chain(benchmark::State& state) -> void {
+    const auto count = static_cast<size_t>(state.range(0));
+    const auto a = random_vectors<T, N>(count, 1);
+    const auto b = random_vectors<T, N>(count, 2);
+    const auto c = random_vectors<T, N>(count, 3);
+
+    auto out = std::vector<Vector<T, N>>(count);
+
+    for (auto _ : state) {
+        for (size_t i = 0; i < count; ++i) {
+            out[i] = Operation{}(a[i], b[i], c[i]);
+        }
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+
+    set_processed<Vector<T, N>>(state);
+}
+
+}  // namespace
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-non-const-global-variables)
+#define LUMINOL_VECTOR_BENCHMARKS(T, N)                                     \
+    BENCHMARK_TEMPLATE(vector_binary, T, N, Add)->Apply(batch_sizes);       \
+    BENCHMARK_TEMPLATE(vector_binary, T, N, Subtract)->Apply(batch_sizes);  \
+    BENCHMARK_TEMPLATE(vector_binary, T, N, Multiply)->Apply(batch_sizes);  \
+    BENCHMARK_TEMPLATE(vector_binary, T, N, Dot)->Apply(batch_sizes);       \
+    BENCHMARK_TEMPLATE(vector_unary, T, N, Scale)->Apply(batch_sizes);      \
+    BENCHMARK_TEMPLATE(vector_unary, T, N, Divide)->Apply(batch_sizes);     \
+    BENCHMARK_TEMPLATE(vector_unary, T, N, Negate)->Apply(batch_sizes);     \
+    BENCHMARK_TEMPLATE(vector_unary, T, N, Length)->Apply(batch_sizes);     \
+    BENCHMARK_TEMPLATE(vector_unary, T, N, Normalized)->Apply(batch_sizes); \
+    BENCHMARK_TEMPLATE(vector_unary, T, N, FastNormalized)                  \
+        ->Apply(batch_sizes);                                               \
+    BENCHMARK_TEMPLATE(vector_chain, T, N, EagerChain)->Apply(batch_sizes); \
+    BENCHMARK_TEMPLATE(vector_chain, T, N, LazyChain)->Apply(batch_sizes)
+
+LUMINOL_VECTOR_BENCHMARKS(float, 2);
+LUMINOL_VECTOR_BENCHMARKS(double, 2);
+LUMINOL_VECTOR_BENCHMARKS(float, 3);
+LUMINOL_VECTOR_BENCHMARKS(double, 3);
+LUMINOL_VECTOR_BENCHMARKS(float, 4);
+LUMINOL_VECTOR_BENCHMARKS(double, 4);
+
+BENCHMARK_TEMPLATE(vector_binary, float, 3, Cross)->Apply(batch_sizes);
+BENCHMARK_TEMPLATE(vector_binary, double, 3, Cross)->Apply(batch_sizes);
+// NOLINTEND(cppcoreguidelines-avoid-non-const-global-variables)
@@ -0,0 +1,187 @@
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+#include <vector>
+
+/**
+ * A three stage read, compute and write pipeline over a fixed set of chunks.
+ *
+ * The chunks cycle from a reader thread, to the calling thread which computes
+ * them, to a writer thread which hands them back to the reader. With three
+ * chunks, one chunk is read and one written while the third is computed, so
+ * the I/O overlaps the computation and no memory is allocated per chunk.
+ */
+namespace Luminol::Demo {
+
+/**
+ * \brief A queue handing values from one thread to another.
+ */
+template <typename T>
+class ChunkQueue {
+public:
+    /**
+     * \brief Appends a value, ignored once the queue is cancelled.
+     */
+    auto push(T value) -> void {
+        {
+            const auto lock = std::scoped_lock{this->mutex};
+            if (this->cancelled) {
+                return;
+            }
+            this->values.push_back(std::move(value));
+        }
+        this->ready.notify_one();
+    }
+
+    /**
+     * \brief Waits for the next value.
+     * \return The next value, or nothing once the queue is closed and empty or
+     * cancelled.
+     */
+    [[nodiscard]] auto pop() -> std::optional<T> {
+        auto lock = std::unique_lock{this->mutex};
+        this->ready.wait(lock, [this] {
+            return !this->values.empty() || this->closed;
+        });
+
+        if (this->values.empty()) {
+            return std::nullopt;
+        }
+
+        auto value = std::move(this->values.front());
+        this->values.pop_front();
+        return value;
+    }
+
+    /**
+     * \brief Ends the queue once the values already pushed are popped.
+     */
+    auto close() -> void {
+        {
+            const auto lock = std::scoped_lock{this->mutex};
+            this->closed = true;
+        }
+        this->ready.notify_all();
+    }
+
+    /**
+     * \brief Ends the queue immediately, dropping the values not yet popped.
+     */
+    auto cancel() -> void {
+        {
+            const auto lock = std::scoped_lock{this->mutex};
+            this->values.clear();
+            this->closed = true;
+            this->cancelled = true;
+        }
+        this->ready.notify_all();
+    }
+
+private:
+    std::mutex mutex;
+    std::condition_variable ready;
+    std::deque<T> values;
+    bool closed = false;
+    bool cancelled = false;
+};
+
+/**
+ * \brief Runs `read`, `compute` and `write` over every chunk of a stream,
+ * overlapping the three stages.
+ *
+ * \param chunks The buffers cycling through the stages, at least 3 for the
+ * three stages to overlap.
+ * \param read Fills a chunk, returns false at the end of the stream, without
+ * touching the chunk. Runs on its own thread.
+ * \param compute Transforms a chunk. Runs on the calling thread.
+ * \param write Consumes a chunk. Runs on its own thread, in the order in which
+ * the chunks were read.
+ * \throw std::invalid_argument If there are no chunks, which would leave every
+ * stage waiting.
+ * \throw Any exception thrown by a stage, the first one if several throw. The
+ * other stages stop at their next chunk.
+ */
+template <typename Chunk, typename Read, typename Compute, typename Write>
+auto run_pipeline(
+    std::vector<Chunk>& chunks, Read read, Compute compute, Write write
+) -> void {
+    if (chunks.empty()) {
+        throw std::invalid_argument("The pipeline needs at least one chunk");
+    }
+
+    auto free_chunks = ChunkQueue<Chunk*>{};
+    auto read_chunks = ChunkQueue<Chunk*>{};
+    auto computed_chunks = ChunkQueue<Chunk*>{};
+
+    for (auto& chunk : chunks) {
+        free_chunks.push(&chunk);
+    }
+
+    auto error_mutex = std::mutex{};
+    auto error = std::exception_ptr{};
+    const auto fail = [&](std::exception_ptr exception) {
+        {
+            const auto lock = std::scoped_lock{error_mutex};
+            if (!error) {
+                error = std::move(exception);
+            }
+        }
+        free_chunks.cancel();
+        read_chunks.cancel();
+        computed_chunks.cancel();
+    };
+
+    auto reader = std::thread{[&] {
+        try {
+            while (auto chunk = free_chunks.pop()) {
+                if (!read(**chunk)) {
+                    break;
+                }
+                read_chunks.push(*chunk);
+            }
+            read_chunks.close();
+        } catch (...) {
+            fail(std::current_exception());
+        }
+    }};
+
+    auto writer = std::thread{[&] {
+        try {
+            while (auto chunk = computed_chunks.pop()) {
+                write(std::as_const(**chunk));
+                free_chunks.push(*chunk);
+            }
+        } catch (...) {
+            fail(std::current_exception());
+        }
+    }};
+
+    try {
+        while (auto chunk = read_chunks.pop()) {
+            compute(**chunk);
+            computed_chunks.push(*chunk);
+        }
+        computed_chunks.close();
+    } catch (...) {
+        fail(std::current_exception());
+    }
+
+    writer.join();
+
+    // The writer is done, so a reader still waiting for a chunk is released.
+    free_chunks.cancel();
+    reader.join();
+
+    if (error) {
+        std::rethrow_exception(error);
+    }
+}
+
+}  // namespace Luminol::Demo
@@ -0,0 +1,398 @@
+#include <Demo/TransformTool.hpp>
+
+#include <algorithm>
+#include <charconv>
+#include <format>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <utility>
+#include <variant>
+
+#include <Demo/Pipeline.hpp>
+#include <LuminolMaths/ArrayFile.hpp>
+#include <LuminolMaths/Transform.hpp>
+#include <LuminolMaths/TransformBatch.hpp>
+#include <LuminolMaths/Units/Angle.hpp>
+
+namespace Luminol::Demo::TransformTool {
+
+namespace {
+
+using Maths::Matrix4x4f;
+using Maths::Vector3f;
+using Maths::Vector4f;
+
+template <typename T>
+[[nodiscard]] auto parse_number(std::string_view text) -> T {
+    auto value = T{};
+    const auto* end = text.data() + text.size();
+    const auto [last, error] = std::from_chars(text.data(), end, value);
+    if (error != std::errc{} || last != end) {
+        throw std::invalid_argument(std::format("Invalid number '{}'", text));
+    }
+    return value;
+}
+
+/**
+ * \brief Parses a comma separated list of floats.
+ */
+[[nodiscard]] auto parse_floats(std::string_view text) -> std::vector<float> {
+    auto values = std::vector<float>{};
+    while (true) {
+        const auto comma = text.find(',');
+        values.push_back(parse_number<float>(text.substr(0, comma)));
+        if (comma == std::string_view::npos) {
+            return values;
+        }
+        text.remove_prefix(comma + 1);
+    }
+}
+
+[[nodiscard]] auto parse_vector(std::string_view text) -> Vector3f {
+    const auto values = parse_floats(text);
+    if (values.size() != 3) {
+        throw std::invalid_argument(
+            std::format("Expected X,Y,Z, not '{}'", text)
+        );
+    }
+    return {values[0], values[1], values[2]};
+}
+
+[[nodiscard]] auto radians(std::string_view text) -> Units::Radians_f {
+    return Units::Degrees_f{parse_number<float>(text)}.as<Units::Radian>();
+}
+
+[[nodiscard]] auto parse_perspective(std::string_view text) -> Matrix4x4f {
+    const auto values = parse_floats(text);
+    if (values.size() != 4) {
+        throw std::invalid_argument(std::format(
+            "Expected FOV_DEGREES,ASPECT_RATIO,NEAR,FAR, not '{}'", text
+        ));
+    }
+    return Maths::Transform::left_handed_perspective_projection_matrix(
+        Maths::Transform::PerspectiveMatrixParams<float>{
+            .fov = Units::Degrees_f{values[0]},
+            .aspect_ratio = values[1],
+            .near_plane = values[2],
+            .far_plane = values[3],
+        }
+    );
+}
+
+}  // namespace
+
+auto parse_options(std::span<const char* const> arguments)
+    -> Options {
+    namespace Transform = Maths::Transform;
+
+    auto options = Options{};
+    auto paths = std::vector<std::filesystem::path>{};
+
+    for (size_t i = 1; i < arguments.size(); ++i) {
+        const auto argument = std::string_view{arguments[i]};
+
+        if (argument == "--help") {
+            options.help = true;
+            return options;
+        }
+
+        if (!argument.starts_with("--")) {
+            paths.emplace_back(argument);
+            continue;
+        }
+
+        if (i + 1 == arguments.size()) {
+            throw std::invalid_argument(
+                std::format("Missing value after {}", argument)
+            );
+        }
+        const auto value = std::string_view{arguments[++i]};
+
+        // Row vectors are transformed as v * M, so every new transformation
+        // multiplies the chain on the right.
+        auto& matrix = options.matrix;
+        if (argument == "--translate") {
+            matrix *= Transform::translate_4x4(parse_vector(value));
+        } else if (argument == "--rotate-x") {
+            matrix *= Transform::rotate_x<float, 4>(radians(value));
+        } else if (argument == "--rotate-y") {
+            matrix *= Transform::rotate_y<float, 4>(radians(value));
+        } else if (argument == "--rotate-z") {
+            matrix *= Transform::rotate_z<float, 4>(radians(value));
+        } else if (argument == "--scale") {
+            if (value.find(',') == std::string_view::npos) {
+                const auto scale = parse_number<float>(value);
+                matrix *= Transform::scale_4x4(Vector3f{scale, scale, scale});
+            } else {
+                matrix *= Transform::scale_4x4(parse_vector(value));
+            }
+        } else if (argument == "--perspective") {
+            matrix *= parse_perspective(value);
+        } else if (argument == "--chunk-size") {
+            options.chunk_size = parse_number<size_t>(value);
+            if (options.chunk_size == 0) {
+                throw std::invalid_argument("The chunk size must not be 0");
+            }
+        } else {
+            throw std::invalid_argument(
+                std::format("Unknown option {}", argument)
+            );
+        }
+    }
+
+    if (paths.size() != 2) {
+        throw std::invalid_argument("Expected an input and an output file");
+    }
+    options.input = std::move(paths[0]);
+    options.output = std::move(paths[1]);
+
+    return options;
+}
+
+namespace {
+
+[[nodiscard]] auto is_csv(const std::filesystem::path& path) -> bool {
+    return path.extension() == ".csv";
+}
+
+/**
+ * \brief Reads the points of an array file, mapped into memory.
+ */
+class ArrayFileReader {
+public:
+    explicit ArrayFileReader(const std::filesystem::path& path) : file{path} {}
+
+    /// Copying the chunk out of the mapping reads its pages on this thread.
+    [[nodiscard]] auto read(Chunk& chunk) -> bool {
+        const auto remaining = this->file.elements().subspan(this->position);
+        if (remaining.empty()) {
+            return false;
+        }
+
+        const auto points = remaining.first(
+            std::min(remaining.size(), chunk.points.size())
+        );
+        std::copy(points.begin(), points.end(), chunk.points.begin());
+        chunk.size = points.size();
+        this->position += points.size();
+        return true;
+    }
+
+private:
+    Maths::MappedArrayFile<Vector3f> file;
+    size_t position = 0;
+};
+
+/**
+ * \brief Reads the points of a CSV file, one `x,y,z` point per line.
+ */
+class CsvReader {
+public:
+    explicit CsvReader(const std::filesystem::path& path)
+        : stream{path, std::ios::binary} {
+        if (!this->stream) {
+            throw std::runtime_error(
+                std::format("Cannot open {}", path.string())
+            );
+        }
+    }
+
+    [[nodiscard]] auto read(Chunk& chunk) -> bool {
+        chunk.size = 0;
+        while (chunk.size < chunk.points.size() &&
+               std::getline(this->stream, this->line)) {
+            ++this->line_number;
+
+            auto text = std::string_view{this->line};
+            if (text.ends_with('\r')) {
+                text.remove_suffix(1);
+            }
+            if (text.empty()) {
+                continue;
+            }
+
+            try {
+                chunk.points[chunk.size] = parse_vector(text);
+            } catch (const std::invalid_argument& error) {
+                throw std::runtime_error(
+                    std::format("Line {}: {}", this->line_number, error.what())
+                );
+            }
+            ++chunk.size;
+        }
+
+        if (this->stream.bad()) {
+            throw std::runtime_error("Cannot read the input file");
+        }
+        return chunk.size > 0;
+    }
+
+private:
+    std::ifstream stream;
+    std::string line;
+    size_t line_number = 0;
+};
+
+/**
+ * \brief Writes the points to an array file.
+ */
+class ArrayFileWriter {
+public:
+    explicit ArrayFileWriter(const std::filesystem::path& path)
+        : writer{path} {}
+
+    auto write(const Chunk& chunk) -> void { this->writer.write(chunk.used()); }
+
+    auto close() -> void { this->writer.close(); }
+
+private:
+    Maths::ArrayFileWriter<Vector3f> writer;
+};
+
+/**
+ * \brief Writes the points to a CSV file, with the shortest text reading back
+ * as the same floats.
+ */
+class CsvWriter {
+public:
+    explicit CsvWriter(const std::filesystem::path& path)
+        : stream{path, std::ios::binary} {
+        if (!this->stream) {
+            throw std::runtime_error(
+                std::format("Cannot create {}", path.string())
+            );
+        }
+    }
+
+    auto write(const Chunk& chunk) -> void {
+        // 16 characters cover the shortest form of any float.
+        constexpr auto max_point_length = size_t{3 * 16 + 3};
+
+        this->text.resize(chunk.size * max_point_length);
+        auto* out = this->text.data();
+        auto* const end = out + this->text.size();
+
+        for (const auto& point : chunk.used()) {
+            for (size_t i = 0; i < 3; ++i) {
+                out = std::to_chars(out, end, point[i]).ptr;
+                *out++ = i < 2 ? ',' : '\n';
+            }
+        }
+
+        const auto length = out - this->text.data();
+        this->stream.write(
+            this->text.data(), static_cast<std::streamsize>(length)
+        );
+        if (!this->stream) {
+            throw std::runtime_error("Cannot write the output file");
+        }
+    }
+
+    auto close() -> void {
+        this->stream.close();
+        if (!this->stream) {
+            throw std::runtime_error("Cannot write the output file");
+        }
+    }
+
+private:
+    std::ofstream stream;
+    std::string text;
+};
+
+using Reader = std::variant<ArrayFileReader, CsvReader>;
+using Writer = std::variant<ArrayFileWriter, CsvWriter>;
+
+[[nodiscard]] auto make_reader(const std::filesystem::path& path) -> Reader {
+    if (is_csv(path)) {
+        return Reader{std::in_place_type<CsvReader>, path};
+    }
+    return Reader{std::in_place_type<ArrayFileReader>, path};
+}
+
+[[nodiscard]] auto make_writer(const std::filesystem::path& path) -> Writer {
+    if (is_csv(path)) {
+        return Writer{std::in_place_type<CsvWriter>, path};
+    }
+    return Writer{std::in_place_type<ArrayFileWriter>, path};
+}
+
+}  // namespace
+
+auto is_affine(const Matrix4x4f& matrix) -> bool {
+    return matrix[0][3] == 0.0F && matrix[1][3] == 0.0F &&
+           matrix[2][3] == 0.0F && matrix[3][3] == 1.0F;
+}
+
+auto transform_chunk(const Matrix4x4f& matrix, bool affine, Chunk& chunk)
+    -> void {
+    namespace Transform = Maths::Transform;
+
+    const auto points = chunk.used();
+    if (affine) {
+        Transform::transform_points(
+            matrix, std::span<const Vector3f>{points}, points
+        );
+        return;
+    }
+
+    const auto homogeneous = std::span{chunk.homogeneous}.first(points.size());
+    for (size_t i = 0; i < points.size(); ++i) {
+        homogeneous[i] = {points[i].x(), points[i].y(), points[i].z(), 1.0F};
+    }
+
+    Transform::transform_vectors(
+        matrix, std::span<const Vector4f>{homogeneous}, homogeneous
+    );
+
+    for (size_t i = 0; i < points.size(); ++i) {
+        const auto& vector = homogeneous[i];
+        const auto inverse_w = 1.0F / vector.w();
+        points[i] = {
+            vector.x() * inverse_w,
+            vector.y() * inverse_w,
+            vector.z() * inverse_w,
+        };
+    }
+}
+
+auto run(const Options& options) -> uint64_t {
+    auto reader = make_reader(options.input);
+    auto writer = make_writer(options.output);
+
+    const auto affine = is_affine(options.matrix);
+
+    auto chunks = std::vector<Chunk>(chunk_count);
+    for (auto& chunk : chunks) {
+        chunk.points.resize(options.chunk_size);
+        if (!affine) {
+            chunk.homogeneous.resize(options.chunk_size);
+        }
+    }
+
+    auto point_count = uint64_t{0};
+
+    Demo::run_pipeline(
+        chunks,
+        [&](Chunk& chunk) {
+            return std::visit(
+                [&](auto& input) { return input.read(chunk); }, reader
+            );
+        },
+        [&](Chunk& chunk) {
+            transform_chunk(options.matrix, affine, chunk);
+        },
+        [&](const Chunk& chunk) {
+            std::visit([&](auto& output) { output.write(chunk); }, writer);
+            point_count += chunk.size;
+        }
+    );
+
+    std::visit([](auto& output) { output.close(); }, writer);
+
+    return point_count;
+}
+
+}  // namespace Luminol::Demo::TransformTool
@@ -0,0 +1,108 @@
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <span>
+#include <string_view>
+#include <vector>
+
+#include <LuminolMaths/Matrix.hpp>
+#include <LuminolMaths/Vector.hpp>
+
+/**
+ * luminol-transform, applies a chain of transformations to a file of points.
+ *
+ * The points are read from an array file of `Vector3f` (see `ArrayFile.hpp`)
+ * or from a CSV file of `x,y,z` lines, chosen by the `.csv` extension, and
+ * written in the same way. They are streamed in chunks through
+ * `run_pipeline`, so files of any size are processed in constant memory.
+ */
+namespace Luminol::Demo::TransformTool {
+
+inline constexpr auto usage = std::string_view{
+    "Usage: luminol-transform [transformations] [options] <input> <output>\n"
+    "\n"
+    "Applies the transformations, in the given order, to every point of the\n"
+    "input file. Files ending in .csv hold one x,y,z point per line, other\n"
+    "files are LuminolMaths array files of Vector3f.\n"
+    "\n"
+    "Transformations:\n"
+    "  --translate X,Y,Z\n"
+    "  --rotate-x DEGREES\n"
+    "  --rotate-y DEGREES\n"
+    "  --rotate-z DEGREES\n"
+    "  --scale S | X,Y,Z\n"
+    "  --perspective FOV_DEGREES,ASPECT_RATIO,NEAR,FAR\n"
+    "\n"
+    "Options:\n"
+    "  --chunk-size POINTS  Points per chunk, 65536 by default.\n"
+    "  --help               Prints this message.\n"
+};
+
+constexpr auto default_chunk_size = size_t{65536};
+
+/// One chunk is read and one written while the third is transformed.
+constexpr auto chunk_count = size_t{3};
+
+struct Options {
+    Maths::Matrix4x4f matrix = Maths::Matrix4x4f::identity();
+    size_t chunk_size = default_chunk_size;
+    std::filesystem::path input;
+    std::filesystem::path output;
+    bool help = false;
+};
+
+/**
+ * \brief Parses the command line, composing the transformations into a single
+ * matrix.
+ * \param arguments The command line, starting with the name of the program.
+ * \throw std::invalid_argument If the command line is invalid.
+ */
+[[nodiscard]] auto parse_options(std::span<const char* const> arguments)
+    -> Options;
+
+/**
+ * \brief The points of a chunk, `size` of which are in use.
+ */
+struct Chunk {
+    std::vector<Maths::Vector3f> points;
+
+    /// Scratch space for projective transformations.
+    std::vector<Maths::Vector4f> homogeneous;
+
+    size_t size = 0;
+
+    [[nodiscard]] auto used() -> std::span<Maths::Vector3f> {
+        return std::span{this->points}.first(this->size);
+    }
+
+    [[nodiscard]] auto used() const -> std::span<const Maths::Vector3f> {
+        return std::span{this->points}.first(this->size);
+    }
+};
+
+/**
+ * \brief Returns whether the matrix leaves w at 1, so points need no
+ * perspective division.
+ */
+[[nodiscard]] auto is_affine(const Maths::Matrix4x4f& matrix) -> bool;
+
+/**
+ * \brief Transforms the points of the chunk in place, dividing them by w when
+ * the matrix is projective.
+ * \pre `chunk.homogeneous` holds at least `chunk.size` vectors when the
+ * matrix is not affine.
+ */
+auto transform_chunk(
+    const Maths::Matrix4x4f& matrix, bool affine, Chunk& chunk
+) -> void;
+
+/**
+ * \brief Streams the input file through the transformation into the output
+ * file.
+ * \return The number of points.
+ * \throw std::runtime_error If a file cannot be read or written.
+ */
+[[nodiscard]] auto run(const Options& options) -> uint64_t;
+
+}  // namespace Luminol::Demo::TransformTool
@@ -0,0 +1,54 @@
+#include <chrono>
+#include <exception>
+#include <format>
+#include <iostream>
+#include <span>
+#include <stdexcept>
+
+#include <Demo/TransformTool.hpp>
+#include <LuminolMaths/Vector.hpp>
+
+/**
+ * The entry point of luminol-transform, reporting the throughput of the whole
+ * pipeline at the end. See `TransformTool.hpp`.
+ */
+namespace TransformTool = Luminol::Demo::TransformTool;
+
+auto main(int argc, char** argv) -> int {
+    try {
+        const auto options = TransformTool::parse_options(
+            std::span<const char* const>{argv, argv + argc}
+        );
+        if (options.help) {
+            std::cout << TransformTool::usage;
+            return 0;
+        }
+
+        const auto start = std::chrono::steady_clock::now();
+        const auto point_count = TransformTool::run(options);
+        const auto elapsed = std::chrono::steady_clock::now() - start;
+        const auto seconds = std::chrono::duration<double>(elapsed).count();
+
+        // Throughput counts the point data, 12 bytes per point, whatever the
+        // file formats.
+        const auto bytes = point_count * sizeof(Luminol::Maths::Vector3f);
+        const auto gigabytes = static_cast<double>(bytes) * 1e-9;
+
+        std::cerr << std::format(
+            "Transformed {} points in {:.3f} s, {:.1f} M points/s, {:.2f} "
+            "GB/s\n",
+            point_count,
+            seconds,
+            static_cast<double>(point_count) * 1e-6 / seconds,
+            gigabytes / seconds
+        );
+    } catch (const std::invalid_argument& error) {
+        std::cerr << error.what() << "\n\n" << TransformTool::usage;
+        return 2;
+    } catch (const std::exception& error) {
+        std::cerr << error.what() << '\n';
+        return 1;
+    }
+
+    return 0;
+}
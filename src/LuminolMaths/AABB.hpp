@@ -0,0 +1,421 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+#include <LuminolMaths/BitMask.hpp>
+#include <LuminolMaths/Matrix.hpp>
+#include <LuminolMaths/Vector.hpp>
+
+namespace Luminol::Maths {
+
+namespace Detail {
+
+/**
+ * \brief The first three columns of an affine matrix and their absolute
+ * values, read once so loops over many boxes do not reload the matrix.
+ */
+template <typename T>
+struct BoxTransform {
+    std::array<std::array<T, 4>, 3> columns{};
+    std::array<std::array<T, 3>, 3> magnitudes{};
+
+    constexpr explicit BoxTransform(const Matrix<T, 4, 4>& matrix) {
+        const auto magnitude = [](T value) {
+            return value < T{0} ? -value : value;
+        };
+
+        for (size_t j = 0; j < 3; ++j) {
+            this->columns[j] = {
+                matrix[0][j], matrix[1][j], matrix[2][j], matrix[3][j]
+            };
+            this->magnitudes[j] = {
+                magnitude(matrix[0][j]),
+                magnitude(matrix[1][j]),
+                magnitude(matrix[2][j]),
+            };
+        }
+    }
+
+    /**
+     * \brief Returns the corners of the box from `min` to `max` transformed
+     * by Arvo's method.
+     */
+    [[nodiscard]] constexpr auto apply(
+        const Vector<T, 3>& min, const Vector<T, 3>& max
+    ) const -> std::array<Vector<T, 3>, 2> {
+        const auto center = std::array{
+            (min.x() + max.x()) * T{0.5},
+            (min.y() + max.y()) * T{0.5},
+            (min.z() + max.z()) * T{0.5},
+        };
+        const auto extent = std::array{
+            (max.x() - min.x()) * T{0.5},
+            (max.y() - min.y()) * T{0.5},
+            (max.z() - min.z()) * T{0.5},
+        };
+
+        auto new_min = std::array<T, 3>{};
+        auto new_max = std::array<T, 3>{};
+
+        // NOLINTBEGIN(cppcoreguidelines-pro-bounds-constant-array-index)
+        for (size_t j = 0; j < 3; ++j) {
+            const auto& column = this->columns[j];
+            const auto& weights = this->magnitudes[j];
+
+            const auto new_center = center[0] * column[0] +
+                                    center[1] * column[1] +
+                                    center[2] * column[2] + column[3];
+            const auto new_extent = extent[0] * weights[0] +
+                                    extent[1] * weights[1] +
+                                    extent[2] * weights[2];
+
+            new_min[j] = new_center - new_extent;
+            new_max[j] = new_center + new_extent;
+        }
+        // NOLINTEND(cppcoreguidelines-pro-bounds-constant-array-index)
+
+        return {
+            Vector<T, 3>{new_min[0], new_min[1], new_min[2]},
+            Vector<T, 3>{new_max[0], new_max[1], new_max[2]},
+        };
+    }
+};
+
+}  // namespace Detail
+
+/**
+ * \brief An axis-aligned bounding box, stored as its two extreme corners.
+ *
+ * A default constructed box is empty: its minimum is +infinity and its
+ * maximum -infinity, so it contains and overlaps nothing and merging it with
+ * another box returns that box. A box holding a single point has the same
+ * minimum and maximum.
+ *
+ * \tparam T The underlying type of the coordinates.
+ */
+template <std::floating_point T>
+class AABB {
+public:
+    /**
+     * \brief Constructs the empty box.
+     */
+    [[nodiscard]] constexpr AABB()
+        : minimum{infinity, infinity, infinity},
+          maximum{-infinity, -infinity, -infinity} {}
+
+    /**
+     * \brief Constructs a box from its extreme corners.
+     * \param min The corner with the smallest coordinates.
+     * \param max The corner with the largest coordinates.
+     * \pre min <= max on every axis, otherwise the box is empty.
+     */
+    [[nodiscard]] constexpr AABB(
+        const Vector<T, 3>& min, const Vector<T, 3>& max
+    )
+        : minimum{min}, maximum{max} {}
+
+    /**
+     * \brief Returns the box centered on `center` that extends by `extent`
+     * on either side.
+     * \param center The center of the box.
+     * \param extent The half size of the box along each axis.
+     * \return The box from `center - extent` to `center + extent`.
+     */
+    [[nodiscard]] constexpr static auto from_center_extent(
+        const Vector<T, 3>& center, const Vector<T, 3>& extent
+    ) -> AABB {
+        return AABB{center - extent, center + extent};
+    }
+
+    /**
+     * \brief Returns the smallest box containing every point.
+     * \param points The points to enclose.
+     * \return The bounding box of the points, empty if there are none.
+     */
+    [[nodiscard]] constexpr static auto from_points(
+        std::span<const Vector<T, 3>> points
+    ) -> AABB {
+        auto result = AABB{};
+        for (const auto& point : points) {
+            result = result.merged(point);
+        }
+        return result;
+    }
+
+    [[nodiscard]] constexpr auto min() const -> const Vector<T, 3>& {
+        return this->minimum;
+    }
+
+    [[nodiscard]] constexpr auto max() const -> const Vector<T, 3>& {
+        return this->maximum;
+    }
+
+    /**
+     * \brief Returns whether the box contains no point at all.
+     * \return Whether the minimum exceeds the maximum on any axis.
+     */
+    [[nodiscard]] constexpr auto is_empty() const -> bool {
+        return this->minimum.x() > this->maximum.x() ||
+               this->minimum.y() > this->maximum.y() ||
+               this->minimum.z() > this->maximum.z();
+    }
+
+    /**
+     * \brief Returns the center of the box.
+     * \pre The box is not empty.
+     * \return The midpoint of the corners.
+     */
+    [[nodiscard]] constexpr auto center() const -> Vector<T, 3> {
+        return (this->minimum + this->maximum) * T{0.5};
+    }
+
+    /**
+     * \brief Returns the half size of the box along each axis.
+     * \pre The box is not empty.
+     * \return The distance from the center to the faces along each axis.
+     */
+    [[nodiscard]] constexpr auto extent() const -> Vector<T, 3> {
+        return (this->maximum - this->minimum) * T{0.5};
+    }
+
+    /**
+     * \brief Returns the total area of the six faces of the box.
+     * \return The surface area, 0 for the empty box.
+     */
+    [[nodiscard]] constexpr auto surface_area() const -> T {
+        if (this->is_empty()) {
+            return T{0};
+        }
+
+        const auto size = this->maximum - this->minimum;
+        return T{2} * (size.x() * size.y() + size.y() * size.z() +
+                       size.z() * size.x());
+    }
+
+    /**
+     * \brief Returns whether the point lies inside of the box or on its
+     * boundary.
+     * \param point The point to test.
+     * \return Whether the point is inside of the box.
+     */
+    [[nodiscard]] constexpr auto contains(const Vector<T, 3>& point) const
+        -> bool {
+        return this->minimum.x() <= point.x() &&
+               point.x() <= this->maximum.x() &&
+               this->minimum.y() <= point.y() &&
+               point.y() <= this->maximum.y() &&
+               this->minimum.z() <= point.z() &&
+               point.z() <= this->maximum.z();
+    }
+
+    /**
+     * \brief Returns whether the other box lies entirely inside of this one.
+     * \param other The box to test.
+     * \return Whether every point of `other` is inside of this box, always
+     * true if `other` is empty.
+     */
+    [[nodiscard]] constexpr auto contains(const AABB& other) const -> bool {
+        return other.is_empty() || (this->contains(other.minimum) &&
+                                    this->contains(other.maximum));
+    }
+
+    /**
+     * \brief Returns whether the two boxes share at least one point.
+     * \param other The box to test.
+     * \return Whether the boxes overlap, always false if either is empty.
+     */
+    [[nodiscard]] constexpr auto overlaps(const AABB& other) const -> bool {
+        return this->minimum.x() <= other.maximum.x() &&
+               other.minimum.x() <= this->maximum.x() &&
+               this->minimum.y() <= other.maximum.y() &&
+               other.minimum.y() <= this->maximum.y() &&
+               this->minimum.z() <= other.maximum.z() &&
+               other.minimum.z() <= this->maximum.z();
+    }
+
+    /**
+     * \brief Returns the smallest box containing both boxes.
+     * \param other The box to merge with.
+     * \return The union of the boxes.
+     */
+    [[nodiscard]] constexpr auto merged(const AABB& other) const -> AABB {
+        return AABB{
+            {
+                std::min(this->minimum.x(), other.minimum.x()),
+                std::min(this->minimum.y(), other.minimum.y()),
+                std::min(this->minimum.z(), other.minimum.z()),
+            },
+            {
+                std::max(this->maximum.x(), other.maximum.x()),
+                std::max(this->maximum.y(), other.maximum.y()),
+                std::max(this->maximum.z(), other.maximum.z()),
+            },
+        };
+    }
+
+    /**
+     * \brief Returns the smallest box containing this box and the point.
+     * \param point The point to merge with.
+     * \return The box grown to include the point.
+     */
+    [[nodiscard]] constexpr auto merged(const Vector<T, 3>& point) const
+        -> AABB {
+        return this->merged(AABB{point, point});
+    }
+
+    /**
+     * \brief Returns the smallest box containing this box transformed by an
+     * affine matrix.
+     *
+     * Uses Arvo's method on the center and extent: the center is transformed
+     * as a point and each axis of the new extent sums the old extents
+     * weighted by the absolute values of a column of the matrix, instead of
+     * transforming and merging the eight corners.
+     *
+     * \param matrix The affine transformation matrix, in the row vector
+     * convention of `Transform`.
+     * \return The transformed bounding box, empty if this box is empty.
+     */
+    [[nodiscard]] constexpr auto transformed(
+        const Matrix<T, 4, 4>& matrix
+    ) const -> AABB {
+        if (this->is_empty()) {
+            return AABB{};
+        }
+
+        const auto [min, max] =
+            Detail::BoxTransform<T>{matrix}.apply(this->minimum, this->maximum);
+        return AABB{min, max};
+    }
+
+    [[nodiscard]] constexpr auto operator==(const AABB& other) const -> bool {
+        return this->minimum == other.minimum &&
+               this->maximum == other.maximum;
+    }
+
+private:
+    constexpr static auto infinity = std::numeric_limits<T>::infinity();
+
+    Vector<T, 3> minimum;
+    Vector<T, 3> maximum;
+};
+
+namespace Detail {
+
+inline auto check_mask_size(size_t count, size_t words) -> void {
+    if (words != BitMask::word_count(count)) {
+        throw std::invalid_argument("Batch sizes do not match");
+    }
+}
+
+}  // namespace Detail
+
+/**
+ * \brief Transforms every box by the same affine matrix.
+ * \param matrix The affine transformation matrix.
+ * \param boxes The boxes to transform.
+ * \param out The destination of the transformed boxes, may alias `boxes`.
+ * \pre boxes.size() == out.size()
+ * \throw std::invalid_argument If the sizes do not match.
+ */
+template <std::floating_point T>
+constexpr auto transform(
+    const Matrix<T, 4, 4>& matrix,
+    std::type_identity_t<std::span<const AABB<T>>> boxes,
+    std::type_identity_t<std::span<AABB<T>>> out
+) -> void {
+    if (boxes.size() != out.size()) {
+        throw std::invalid_argument("Input and output sizes do not match");
+    }
+
+    const auto box_transform = Detail::BoxTransform<T>{matrix};
+
+    for (size_t i = 0; i < boxes.size(); ++i) {
+        const auto& box = boxes[i];
+
+        // Empty boxes go through the arithmetic too and are replaced after,
+        // which keeps the loop free of branches.
+        const auto [min, max] = box_transform.apply(box.min(), box.max());
+        out[i] = box.is_empty() ? AABB<T>{} : AABB<T>{min, max};
+    }
+}
+
+/**
+ * \brief Returns the smallest box containing every box.
+ * \param boxes The boxes to merge.
+ * \return The union of the boxes, empty if there are none.
+ */
+template <std::floating_point T>
+[[nodiscard]] constexpr auto merge(
+    std::span<const AABB<T>> boxes
+) -> AABB<T> {
+    auto result = AABB<T>{};
+    for (const auto& box : boxes) {
+        result = result.merged(box);
+    }
+    return result;
+}
+
+/**
+ * \brief Returns the merge of every box of a vector.
+ * \see merge(std::span<const AABB<T>>)
+ */
+template <std::floating_point T, typename Allocator>
+[[nodiscard]] constexpr auto merge(const std::vector<AABB<T>, Allocator>& boxes)
+    -> AABB<T> {
+    return merge(std::span<const AABB<T>>{boxes});
+}
+
+/**
+ * \brief Tests which points lie inside of the box and writes one bit per
+ * point, laid out as described in `BitMask`.
+ * \param box The box to test against.
+ * \param points The points to test.
+ * \param inside The destination of the bits.
+ * \pre inside.size() == BitMask::word_count(points.size())
+ * \throw std::invalid_argument If the sizes do not match.
+ */
+template <std::floating_point T>
+auto contains(
+    const AABB<T>& box,
+    std::type_identity_t<std::span<const Vector<T, 3>>> points,
+    std::span<uint64_t> inside
+) -> void {
+    Detail::check_mask_size(points.size(), inside.size());
+
+    BitMask::assign(inside, points.size(), [&](size_t i) {
+        return box.contains(points[i]);
+    });
+}
+
+/**
+ * \brief Tests which boxes overlap the box and writes one bit per box, laid
+ * out as described in `BitMask`.
+ * \param box The box to test against.
+ * \param boxes The boxes to test.
+ * \param overlapping The destination of the bits.
+ * \pre overlapping.size() == BitMask::word_count(boxes.size())
+ * \throw std::invalid_argument If the sizes do not match.
+ */
+template <std::floating_point T>
+auto overlaps(
+    const AABB<T>& box,
+    std::type_identity_t<std::span<const AABB<T>>> boxes,
+    std::span<uint64_t> overlapping
+) -> void {
+    Detail::check_mask_size(boxes.size(), overlapping.size());
+
+    BitMask::assign(overlapping, boxes.size(), [&](size_t i) {
+        return box.overlaps(boxes[i]);
+    });
+}
+
+}  // namespace Luminol::Maths
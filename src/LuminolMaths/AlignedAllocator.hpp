@@ -0,0 +1,72 @@
+#pragma once
+
+#include <cstddef>
+#include <limits>
+#include <new>
+
+namespace Luminol::Maths {
+
+/**
+ * \brief A standard allocator that aligns every allocation to the given
+ * alignment, so the start of each buffer can be loaded with aligned SIMD loads
+ * and does not share a cache line with unrelated data.
+ *
+ * \tparam T The type of the elements to allocate.
+ * \tparam Alignment The alignment in bytes, defaults to a cache line.
+ */
+template <typename T, size_t Alignment = 64>
+    requires(Alignment >= alignof(T) && (Alignment & (Alignment - 1)) == 0)
+class AlignedAllocator {
+public:
+    using value_type = T;
+
+    template <typename OtherT>
+    struct rebind {
+        using other = AlignedAllocator<OtherT, Alignment>;
+    };
+
+    constexpr static auto alignment = Alignment;
+
+    constexpr AlignedAllocator() noexcept = default;
+
+    template <typename OtherT>
+    constexpr AlignedAllocator(const AlignedAllocator<OtherT, Alignment>&
+    ) noexcept {}
+
+    /**
+     * \brief Allocates uninitialized storage for `count` elements.
+     * \param count The number of elements to allocate storage for.
+     * \throw std::bad_array_new_length If the size in bytes overflows.
+     * \throw std::bad_alloc If the allocation fails.
+     * \return A pointer to the storage, aligned to `Alignment`.
+     */
+    [[nodiscard]] auto allocate(size_t count) -> T* {
+        if (count > std::numeric_limits<size_t>::max() / sizeof(T)) {
+            throw std::bad_array_new_length{};
+        }
+
+        return static_cast<T*>(
+            ::operator new(count * sizeof(T), std::align_val_t{Alignment})
+        );
+    }
+
+    /**
+     * \brief Deallocates storage previously returned by `allocate`.
+     * \param pointer The pointer returned by `allocate`.
+     * \param count The number of elements passed to `allocate`.
+     */
+    auto deallocate(T* pointer, size_t count) noexcept -> void {
+        ::operator delete(
+            pointer, count * sizeof(T), std::align_val_t{Alignment}
+        );
+    }
+
+    template <typename OtherT>
+    [[nodiscard]] constexpr auto operator==(
+        const AlignedAllocator<OtherT, Alignment>& /*other*/
+    ) const noexcept -> bool {
+        return true;
+    }
+};
+
+}  // namespace Luminol::Maths
@@ -0,0 +1,254 @@
+#include <LuminolMaths/ArrayFile.hpp>
+
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace Luminol::Maths::Detail {
+
+namespace {
+
+[[noreturn]] auto fail(
+    const std::string& message, const std::filesystem::path& path
+) -> void {
+    throw std::runtime_error(message + ": " + path.string());
+}
+
+}  // namespace
+
+MappedFile::MappedFile(const std::filesystem::path& path) {
+#ifdef _WIN32
+    auto* file = CreateFileW(
+        path.c_str(),
+        GENERIC_READ,
+        FILE_SHARE_READ,
+        nullptr,
+        OPEN_EXISTING,
+        FILE_ATTRIBUTE_NORMAL,
+        nullptr
+    );
+    if (file == INVALID_HANDLE_VALUE) {
+        fail("Cannot open file", path);
+    }
+    this->file = file;
+
+    auto size = LARGE_INTEGER{};
+    if (GetFileSizeEx(file, &size) == 0) {
+        this->unmap();
+        fail("Cannot read the size of file", path);
+    }
+    this->size = static_cast<size_t>(size.QuadPart);
+
+    // Empty files cannot be mapped, and have no contents to map anyway.
+    if (this->size == 0) {
+        return;
+    }
+
+    this->mapping =
+        CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (this->mapping == nullptr) {
+        this->unmap();
+        fail("Cannot map file", path);
+    }
+
+    const auto* view = MapViewOfFile(this->mapping, FILE_MAP_READ, 0, 0, 0);
+    if (view == nullptr) {
+        this->unmap();
+        fail("Cannot map file", path);
+    }
+    this->data = static_cast<const std::byte*>(view);
+#else
+    const auto descriptor = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (descriptor < 0) {
+        fail("Cannot open file", path);
+    }
+
+    struct stat status = {};
+    if (::fstat(descriptor, &status) != 0) {
+        ::close(descriptor);
+        fail("Cannot read the size of file", path);
+    }
+    this->size = static_cast<size_t>(status.st_size);
+
+    // Empty files cannot be mapped, and have no contents to map anyway.
+    if (this->size == 0) {
+        ::close(descriptor);
+        return;
+    }
+
+    auto* view =
+        ::mmap(nullptr, this->size, PROT_READ, MAP_PRIVATE, descriptor, 0);
+
+    // The mapping keeps its own reference to the file.
+    ::close(descriptor);
+
+    if (view == MAP_FAILED) {
+        this->size = 0;
+        fail("Cannot map file", path);
+    }
+    this->data = static_cast<const std::byte*>(view);
+#endif
+}
+
+MappedFile::MappedFile(MappedFile&& other) noexcept
+    : data{std::exchange(other.data, nullptr)},
+      size{std::exchange(other.size, 0)},
+      file{std::exchange(other.file, nullptr)},
+      mapping{std::exchange(other.mapping, nullptr)} {}
+
+MappedFile::~MappedFile() { this->unmap(); }
+
+auto MappedFile::operator=(MappedFile&& other) noexcept -> MappedFile& {
+    if (this != &other) {
+        this->unmap();
+        this->data = std::exchange(other.data, nullptr);
+        this->size = std::exchange(other.size, 0);
+        this->file = std::exchange(other.file, nullptr);
+        this->mapping = std::exchange(other.mapping, nullptr);
+    }
+    return *this;
+}
+
+auto MappedFile::unmap() noexcept -> void {
+#ifdef _WIN32
+    if (this->data != nullptr) {
+        UnmapViewOfFile(this->data);
+    }
+    if (this->mapping != nullptr) {
+        CloseHandle(this->mapping);
+    }
+    if (this->file != nullptr) {
+        CloseHandle(this->file);
+    }
+#else
+    if (this->data != nullptr) {
+        // NOLINTBEGIN(cppcoreguidelines-pro-type-const-cast)
+        ::munmap(const_cast<std::byte*>(this->data), this->size);
+        // NOLINTEND(cppcoreguidelines-pro-type-const-cast)
+    }
+#endif
+
+    this->data = nullptr;
+    this->size = 0;
+    this->file = nullptr;
+    this->mapping = nullptr;
+}
+
+auto validate_array_file(
+    std::span<const std::byte> bytes,
+    const ArrayFileHeader& expected,
+    size_t element_size
+) -> ArrayFileHeader {
+    auto header = ArrayFileHeader{};
+    if (bytes.size() < sizeof(header)) {
+        throw std::runtime_error("Not an array file");
+    }
+    std::memcpy(&header, bytes.data(), sizeof(header));
+
+    if (header.magic != ArrayFileHeader::file_magic) {
+        throw std::runtime_error("Not an array file");
+    }
+    if (header.byte_order != ArrayFileHeader::native_byte_order) {
+        throw std::runtime_error("Array file has a different byte order");
+    }
+    if (header.version == 0 ||
+        header.version > ArrayFileHeader::current_version) {
+        throw std::runtime_error("Unsupported array file version");
+    }
+    if (header.scalar_type != expected.scalar_type ||
+        header.kind != expected.kind || header.rows != expected.rows ||
+        header.columns != expected.columns) {
+        throw std::runtime_error("Array file has a different element type");
+    }
+
+    // The offset must keep the elements aligned, and the file must hold all of
+    // them, without overflowing on a corrupt count.
+    const auto available = uint64_t{bytes.size()};
+    if (header.data_offset < sizeof(header) ||
+        header.data_offset % alignof(std::max_align_t) != 0 ||
+        header.data_offset > available ||
+        header.count > (available - header.data_offset) / element_size) {
+        throw std::runtime_error("Array file is truncated or corrupt");
+    }
+
+    return header;
+}
+
+ArrayFileOutput::ArrayFileOutput(
+    const std::filesystem::path& path, const ArrayFileHeader& header
+)
+    : stream{path, std::ios::binary | std::ios::trunc}, header{header} {
+    if (!this->stream) {
+        fail("Cannot create file", path);
+    }
+
+    // The count stays 0 until the file is closed, so a file whose writer never
+    // finished reads as empty rather than as garbage.
+    this->header.count = 0;
+    this->stream.write(
+        reinterpret_cast<const char*>(&this->header), sizeof(this->header)
+    );
+
+    const auto padding = this->header.data_offset - sizeof(this->header);
+    for (uint64_t i = 0; i < padding; ++i) {
+        this->stream.put('\0');
+    }
+
+    if (!this->stream) {
+        fail("Cannot write file", path);
+    }
+}
+
+auto ArrayFileOutput::write(std::span<const std::byte> bytes, uint64_t count)
+    -> void {
+    if (!this->stream.is_open()) {
+        throw std::runtime_error("Array file is closed");
+    }
+
+    this->stream.write(
+        reinterpret_cast<const char*>(bytes.data()),
+        static_cast<std::streamsize>(bytes.size())
+    );
+    if (!this->stream) {
+        throw std::runtime_error("Cannot write array file");
+    }
+
+    this->count += count;
+}
+
+auto ArrayFileOutput::close() -> void {
+    if (!this->stream.is_open()) {
+        return;
+    }
+
+    this->header.count = this->count;
+    this->stream.seekp(0);
+    this->stream.write(
+        reinterpret_cast<const char*>(&this->header), sizeof(this->header)
+    );
+
+    const auto written = static_cast<bool>(this->stream);
+    this->stream.close();
+
+    if (!written || !this->stream) {
+        throw std::runtime_error("Cannot write array file");
+    }
+}
+
+}  // namespace Luminol::Maths::Detail
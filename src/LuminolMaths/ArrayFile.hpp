@@ -0,0 +1,378 @@
+#pragma once
+
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <span>
+#include <type_traits>
+
+#include <LuminolMaths/Matrix.hpp>
+#include <LuminolMaths/Vector.hpp>
+
+/**
+ * Binary files of vector and matrix arrays that load without a copy.
+ *
+ * An array file is a 64-byte `ArrayFileHeader` followed by the raw elements,
+ * exactly as they are laid out in memory. The header records the element type,
+ * the number of elements and the byte order of the machine that wrote the file.
+ * The elements start at a 64-byte aligned offset, so `MappedArrayFile` maps the
+ * file into memory and exposes it as a `std::span` of elements: opening a file
+ * costs the same whatever its size, and pages are only read when touched.
+ *
+ * `ArrayFileWriter` streams elements to a file, in as many calls as needed,
+ * and fills in the number of elements when it is closed.
+ */
+namespace Luminol::Maths {
+
+/// The scalar type of the elements of an array file.
+enum class ScalarType : uint8_t {
+    Float32 = 1,
+    Float64 = 2,
+};
+
+/// Whether the elements of an array file are vectors or matrices.
+enum class ElementKind : uint8_t {
+    Vector = 1,
+    Matrix = 2,
+};
+
+/**
+ * \brief The header at the start of every array file.
+ */
+struct ArrayFileHeader {
+    /// The magic bytes of every array file.
+    constexpr static auto file_magic =
+        std::array<char, 8>{'L', 'U', 'M', 'A', 'R', 'R', 'A', 'Y'};
+
+    /// The version written by this library, files of later versions are
+    /// rejected.
+    constexpr static auto current_version = uint16_t{1};
+
+    /// Written in the byte order of the writer, so a reader on a machine of
+    /// the other byte order reads 0x04030201.
+    constexpr static auto native_byte_order = uint32_t{0x01020304};
+
+    std::array<char, 8> magic = file_magic;
+    uint32_t byte_order = native_byte_order;
+    uint16_t version = current_version;
+    ScalarType scalar_type = ScalarType::Float32;
+    ElementKind kind = ElementKind::Vector;
+
+    /// The number of rows of the elements, the size of vectors.
+    uint32_t rows = 0;
+
+    /// The number of columns of the elements, 1 for vectors.
+    uint32_t columns = 0;
+
+    /// The number of elements in the file.
+    uint64_t count = 0;
+
+    /// The offset of the first element from the start of the file.
+    uint64_t data_offset = 64;
+
+    std::array<std::byte, 24> reserved = {};
+};
+
+static_assert(sizeof(ArrayFileHeader) == 64);
+static_assert(std::is_trivially_copyable_v<ArrayFileHeader>);
+
+/**
+ * \brief Describes how an element type is stored in an array file.
+ *
+ * The primary template is disabled, specializations exist for the float and
+ * double `Vector` and `Matrix` types.
+ */
+template <typename E>
+struct ArrayElement {
+    constexpr static auto supported = false;
+};
+
+namespace Detail {
+
+template <std::floating_point T>
+constexpr auto scalar_type_of =
+    sizeof(T) == 4 ? ScalarType::Float32 : ScalarType::Float64;
+
+}  // namespace Detail
+
+template <std::floating_point T, size_t N>
+    requires(sizeof(T) == 4 || sizeof(T) == 8)
+struct ArrayElement<Vector<T, N>> {
+    constexpr static auto supported = true;
+    constexpr static auto scalar_type = Detail::scalar_type_of<T>;
+    constexpr static auto kind = ElementKind::Vector;
+    constexpr static auto rows = uint32_t{N};
+    constexpr static auto columns = uint32_t{1};
+};
+
+template <std::floating_point T, size_t M, size_t N>
+    requires(sizeof(T) == 4 || sizeof(T) == 8)
+struct ArrayElement<Matrix<T, M, N>> {
+    constexpr static auto supported = true;
+    constexpr static auto scalar_type = Detail::scalar_type_of<T>;
+    constexpr static auto kind = ElementKind::Matrix;
+    constexpr static auto rows = uint32_t{M};
+    constexpr static auto columns = uint32_t{N};
+};
+
+/**
+ * \brief Whether `E` can be stored in an array file: a supported vector or
+ * matrix type without padding between its components.
+ */
+template <typename E>
+concept ArrayFileElement =
+    ArrayElement<E>::supported && std::is_trivially_copyable_v<E> &&
+    sizeof(E) == (ArrayElement<E>::scalar_type == ScalarType::Float32 ? 4 : 8) *
+                     ArrayElement<E>::rows * ArrayElement<E>::columns;
+
+namespace Detail {
+
+/**
+ * \brief Returns the header of an empty array file of `E`.
+ */
+template <ArrayFileElement E>
+[[nodiscard]] constexpr auto header_of() -> ArrayFileHeader {
+    auto header = ArrayFileHeader{};
+    header.scalar_type = ArrayElement<E>::scalar_type;
+    header.kind = ArrayElement<E>::kind;
+    header.rows = ArrayElement<E>::rows;
+    header.columns = ArrayElement<E>::columns;
+    return header;
+}
+
+/**
+ * \brief A read-only memory mapping of a whole file.
+ */
+class MappedFile {
+public:
+    /**
+     * \brief Maps the file at `path`.
+     * \throw std::runtime_error If the file cannot be opened or mapped.
+     */
+    explicit MappedFile(const std::filesystem::path& path);
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile(MappedFile&& other) noexcept;
+    ~MappedFile();
+
+    auto operator=(const MappedFile&) -> MappedFile& = delete;
+    auto operator=(MappedFile&& other) noexcept -> MappedFile&;
+
+    /**
+     * \brief Returns the contents of the file.
+     */
+    [[nodiscard]] auto bytes() const -> std::span<const std::byte> {
+        return {this->data, this->size};
+    }
+
+private:
+    auto unmap() noexcept -> void;
+
+    const std::byte* data = nullptr;
+    size_t size = 0;
+
+    /// The file and mapping handles on Windows, unused elsewhere.
+    void* file = nullptr;
+    void* mapping = nullptr;
+};
+
+/**
+ * \brief Checks that `bytes` start with a header matching `expected` and hold
+ * all of the elements it announces, and returns that header.
+ * \throw std::runtime_error If the file is not a valid array file of the
+ * expected element type.
+ */
+[[nodiscard]] auto validate_array_file(
+    std::span<const std::byte> bytes,
+    const ArrayFileHeader& expected,
+    size_t element_size
+) -> ArrayFileHeader;
+
+/**
+ * \brief Writes the header and raw elements of an array file, see
+ * `ArrayFileWriter`.
+ */
+class ArrayFileOutput {
+public:
+    /**
+     * \brief Creates or truncates the file at `path` and writes `header`.
+     * \throw std::runtime_error If the file cannot be written.
+     */
+    ArrayFileOutput(
+        const std::filesystem::path& path, const ArrayFileHeader& header
+    );
+
+    /**
+     * \brief Appends `count` elements whose raw bytes are `bytes`.
+     * \throw std::runtime_error If the file cannot be written.
+     */
+    auto write(std::span<const std::byte> bytes, uint64_t count) -> void;
+
+    /**
+     * \brief Writes the final number of elements into the header and closes
+     * the file. Does nothing if the file is already closed.
+     * \throw std::runtime_error If the file cannot be written.
+     */
+    auto close() -> void;
+
+    [[nodiscard]] auto is_open() const -> bool {
+        return this->stream.is_open();
+    }
+
+    [[nodiscard]] auto size() const -> uint64_t { return this->count; }
+
+private:
+    std::ofstream stream;
+    ArrayFileHeader header;
+    uint64_t count = 0;
+};
+
+}  // namespace Detail
+
+/**
+ * \brief A read-only array file mapped into memory, whose elements are used in
+ * place.
+ *
+ * \tparam E The type of the elements, which must match the file.
+ */
+template <ArrayFileElement E>
+class MappedArrayFile {
+public:
+    /**
+     * \brief Maps the array file at `path` and validates its header.
+     * \param path The path of the array file.
+     * \throw std::runtime_error If the file cannot be mapped, is not an array
+     * file, has a later version, the other byte order or another element type,
+     * or is shorter than its header announces.
+     */
+    explicit MappedArrayFile(const std::filesystem::path& path)
+        : file{path},
+          header{Detail::validate_array_file(
+              this->file.bytes(), Detail::header_of<E>(), sizeof(E)
+          )} {
+        const auto bytes = this->file.bytes();
+        this->view = {
+            reinterpret_cast<const E*>(bytes.data() + this->header.data_offset),
+            static_cast<size_t>(this->header.count),
+        };
+    }
+
+    /**
+     * \brief Returns the elements of the file, valid as long as this mapping.
+     */
+    [[nodiscard]] auto elements() const -> std::span<const E> {
+        return this->view;
+    }
+
+    /**
+     * \brief Returns the number of elements in the file.
+     */
+    [[nodiscard]] auto size() const -> size_t { return this->view.size(); }
+
+    /**
+     * \brief Returns whether the file has no elements.
+     */
+    [[nodiscard]] auto empty() const -> bool { return this->view.empty(); }
+
+    /**
+     * \brief Returns the header of the file.
+     */
+    [[nodiscard]] auto get_header() const -> const ArrayFileHeader& {
+        return this->header;
+    }
+
+private:
+    Detail::MappedFile file;
+    ArrayFileHeader header;
+    std::span<const E> view;
+};
+
+/**
+ * \brief Streams elements to an array file.
+ *
+ * The elements are appended as they are written, and the number of elements
+ * is written into the header by `close`, or by the destructor which ignores
+ * errors.
+ *
+ * \tparam E The type of the elements.
+ */
+template <ArrayFileElement E>
+class ArrayFileWriter {
+public:
+    /**
+     * \brief Creates or truncates the array file at `path`.
+     * \param path The path of the array file.
+     * \throw std::runtime_error If the file cannot be written.
+     */
+    explicit ArrayFileWriter(const std::filesystem::path& path)
+        : output{path, Detail::header_of<E>()} {}
+
+    ArrayFileWriter(const ArrayFileWriter&) = delete;
+    ArrayFileWriter(ArrayFileWriter&&) noexcept = default;
+
+    ~ArrayFileWriter() {
+        try {
+            this->output.close();
+        } catch (...) {
+            // Errors are only reported by an explicit call to close.
+        }
+    }
+
+    auto operator=(const ArrayFileWriter&) -> ArrayFileWriter& = delete;
+    auto operator=(ArrayFileWriter&&) noexcept -> ArrayFileWriter& = default;
+
+    /**
+     * \brief Appends an element to the file.
+     * \param element The element to append.
+     * \throw std::runtime_error If the file cannot be written or is closed.
+     */
+    auto write(const E& element) -> void {
+        this->write(std::span<const E>{&element, 1});
+    }
+
+    /**
+     * \brief Appends elements to the file.
+     * \param elements The elements to append.
+     * \throw std::runtime_error If the file cannot be written or is closed.
+     */
+    auto write(std::span<const E> elements) -> void {
+        this->output.write(std::as_bytes(elements), elements.size());
+    }
+
+    /**
+     * \brief Returns the number of elements written so far.
+     */
+    [[nodiscard]] auto size() const -> size_t {
+        return static_cast<size_t>(this->output.size());
+    }
+
+    /**
+     * \brief Writes the number of elements into the header and closes the
+     * file. Does nothing if the file is already closed.
+     * \throw std::runtime_error If the file cannot be written.
+     */
+    auto close() -> void { this->output.close(); }
+
+private:
+    Detail::ArrayFileOutput output;
+};
+
+/**
+ * \brief Writes `elements` to a new array file at `path`.
+ * \param path The path of the array file.
+ * \param elements The elements to write.
+ * \throw std::runtime_error If the file cannot be written.
+ */
+template <ArrayFileElement E>
+auto write_array_file(
+    const std::filesystem::path& path, std::span<const E> elements
+) -> void {
+    auto writer = ArrayFileWriter<E>{path};
+    writer.write(elements);
+    writer.close();
+}
+
+}  // namespace Luminol::Maths
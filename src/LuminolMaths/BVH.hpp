@@ -0,0 +1,1125 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
+#include <concepts>
+#include <cstdint>
+#include <functional>
+#include <future>
+#include <limits>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <LuminolMaths/AABB.hpp>
+#include <LuminolMaths/Simd.hpp>
+#include <LuminolMaths/Vector.hpp>
+
+namespace Luminol::Maths {
+
+/**
+ * \brief The parameters of the construction of a `BVH`.
+ */
+struct BVHOptions {
+    /// The largest number of primitives referenced by a leaf, from 1 to 65535.
+    size_t leaf_size = 4;
+
+    /// The number of threads building the tree, 0 for one per hardware thread.
+    size_t thread_count = 0;
+};
+
+namespace Detail {
+
+/**
+ * \brief The stack of a tree traversal, kept on the call stack unless the tree
+ * is deeper than usual.
+ */
+template <typename Entry>
+class TraversalStack {
+public:
+    auto push(const Entry& entry) -> void {
+        if (this->size < this->local.size()) {
+            this->local[this->size] = entry;
+        } else {
+            this->overflow.push_back(entry);
+        }
+        ++this->size;
+    }
+
+    [[nodiscard]] auto pop() -> Entry {
+        --this->size;
+        if (this->size < this->local.size()) {
+            return this->local[this->size];
+        }
+
+        const auto entry = this->overflow.back();
+        this->overflow.pop_back();
+        return entry;
+    }
+
+    [[nodiscard]] auto empty() const -> bool { return this->size == 0; }
+
+private:
+    std::array<Entry, 64> local{};
+    std::vector<Entry> overflow;
+    size_t size = 0;
+};
+
+}  // namespace Detail
+
+/**
+ * \brief A bounding volume hierarchy over axis-aligned boxes, answering box,
+ * ray and nearest neighbour queries in logarithmic time on average.
+ *
+ * The tree is built top-down with the binned surface area heuristic. Each node
+ * has up to four children whose boxes are stored as structure-of-arrays lanes,
+ * so traversal tests the four children at once, with SSE when it is enabled
+ * for floats. The nodes are laid out depth-first in a single array aligned to
+ * cache lines, parents before their children.
+ *
+ * A node spans two cache lines for floats, 128 bytes, and four for doubles,
+ * 256 bytes, rather than one. The 24 full precision child bounds alone take
+ * 96 bytes for floats, and fitting a node in 64 bytes would mean quantizing
+ * them to 8 or 16 bits relative to the parent box. That costs a dequantize
+ * per child test and widens every box by the rounding, which lets more
+ * subtrees through, while the second line of a node is adjacent to the first
+ * and usually brought in by the same prefetch.
+ *
+ * Large subtrees are built on separate threads, and the binning of the
+ * largest nodes is split across threads as well, so the build scales with the
+ * number of cores on scenes of millions of primitives.
+ *
+ * Primitives are identified by their index in the span of boxes the tree was
+ * built from. When they move, `refit` updates the boxes of the nodes above
+ * them without changing the topology of the tree.
+ *
+ * \tparam T The underlying type of the coordinates.
+ */
+template <std::floating_point T>
+class BVH {
+public:
+    /**
+     * \brief The result of a nearest neighbour query.
+     */
+    struct Nearest {
+        /// The index of the primitive.
+        uint32_t index;
+
+        /// The squared distance from the query point to its box.
+        T squared_distance;
+    };
+
+    /**
+     * \brief Constructs an empty tree, which every query misses.
+     */
+    [[nodiscard]] BVH() = default;
+
+    /**
+     * \brief Builds a tree over the boxes of the primitives.
+     * \param bounds The box of each primitive.
+     * \param options The parameters of the build.
+     * \throw std::invalid_argument If the leaf size is out of range or there
+     * are more primitives than 32-bit indices can reference.
+     */
+    [[nodiscard]] explicit BVH(
+        std::span<const AABB<T>> bounds, const BVHOptions& options = {}
+    ) {
+        if (options.leaf_size == 0 ||
+            options.leaf_size > std::numeric_limits<uint16_t>::max()) {
+            throw std::invalid_argument("Leaf size is out of range");
+        }
+        if (bounds.size() >= std::numeric_limits<uint32_t>::max()) {
+            throw std::invalid_argument("Too many primitives");
+        }
+
+        this->build(bounds, options);
+    }
+
+    /**
+     * \brief Builds a tree over points, each stored as a box of zero size.
+     * \param points The points.
+     * \param options The parameters of the build.
+     * \throw std::invalid_argument If the leaf size is out of range or there
+     * are more points than 32-bit indices can reference.
+     * \return The tree, whose primitive indices are the indices of the points.
+     */
+    [[nodiscard]] static auto from_points(
+        std::span<const Vector<T, 3>> points, const BVHOptions& options = {}
+    ) -> BVH {
+        auto bounds = std::vector<AABB<T>>{};
+        bounds.reserve(points.size());
+        for (const auto& point : points) {
+            bounds.emplace_back(point, point);
+        }
+        return BVH{bounds, options};
+    }
+
+    /**
+     * \brief Returns the number of primitives in the tree.
+     */
+    [[nodiscard]] auto size() const -> size_t {
+        return this->primitive_indices.size();
+    }
+
+    /**
+     * \brief Returns the number of nodes of the tree, each holding up to four
+     * children.
+     */
+    [[nodiscard]] auto node_count() const -> size_t {
+        return this->nodes.size();
+    }
+
+    /**
+     * \brief Returns the box containing every primitive.
+     * \return The box of the root, empty if the tree is empty.
+     */
+    [[nodiscard]] auto bounds() const -> AABB<T> {
+        if (this->nodes.empty()) {
+            return AABB<T>{};
+        }
+        return BVH::slot_bounds(this->nodes.front(), 0)
+            .merged(BVH::slot_bounds(this->nodes.front(), 1))
+            .merged(BVH::slot_bounds(this->nodes.front(), 2))
+            .merged(BVH::slot_bounds(this->nodes.front(), 3));
+    }
+
+    /**
+     * \brief Appends the index of every primitive whose box overlaps the
+     * given box.
+     * \param box The box to test.
+     * \param hits The indices of the overlapping primitives are appended to
+     * it, in no particular order.
+     */
+    auto query(const AABB<T>& box, std::vector<uint32_t>& hits) const
+        -> void {
+        if (this->nodes.empty() || box.is_empty()) {
+            return;
+        }
+
+        const auto min = BVH::lanes(box.min());
+        const auto max = BVH::lanes(box.max());
+
+        auto stack = Detail::TraversalStack<uint32_t>{};
+        stack.push(0);
+        while (!stack.empty()) {
+            const auto& node = this->nodes[stack.pop()];
+
+            auto mask = BVH::overlap(node, min, max) & BVH::slot_mask(node);
+            for (; mask != 0; mask &= mask - 1) {
+                const auto slot = std::countr_zero(mask);
+                if (node.counts[slot] == 0) {
+                    stack.push(node.children[slot]);
+                    continue;
+                }
+
+                const auto begin = size_t{node.children[slot]};
+                for (auto i = begin; i < begin + node.counts[slot]; ++i) {
+                    if (this->primitive_bounds[i].overlaps(box)) {
+                        hits.push_back(this->primitive_indices[i]);
+                    }
+                }
+            }
+        }
+    }
+
+    /**
+     * \brief Appends the index of every primitive whose box is crossed by a
+     * ray.
+     * \param origin The origin of the ray.
+     * \param direction The direction of the ray, which does not need to be
+     * normalized.
+     * \param max_distance The length of the ray, in multiples of `direction`.
+     * \param hits The indices of the primitives whose box the ray enters
+     * within `[0, max_distance]` are appended to it, in no particular order.
+     */
+    auto query_ray(
+        const Vector<T, 3>& origin,
+        const Vector<T, 3>& direction,
+        T max_distance,
+        std::vector<uint32_t>& hits
+    ) const -> void {
+        if (this->nodes.empty()) {
+            return;
+        }
+
+        const auto ray = Ray{
+            BVH::lanes(origin),
+            {T{1} / direction.x(), T{1} / direction.y(), T{1} / direction.z()},
+            max_distance,
+        };
+
+        auto stack = Detail::TraversalStack<uint32_t>{};
+        stack.push(0);
+        while (!stack.empty()) {
+            const auto& node = this->nodes[stack.pop()];
+
+            auto mask = BVH::intersect(node, ray) & BVH::slot_mask(node);
+            for (; mask != 0; mask &= mask - 1) {
+                const auto slot = std::countr_zero(mask);
+                if (node.counts[slot] == 0) {
+                    stack.push(node.children[slot]);
+                    continue;
+                }
+
+                const auto begin = size_t{node.children[slot]};
+                for (auto i = begin; i < begin + node.counts[slot]; ++i) {
+                    if (BVH::intersect(this->primitive_bounds[i], ray)) {
+                        hits.push_back(this->primitive_indices[i]);
+                    }
+                }
+            }
+        }
+    }
+
+    /**
+     * \brief Finds the primitive whose box is the closest to a point.
+     * \param point The query point.
+     * \param max_distance The largest distance to search within.
+     * \return The closest primitive and its squared distance, or nothing if
+     * no box lies within `max_distance` of the point. Ties are broken
+     * arbitrarily.
+     */
+    [[nodiscard]] auto nearest(
+        const Vector<T, 3>& point,
+        T max_distance = std::numeric_limits<T>::infinity()
+    ) const -> std::optional<Nearest> {
+        if (this->nodes.empty()) {
+            return std::nullopt;
+        }
+
+        struct Entry {
+            uint32_t node;
+            T squared_distance;
+        };
+
+        const auto coordinates = BVH::lanes(point);
+
+        auto result = std::optional<Nearest>{};
+        auto best = max_distance * max_distance;
+
+        auto distances = std::array<T, 4>{};
+        auto stack = Detail::TraversalStack<Entry>{};
+        stack.push({0, T{0}});
+        while (!stack.empty()) {
+            const auto entry = stack.pop();
+            if (entry.squared_distance > best) {
+                continue;
+            }
+            const auto& node = this->nodes[entry.node];
+
+            BVH::squared_distance(node, coordinates, distances);
+
+            // The closer children are pushed last so they are visited first
+            // and shrink `best` before the others are reached.
+            auto children = std::array<Entry, 4>{};
+            auto child_count = size_t{0};
+
+            for (size_t slot = 0; slot < node.child_count; ++slot) {
+                if (distances[slot] > best) {
+                    continue;
+                }
+
+                if (node.counts[slot] != 0) {
+                    const auto begin = size_t{node.children[slot]};
+                    for (auto i = begin; i < begin + node.counts[slot]; ++i) {
+                        const auto distance = BVH::squared_distance(
+                            this->primitive_bounds[i], coordinates
+                        );
+                        if (distance < best ||
+                            (!result.has_value() && distance <= best)) {
+                            best = distance;
+                            result = Nearest{
+                                this->primitive_indices[i], distance
+                            };
+                        }
+                    }
+                    continue;
+                }
+
+                auto position = child_count++;
+                for (; position > 0 &&
+                       children[position - 1].squared_distance <
+                           distances[slot];
+                     --position) {
+                    children[position] = children[position - 1];
+                }
+                children[position] = {node.children[slot], distances[slot]};
+            }
+
+            for (size_t i = 0; i < child_count; ++i) {
+                stack.push(children[i]);
+            }
+        }
+
+        return result;
+    }
+
+    /**
+     * \brief Replaces the boxes of every primitive and recomputes the boxes of
+     * every node, keeping the topology of the tree.
+     *
+     * The queries stay correct however far the primitives move, but the tree
+     * degrades as they drift from where it was built, at which point it is
+     * worth rebuilding.
+     *
+     * \param bounds The new box of each primitive.
+     * \pre bounds.size() == size()
+     * \throw std::invalid_argument If the sizes do not match.
+     */
+    auto refit(std::span<const AABB<T>> bounds) -> void {
+        if (bounds.size() != this->size()) {
+            throw std::invalid_argument("Batch sizes do not match");
+        }
+
+        for (size_t i = 0; i < this->primitive_indices.size(); ++i) {
+            this->primitive_bounds[i] = bounds[this->primitive_indices[i]];
+        }
+
+        for (auto node = this->nodes.size(); node > 0; --node) {
+            this->refit_node(node - 1);
+        }
+    }
+
+    /**
+     * \brief Replaces the boxes of the primitives that moved and recomputes
+     * only the boxes of the nodes above them.
+     * \param bounds The box of each primitive, of which only the moved ones
+     * are read.
+     * \param moved The indices of the primitives that moved.
+     * \pre bounds.size() == size()
+     * \throw std::invalid_argument If the sizes do not match.
+     * \throw std::out_of_range If an index of `moved` is not a primitive.
+     */
+    auto refit(
+        std::span<const AABB<T>> bounds, std::span<const uint32_t> moved
+    ) -> void {
+        if (bounds.size() != this->size()) {
+            throw std::invalid_argument("Batch sizes do not match");
+        }
+
+        auto dirty = std::vector<uint32_t>{};
+        for (const auto index : moved) {
+            if (index >= this->size()) {
+                throw std::out_of_range("Primitive index out of range");
+            }
+            this->primitive_bounds[this->primitive_positions[index]] =
+                bounds[index];
+
+            // Stops at the first node already marked, whose ancestors are
+            // marked as well.
+            for (auto node = this->primitive_leaves[index];
+                 node != BVH::no_node && this->node_dirty[node] == 0;
+                 node = this->node_parents[node]) {
+                this->node_dirty[node] = 1;
+                dirty.push_back(node);
+            }
+        }
+
+        // Children come after their parents in the node array, so refitting
+        // in decreasing order updates every child before its parent. Once a
+        // large part of the tree is dirty, scanning the flags is cheaper than
+        // sorting the dirty nodes.
+        if (dirty.size() > this->nodes.size() / 8) {
+            for (auto node = this->nodes.size(); node > 0; --node) {
+                if (this->node_dirty[node - 1] != 0) {
+                    this->refit_node(node - 1);
+                    this->node_dirty[node - 1] = 0;
+                }
+            }
+            return;
+        }
+
+        std::ranges::sort(dirty, std::greater<>{});
+        for (const auto node : dirty) {
+            this->refit_node(node);
+            this->node_dirty[node] = 0;
+        }
+    }
+
+private:
+    /**
+     * \brief Four children, either nodes or ranges of primitives, with their
+     * boxes as lanes: the minimum x, y and z coordinates of the four children,
+     * then the maximum ones. Two cache lines for floats, see the class
+     * description.
+     */
+    struct alignas(64) Node {
+        std::array<T, 24> bounds;
+
+        /// The index of the child node, or the first primitive of a leaf.
+        std::array<uint32_t, 4> children;
+
+        /// The number of primitives of a leaf, 0 for a child node.
+        std::array<uint16_t, 4> counts;
+
+        uint32_t child_count;
+    };
+
+    struct Ray {
+        std::array<T, 3> origin;
+        std::array<T, 3> inverse_direction;
+        T max_distance;
+    };
+
+    /**
+     * \brief A primitive being sorted into the tree by the build, as raw
+     * coordinates so the binning loop keeps them in registers.
+     */
+    struct Reference {
+        std::array<T, 3> min;
+        std::array<T, 3> max;
+        std::array<T, 3> centroid;
+        uint32_t index;
+    };
+
+    /**
+     * \brief The box and number of a set of references.
+     */
+    struct Bin {
+        std::array<T, 3> min{BVH::infinity, BVH::infinity, BVH::infinity};
+        std::array<T, 3> max{-BVH::infinity, -BVH::infinity, -BVH::infinity};
+        size_t count = 0;
+
+        auto add(const Reference& reference) -> void {
+            for (size_t axis = 0; axis < 3; ++axis) {
+                this->min[axis] =
+                    std::min(this->min[axis], reference.min[axis]);
+                this->max[axis] =
+                    std::max(this->max[axis], reference.max[axis]);
+            }
+            ++this->count;
+        }
+
+        auto add(const Bin& other) -> void {
+            for (size_t axis = 0; axis < 3; ++axis) {
+                this->min[axis] = std::min(this->min[axis], other.min[axis]);
+                this->max[axis] = std::max(this->max[axis], other.max[axis]);
+            }
+            this->count += other.count;
+        }
+
+        [[nodiscard]] auto bounds() const -> AABB<T> {
+            return AABB<T>{
+                {this->min[0], this->min[1], this->min[2]},
+                {this->max[0], this->max[1], this->max[2]},
+            };
+        }
+
+        /// Half the surface area times the count, infinite when empty so
+        /// splits leaving one side empty are never chosen.
+        [[nodiscard]] auto cost() const -> T {
+            if (this->count == 0) {
+                return BVH::infinity;
+            }
+
+            const auto x = this->max[0] - this->min[0];
+            const auto y = this->max[1] - this->min[1];
+            const auto z = this->max[2] - this->min[2];
+            return (x * y + y * z + z * x) * static_cast<T>(this->count);
+        }
+    };
+
+    /**
+     * \brief A contiguous range of references, their box and a box
+     * containing their centers.
+     *
+     * The centers are only bounded exactly at the root. Below it, the box of
+     * the centers of a child is the box of its references clipped to the
+     * centers of its parent, which is exact for points and otherwise only
+     * spreads the bins a little wider than needed.
+     */
+    struct Range {
+        size_t begin;
+        size_t end;
+        Bin bounds;
+        std::array<T, 3> centroid_min;
+        std::array<T, 3> centroid_max;
+
+        [[nodiscard]] auto size() const -> size_t {
+            return this->end - this->begin;
+        }
+
+        [[nodiscard]] auto child(size_t begin, size_t end, const Bin& bounds)
+            const -> Range {
+            auto result = Range{begin, end, bounds, {}, {}};
+            for (size_t axis = 0; axis < 3; ++axis) {
+                result.centroid_min[axis] =
+                    std::max(this->centroid_min[axis], bounds.min[axis]);
+                result.centroid_max[axis] =
+                    std::min(this->centroid_max[axis], bounds.max[axis]);
+            }
+            return result;
+        }
+    };
+
+    constexpr static auto max_bin_count = size_t{16};
+
+    using Bins = std::array<std::array<Bin, max_bin_count>, 3>;
+
+    /// Ranges with fewer references are binned and built on a single thread.
+    constexpr static auto parallel_threshold = size_t{1} << 14;
+
+    constexpr static auto no_node = std::numeric_limits<uint32_t>::max();
+
+    constexpr static auto infinity = std::numeric_limits<T>::infinity();
+
+    std::vector<Node> nodes;
+    std::vector<uint32_t> node_parents;
+    std::vector<uint8_t> node_dirty;
+
+    /// The primitives in the order the leaves reference them.
+    std::vector<uint32_t> primitive_indices;
+    std::vector<AABB<T>> primitive_bounds;
+
+    /// The position and leaf node of each primitive, by primitive index.
+    std::vector<uint32_t> primitive_positions;
+    std::vector<uint32_t> primitive_leaves;
+
+    auto build(std::span<const AABB<T>> bounds, const BVHOptions& options)
+        -> void {
+        if (bounds.empty()) {
+            return;
+        }
+
+        const auto hardware_threads =
+            size_t{std::thread::hardware_concurrency()};
+        const auto workers = options.thread_count != 0
+                                 ? options.thread_count
+                                 : std::max(size_t{1}, hardware_threads);
+
+        auto references = std::vector<Reference>(bounds.size());
+        auto root = Range{
+            0,
+            bounds.size(),
+            Bin{},
+            {BVH::infinity, BVH::infinity, BVH::infinity},
+            {-BVH::infinity, -BVH::infinity, -BVH::infinity},
+        };
+        for (size_t i = 0; i < bounds.size(); ++i) {
+            const auto min = BVH::lanes(bounds[i].min());
+            const auto max = BVH::lanes(bounds[i].max());
+            references[i] = {
+                min,
+                max,
+                {
+                    (min[0] + max[0]) * T{0.5},
+                    (min[1] + max[1]) * T{0.5},
+                    (min[2] + max[2]) * T{0.5},
+                },
+                static_cast<uint32_t>(i),
+            };
+            root.bounds.add(references[i]);
+            for (size_t axis = 0; axis < 3; ++axis) {
+                root.centroid_min[axis] = std::min(
+                    root.centroid_min[axis], references[i].centroid[axis]
+                );
+                root.centroid_max[axis] = std::max(
+                    root.centroid_max[axis], references[i].centroid[axis]
+                );
+            }
+        }
+
+        BVH::build_node(
+            this->nodes, references, root, options.leaf_size, workers
+        );
+
+        this->primitive_indices.resize(references.size());
+        this->primitive_bounds.resize(references.size());
+        this->primitive_positions.resize(references.size());
+        for (size_t i = 0; i < references.size(); ++i) {
+            const auto index = references[i].index;
+            this->primitive_indices[i] = index;
+            this->primitive_bounds[i] = bounds[index];
+            this->primitive_positions[index] = static_cast<uint32_t>(i);
+        }
+
+        this->node_parents.assign(this->nodes.size(), BVH::no_node);
+        this->node_dirty.assign(this->nodes.size(), 0);
+        this->primitive_leaves.resize(references.size());
+        for (size_t node = 0; node < this->nodes.size(); ++node) {
+            const auto& current = this->nodes[node];
+            for (size_t slot = 0; slot < current.child_count; ++slot) {
+                const auto first = current.children[slot];
+                if (current.counts[slot] == 0) {
+                    this->node_parents[first] = static_cast<uint32_t>(node);
+                    continue;
+                }
+                for (auto i = first; i < first + current.counts[slot]; ++i) {
+                    this->primitive_leaves[references[i].index] =
+                        static_cast<uint32_t>(node);
+                }
+            }
+        }
+    }
+
+    /**
+     * \brief Appends the node of a range of references and, after it, the
+     * nodes of its subtrees.
+     */
+    static auto build_node(
+        std::vector<Node>& nodes,
+        std::span<Reference> references,
+        const Range& range,
+        size_t leaf_size,
+        size_t workers
+    ) -> void {
+        const auto index = nodes.size();
+        nodes.push_back(BVH::empty_node());
+
+        // Two rounds of binary splits give up to four children.
+        auto children = std::array<Range, 4>{range};
+        auto child_count = size_t{1};
+        for (size_t round = 0; round < 2; ++round) {
+            const auto split_count = child_count;
+            for (size_t i = 0; i < split_count; ++i) {
+                if (children[i].size() > leaf_size) {
+                    auto [left, right] =
+                        BVH::split(references, children[i], workers);
+                    children[i] = left;
+                    children[child_count++] = right;
+                }
+            }
+        }
+
+        nodes[index].child_count = static_cast<uint32_t>(child_count);
+
+        auto subtrees =
+            std::vector<std::pair<size_t, std::future<std::vector<Node>>>>{};
+        for (size_t slot = 0; slot < child_count; ++slot) {
+            const auto& child = children[slot];
+            BVH::set_slot_bounds(nodes[index], slot, child.bounds.bounds());
+
+            if (child.size() <= leaf_size) {
+                nodes[index].children[slot] =
+                    static_cast<uint32_t>(child.begin);
+                nodes[index].counts[slot] =
+                    static_cast<uint16_t>(child.size());
+                continue;
+            }
+
+            const auto share =
+                std::max(size_t{1}, workers * child.size() / range.size());
+            if (workers > 1 && child.size() >= BVH::parallel_threshold) {
+                subtrees.emplace_back(
+                    slot,
+                    std::async(std::launch::async, [=] {
+                        auto subtree = std::vector<Node>{};
+                        BVH::build_node(
+                            subtree, references, child, leaf_size, share
+                        );
+                        return subtree;
+                    })
+                );
+                continue;
+            }
+
+            nodes[index].children[slot] = static_cast<uint32_t>(nodes.size());
+            BVH::build_node(nodes, references, child, leaf_size, share);
+        }
+
+        // Each subtree was built with its root at 0, so its child node
+        // indices are offset by where it lands in the node array.
+        for (auto& [slot, future] : subtrees) {
+            const auto subtree = future.get();
+            const auto offset = static_cast<uint32_t>(nodes.size());
+
+            nodes[index].children[slot] = offset;
+            for (auto node : subtree) {
+                for (size_t i = 0; i < node.child_count; ++i) {
+                    if (node.counts[i] == 0) {
+                        node.children[i] += offset;
+                    }
+                }
+                nodes.push_back(node);
+            }
+        }
+    }
+
+    /**
+     * \brief Splits a range of more than one reference in two along the plane
+     * of lowest surface area heuristic cost, or in halves when the centers of
+     * the references coincide.
+     */
+    [[nodiscard]] static auto split(
+        std::span<Reference> references, const Range& range, size_t workers
+    ) -> std::pair<Range, Range> {
+        const auto& origin = range.centroid_min;
+
+        // Small ranges get one bin per reference, which is as precise and
+        // keeps the sweep short for the many splits near the leaves.
+        const auto bin_count = std::min(BVH::max_bin_count, range.size());
+
+        auto scales = std::array<T, 3>{};
+        for (size_t axis = 0; axis < 3; ++axis) {
+            const auto size = range.centroid_max[axis] - origin[axis];
+            const auto scale = static_cast<T>(bin_count) / size;
+            scales[axis] = size > T{0} && scale < BVH::infinity ? scale : T{0};
+        }
+
+        if (scales == std::array<T, 3>{}) {
+            return BVH::split_in_halves(references, range);
+        }
+
+        const auto bins =
+            BVH::bin(references, range, scales, bin_count, workers);
+
+        auto best_cost = BVH::infinity;
+        auto best_axis = size_t{0};
+        auto best_bin = size_t{0};
+        for (size_t axis = 0; axis < 3; ++axis) {
+            if (scales[axis] == T{0}) {
+                continue;
+            }
+
+            const auto& axis_bins = bins[axis];
+
+            // The cost of the right side of the split after each bin.
+            auto right_costs = std::array<T, BVH::max_bin_count>{};
+            auto right = Bin{};
+            for (auto i = bin_count - 1; i > 0; --i) {
+                right.add(axis_bins[i]);
+                right_costs[i - 1] = right.cost();
+            }
+
+            auto left = Bin{};
+            for (size_t i = 0; i + 1 < bin_count; ++i) {
+                left.add(axis_bins[i]);
+
+                const auto cost = left.cost() + right_costs[i];
+                if (cost < best_cost) {
+                    best_cost = cost;
+                    best_axis = axis;
+                    best_bin = i;
+                }
+            }
+        }
+
+        const auto middle = std::partition(
+            references.begin() + static_cast<std::ptrdiff_t>(range.begin),
+            references.begin() + static_cast<std::ptrdiff_t>(range.end),
+            [&](const Reference& reference) {
+                return BVH::bin_index(
+                           reference.centroid[best_axis],
+                           origin[best_axis],
+                           scales[best_axis],
+                           bin_count
+                       ) <= best_bin;
+            }
+        );
+        const auto middle_index =
+            static_cast<size_t>(middle - references.begin());
+
+        // Only reachable when every cost overflows, the halves still keep
+        // the recursion finite.
+        if (middle_index == range.begin || middle_index == range.end) {
+            return BVH::split_in_halves(references, range);
+        }
+
+        auto left = Bin{};
+        auto right = Bin{};
+        for (size_t i = 0; i < bin_count; ++i) {
+            (i <= best_bin ? left : right).add(bins[best_axis][i]);
+        }
+
+        return {
+            range.child(range.begin, middle_index, left),
+            range.child(middle_index, range.end, right),
+        };
+    }
+
+    [[nodiscard]] static auto split_in_halves(
+        std::span<const Reference> references, const Range& range
+    ) -> std::pair<Range, Range> {
+        const auto middle = range.begin + range.size() / 2;
+
+        auto left = Bin{};
+        auto right = Bin{};
+        for (auto i = range.begin; i < range.end; ++i) {
+            (i < middle ? left : right).add(references[i]);
+        }
+
+        return {
+            range.child(range.begin, middle, left),
+            range.child(middle, range.end, right),
+        };
+    }
+
+    /**
+     * \brief Counts the references of a range falling in each bin of each
+     * axis, splitting large ranges across `workers` threads.
+     */
+    [[nodiscard]] static auto bin(
+        std::span<const Reference> references,
+        const Range& range,
+        const std::array<T, 3>& scales,
+        size_t bin_count,
+        size_t workers
+    ) -> Bins {
+        const auto& origin = range.centroid_min;
+
+        const auto bin_chunk = [&](size_t begin, size_t end) {
+            auto bins = Bins{};
+            for (auto i = begin; i < end; ++i) {
+                const auto& reference = references[i];
+                for (size_t axis = 0; axis < 3; ++axis) {
+                    bins[axis][BVH::bin_index(
+                                   reference.centroid[axis],
+                                   origin[axis],
+                                   scales[axis],
+                                   bin_count
+                               )]
+                        .add(reference);
+                }
+            }
+            return bins;
+        };
+
+        const auto chunk_count =
+            range.size() >= BVH::parallel_threshold ? workers : size_t{1};
+        const auto chunk_size = (range.size() + chunk_count - 1) / chunk_count;
+
+        auto chunks = std::vector<std::future<Bins>>{};
+        for (size_t chunk = 1; chunk < chunk_count; ++chunk) {
+            const auto begin = range.begin + chunk * chunk_size;
+            const auto end = std::min(begin + chunk_size, range.end);
+            if (begin < end) {
+                chunks.push_back(
+                    std::async(std::launch::async, bin_chunk, begin, end)
+                );
+            }
+        }
+
+        auto bins = bin_chunk(
+            range.begin, std::min(range.begin + chunk_size, range.end)
+        );
+        for (auto& future : chunks) {
+            const auto other = future.get();
+            for (size_t axis = 0; axis < 3; ++axis) {
+                for (size_t i = 0; i < bin_count; ++i) {
+                    bins[axis][i].add(other[axis][i]);
+                }
+            }
+        }
+
+        return bins;
+    }
+
+    /// The coordinates are at most `bin_count` past the origin once scaled,
+    /// so the conversion goes through the faster 32-bit one.
+    [[nodiscard]] static auto bin_index(
+        T coordinate, T origin, T scale, size_t bin_count
+    ) -> size_t {
+        return std::min(
+            bin_count - 1,
+            static_cast<size_t>(
+                static_cast<uint32_t>((coordinate - origin) * scale)
+            )
+        );
+    }
+
+    /**
+     * \brief Recomputes the boxes of the children of a node from the
+     * primitives and the child nodes below it.
+     */
+    auto refit_node(size_t index) -> void {
+        auto& node = this->nodes[index];
+        for (size_t slot = 0; slot < node.child_count; ++slot) {
+            auto bounds = AABB<T>{};
+            const auto first = size_t{node.children[slot]};
+            if (node.counts[slot] == 0) {
+                const auto& child = this->nodes[first];
+                for (size_t i = 0; i < child.child_count; ++i) {
+                    bounds = bounds.merged(BVH::slot_bounds(child, i));
+                }
+            } else {
+                for (auto i = first; i < first + node.counts[slot]; ++i) {
+                    bounds = bounds.merged(this->primitive_bounds[i]);
+                }
+            }
+            BVH::set_slot_bounds(node, slot, bounds);
+        }
+    }
+
+    [[nodiscard]] static auto empty_node() -> Node {
+        auto node = Node{};
+        for (size_t i = 0; i < 12; ++i) {
+            node.bounds[i] = std::numeric_limits<T>::infinity();
+            node.bounds[12 + i] = -std::numeric_limits<T>::infinity();
+        }
+        return node;
+    }
+
+    // NOLINTBEGIN(cppcoreguidelines-pro-bounds-constant-array-index)
+    [[nodiscard]] static auto slot_bounds(const Node& node, size_t slot)
+        -> AABB<T> {
+        return AABB<T>{
+            {node.bounds[slot], node.bounds[4 + slot], node.bounds[8 + slot]},
+            {node.bounds[12 + slot],
+             node.bounds[16 + slot],
+             node.bounds[20 + slot]},
+        };
+    }
+
+    static auto set_slot_bounds(Node& node, size_t slot, const AABB<T>& box)
+        -> void {
+        for (size_t axis = 0; axis < 3; ++axis) {
+            node.bounds[axis * 4 + slot] = box.min()[axis];
+            node.bounds[12 + axis * 4 + slot] = box.max()[axis];
+        }
+    }
+
+    [[nodiscard]] static auto slot_mask(const Node& node) -> uint32_t {
+        return (uint32_t{1} << node.child_count) - 1;
+    }
+
+    [[nodiscard]] static auto lanes(const Vector<T, 3>& vector)
+        -> std::array<T, 3> {
+        return {vector.x(), vector.y(), vector.z()};
+    }
+
+    // The scalar fallbacks of `QuadKernels`, with the same handling of NaN as
+    // the SSE minimum and maximum: the second operand wins.
+    [[nodiscard]] static auto lane_min(T lhs, T rhs) -> T {
+        return lhs < rhs ? lhs : rhs;
+    }
+
+    [[nodiscard]] static auto lane_max(T lhs, T rhs) -> T {
+        return lhs > rhs ? lhs : rhs;
+    }
+
+    /**
+     * \brief Narrows the interval of a ray to a slab of a box, given the
+     * distances to its two planes, as `QuadKernels::intersect_ray` does.
+     *
+     * A ray parallel to the slab has an infinite inverse direction, and when
+     * it starts exactly on one of the planes the distance to that plane is
+     * `0 * inf`, NaN. Such a ray lies within the closed slab along its whole
+     * length, so the slab is skipped rather than letting the NaN decide, which
+     * would miss on the minimum plane and hit on the maximum one.
+     */
+    static auto clip_slab(T lower, T upper, T& near, T& far) -> void {
+        if (std::isnan(lower) || std::isnan(upper)) {
+            return;
+        }
+        near = BVH::lane_max(BVH::lane_min(lower, upper), near);
+        far = BVH::lane_min(BVH::lane_max(lower, upper), far);
+    }
+
+    [[nodiscard]] static auto overlap(
+        const Node& node,
+        const std::array<T, 3>& min,
+        const std::array<T, 3>& max
+    ) -> uint32_t {
+        using Kernels = Simd::QuadKernels<T>;
+
+        if constexpr (requires { Kernels::overlap; }) {
+            return Kernels::overlap(node.bounds.data(), min, max);
+        } else {
+            auto mask = uint32_t{0};
+            for (size_t slot = 0; slot < 4; ++slot) {
+                auto inside = true;
+                for (size_t axis = 0; axis < 3; ++axis) {
+                    inside &= node.bounds[axis * 4 + slot] <= max[axis] &&
+                              node.bounds[12 + axis * 4 + slot] >= min[axis];
+                }
+                mask |= uint32_t{inside} << slot;
+            }
+            return mask;
+        }
+    }
+
+    [[nodiscard]] static auto intersect(const Node& node, const Ray& ray)
+        -> uint32_t {
+        using Kernels = Simd::QuadKernels<T>;
+
+        if constexpr (requires { Kernels::intersect_ray; }) {
+            return Kernels::intersect_ray(
+                node.bounds.data(),
+                ray.origin,
+                ray.inverse_direction,
+                ray.max_distance
+            );
+        } else {
+            auto mask = uint32_t{0};
+            for (size_t slot = 0; slot < 4; ++slot) {
+                auto near = T{0};
+                auto far = ray.max_distance;
+                for (size_t axis = 0; axis < 3; ++axis) {
+                    const auto lower =
+                        (node.bounds[axis * 4 + slot] - ray.origin[axis]) *
+                        ray.inverse_direction[axis];
+                    const auto upper =
+                        (node.bounds[12 + axis * 4 + slot] - ray.origin[axis]) *
+                        ray.inverse_direction[axis];
+                    BVH::clip_slab(lower, upper, near, far);
+                }
+                mask |= uint32_t{near <= far} << slot;
+            }
+            return mask;
+        }
+    }
+
+    static auto squared_distance(
+        const Node& node,
+        const std::array<T, 3>& point,
+        std::array<T, 4>& out
+    ) -> void {
+        using Kernels = Simd::QuadKernels<T>;
+
+        if constexpr (requires { Kernels::squared_distance; }) {
+            Kernels::squared_distance(node.bounds.data(), point, out.data());
+        } else {
+            for (size_t slot = 0; slot < 4; ++slot) {
+                auto distance = T{0};
+                for (size_t axis = 0; axis < 3; ++axis) {
+                    const auto below =
+                        node.bounds[axis * 4 + slot] - point[axis];
+                    const auto above =
+                        point[axis] - node.bounds[12 + axis * 4 + slot];
+                    const auto offset =
+                        BVH::lane_max(BVH::lane_max(below, above), T{0});
+                    distance += offset * offset;
+                }
+                out[slot] = distance;
+            }
+        }
+    }
+    // NOLINTEND(cppcoreguidelines-pro-bounds-constant-array-index)
+
+    [[nodiscard]] static auto intersect(const AABB<T>& box, const Ray& ray)
+        -> bool {
+        auto near = T{0};
+        auto far = ray.max_distance;
+        for (size_t axis = 0; axis < 3; ++axis) {
+            const auto lower = (box.min()[axis] - ray.origin[axis]) *
+                               ray.inverse_direction[axis];
+            const auto upper = (box.max()[axis] - ray.origin[axis]) *
+                               ray.inverse_direction[axis];
+            BVH::clip_slab(lower, upper, near, far);
+        }
+        return near <= far;
+    }
+
+    [[nodiscard]] static auto squared_distance(
+        const AABB<T>& box, const std::array<T, 3>& point
+    ) -> T {
+        auto distance = T{0};
+        for (size_t axis = 0; axis < 3; ++axis) {
+            const auto offset = BVH::lane_max(
+                BVH::lane_max(
+                    box.min()[axis] - point[axis], point[axis] - box.max()[axis]
+                ),
+                T{0}
+            );
+            distance += offset * offset;
+        }
+        return distance;
+    }
+};
+
+}  // namespace Luminol::Maths
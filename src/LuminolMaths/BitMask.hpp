@@ -0,0 +1,66 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <span>
+
+/**
+ * Packed results of the batch tests, one bit per object.
+ *
+ * Bit `i % 64` of word `i / 64` holds the result of object `i`, and the bits
+ * past the last object are cleared, so the visible objects of a mask can be
+ * enumerated with `std::countr_zero` a word at a time.
+ */
+namespace Luminol::Maths::BitMask {
+
+/**
+ * \brief Returns the number of words holding one bit per object.
+ * \param count The number of objects.
+ * \return The number of 64-bit words of the mask.
+ */
+[[nodiscard]] constexpr auto word_count(size_t count) -> size_t {
+    return (count + 63) / 64;
+}
+
+/**
+ * \brief Returns the bit of the object at the given index.
+ * \param mask The mask.
+ * \param index The index of the object.
+ * \pre index / 64 < mask.size()
+ * \return Whether the bit of the object is set.
+ */
+[[nodiscard]] constexpr auto test(std::span<const uint64_t> mask, size_t index)
+    -> bool {
+    return ((mask[index / 64] >> (index % 64)) & 1) != 0;
+}
+
+/**
+ * \brief Overwrites the mask with `predicate(i)` for the first `count`
+ * objects, a whole word at a time.
+ *
+ * Predicates that avoid early exits keep the loop free of data dependent
+ * branches.
+ *
+ * \param mask The mask.
+ * \param count The number of objects.
+ * \param predicate The function computing the bit of an object from its
+ * index.
+ * \pre mask.size() == word_count(count)
+ */
+template <typename Predicate>
+constexpr auto assign(
+    std::span<uint64_t> mask, size_t count, Predicate predicate
+) -> void {
+    for (size_t word = 0; word < mask.size(); ++word) {
+        const auto begin = word * 64;
+        const auto end = std::min(begin + 64, count);
+
+        auto bits = uint64_t{0};
+        for (size_t i = begin; i < end; ++i) {
+            bits |= uint64_t{predicate(i)} << (i - begin);
+        }
+        mask[word] = bits;
+    }
+}
+
+}  // namespace Luminol::Maths::BitMask
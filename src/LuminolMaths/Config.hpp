@@ -0,0 +1,54 @@
+#pragma once
+
+// LUMINOL_MATHS_SIMD is defined by the build when LUMINOL_MATHS_ENABLE_SIMD is
+// ON. The SSE code paths are only compiled in for x86 targets, every other
+// target keeps using the scalar implementation.
+#if defined(LUMINOL_MATHS_SIMD) &&                                \
+    (defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64) || \
+     (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#define LUMINOL_MATHS_HAS_SSE 1
+#else
+#define LUMINOL_MATHS_HAS_SSE 0
+#endif
+
+#if LUMINOL_MATHS_HAS_SSE && (defined(__FMA__) || defined(__AVX2__))
+#define LUMINOL_MATHS_HAS_FMA 1
+#else
+#define LUMINOL_MATHS_HAS_FMA 0
+#endif
+
+// MSVC has no macro for F16C, but every target of /arch:AVX2 supports it.
+#if LUMINOL_MATHS_HAS_SSE && \
+    (defined(__F16C__) || (defined(_MSC_VER) && defined(__AVX2__)))
+#define LUMINOL_MATHS_HAS_F16C 1
+#else
+#define LUMINOL_MATHS_HAS_F16C 0
+#endif
+
+// LUMINOL_MATHS_CHECKED selects bounds-checked element access in Vector and
+// Matrix. The build defines it from the LUMINOL_MATHS_CHECKED option, and when
+// it is left to AUTO it follows NDEBUG: checked in debug builds, unchecked and
+// noexcept in release builds. It must be the same in every translation unit.
+#if !defined(LUMINOL_MATHS_CHECKED)
+#if defined(NDEBUG)
+#define LUMINOL_MATHS_CHECKED 0
+#else
+#define LUMINOL_MATHS_CHECKED 1
+#endif
+#endif
+
+namespace Luminol::Maths::Config {
+
+/// Whether the SSE specializations of the float vectors and matrices are used.
+constexpr auto simd_enabled = bool{LUMINOL_MATHS_HAS_SSE};
+
+/// Whether the SSE specializations use fused multiply-add instructions.
+constexpr auto fma_enabled = bool{LUMINOL_MATHS_HAS_FMA};
+
+/// Whether half precision conversions use the F16C instructions.
+constexpr auto f16c_enabled = bool{LUMINOL_MATHS_HAS_F16C};
+
+/// Whether `operator[]` of vectors and matrices checks its index and throws.
+constexpr auto checked_access = bool{LUMINOL_MATHS_CHECKED};
+
+}  // namespace Luminol::Maths::Config
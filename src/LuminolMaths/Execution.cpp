@@ -0,0 +1,121 @@
+#include <LuminolMaths/Execution.hpp>
+
+namespace Luminol::Maths::Execution {
+
+namespace {
+
+/// Set on the threads running a task, so nested calls to `run` run inline.
+thread_local auto inside_task = false;
+
+}  // namespace
+
+ThreadPool::ThreadPool(size_t thread_count) {
+    if (thread_count == 0) {
+        thread_count = std::max(std::thread::hardware_concurrency(), 1U);
+    }
+
+    this->workers.reserve(thread_count - 1);
+    for (size_t i = 1; i < thread_count; ++i) {
+        this->workers.emplace_back([this] { this->worker_loop(); });
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        const auto lock = std::scoped_lock{this->mutex};
+        this->stopping = true;
+    }
+    this->wake.notify_all();
+
+    for (auto& worker : this->workers) {
+        worker.join();
+    }
+}
+
+auto ThreadPool::run(size_t count, const std::function<void(size_t)>& task)
+    -> void {
+    if (inside_task || this->workers.empty()) {
+        for (size_t i = 0; i < count; ++i) {
+            task(i);
+        }
+        return;
+    }
+
+    const auto run_lock = std::scoped_lock{this->run_mutex};
+
+    {
+        const auto lock = std::scoped_lock{this->mutex};
+        this->task = &task;
+        this->task_count = count;
+        this->next_task.store(0, std::memory_order_relaxed);
+        this->error = nullptr;
+        this->busy_workers = this->workers.size();
+        ++this->generation;
+    }
+    this->wake.notify_all();
+
+    this->work();
+
+    auto lock = std::unique_lock{this->mutex};
+    this->done.wait(lock, [this] { return this->busy_workers == 0; });
+
+    this->task = nullptr;
+    if (this->error) {
+        std::rethrow_exception(std::exchange(this->error, nullptr));
+    }
+}
+
+auto ThreadPool::work() -> void {
+    inside_task = true;
+
+    for (auto index = this->next_task.fetch_add(1, std::memory_order_relaxed);
+         index < this->task_count;
+         index = this->next_task.fetch_add(1, std::memory_order_relaxed)) {
+        try {
+            (*this->task)(index);
+        } catch (...) {
+            // Skips the remaining tasks, keeping the first exception.
+            this->next_task.store(this->task_count, std::memory_order_relaxed);
+
+            const auto lock = std::scoped_lock{this->mutex};
+            if (!this->error) {
+                this->error = std::current_exception();
+            }
+        }
+    }
+
+    inside_task = false;
+}
+
+auto ThreadPool::worker_loop() -> void {
+    auto seen = uint64_t{0};
+
+    while (true) {
+        {
+            auto lock = std::unique_lock{this->mutex};
+            this->wake.wait(lock, [&] {
+                return this->stopping || this->generation != seen;
+            });
+
+            if (this->stopping) {
+                return;
+            }
+            seen = this->generation;
+        }
+
+        this->work();
+
+        {
+            const auto lock = std::scoped_lock{this->mutex};
+            --this->busy_workers;
+        }
+        this->done.notify_one();
+    }
+}
+
+auto default_pool() -> ThreadPool& {
+    static auto pool = ThreadPool{};
+    return pool;
+}
+
+}  // namespace Luminol::Maths::Execution
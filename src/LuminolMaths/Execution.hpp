@@ -0,0 +1,227 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <concepts>
+#include <condition_variable>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/**
+ * Execution policies of the span and batch kernels.
+ *
+ * A kernel taking a policy splits its input into chunks of a few dozen
+ * kilobytes, small enough for the inputs and outputs of a chunk to stay in the
+ * L2 cache, and hands the chunks to the policy:
+ * - `sequential` runs every chunk on the calling thread.
+ * - Any type modelling `TaskPool`, e.g. a `ThreadPool` or an adapter over a
+ * work-stealing scheduler, runs the chunks on its own threads.
+ * - Any type `PolicyTraits` is specialized for runs the chunks as the
+ * specialization says. `ExecutionStd.hpp` specializes it for the standard
+ * policies, running `std::execution::par` and `std::execution::par_unseq` on
+ * `default_pool()` and the sequential ones on the calling thread.
+ *
+ * This header does not include `<execution>`, which with libstdc++ pulls in
+ * the TBB backend when TBB is installed and then has to be linked against it.
+ * Only code using the standard policies includes `ExecutionStd.hpp`.
+ *
+ * Chunks are a multiple of 16 elements, so with cache line aligned buffers no
+ * two threads write to the same cache line.
+ */
+namespace Luminol::Maths::Execution {
+
+/**
+ * \brief Runs every chunk on the calling thread.
+ */
+struct Sequential {};
+
+constexpr auto sequential = Sequential{};
+
+/**
+ * \brief A pool running a number of independent tasks and blocking until all
+ * of them are finished.
+ *
+ * `run(count, task)` calls `task(i)` for every `i` in `[0, count)`, in any
+ * order and on any of its threads, and rethrows an exception thrown by a task.
+ * `concurrency()` is the number of tasks it runs at once.
+ */
+template <typename Pool>
+concept TaskPool = requires(
+    Pool& pool, size_t count, const std::function<void(size_t)>& task
+) {
+    { pool.concurrency() } -> std::convertible_to<size_t>;
+    pool.run(count, task);
+};
+
+/**
+ * \brief Describes how the kernels run under a policy type that is neither
+ * `Sequential` nor a `TaskPool`, such as the standard policies.
+ */
+template <typename P>
+struct PolicyTraits {
+    /// Whether the type can be passed as the policy of a kernel.
+    constexpr static auto is_policy = false;
+
+    /// Whether the chunks run on `default_pool()` rather than on the calling
+    /// thread.
+    constexpr static auto is_parallel = false;
+};
+
+/**
+ * \brief Whether the type can be passed as the policy of a kernel.
+ */
+template <typename P>
+concept Policy = std::same_as<std::remove_cvref_t<P>, Sequential> ||
+                 PolicyTraits<std::remove_cvref_t<P>>::is_policy ||
+                 TaskPool<std::remove_cvref_t<P>>;
+
+/**
+ * \brief A fixed set of threads sharing the tasks of one `run` at a time.
+ *
+ * The calling thread takes part in `run`, and every thread claims the next
+ * task from a shared counter, so threads finishing early keep taking work
+ * instead of idling behind a static partition. Concurrent calls to `run` are
+ * serialized, and calls made from within a task run inline.
+ */
+class ThreadPool {
+public:
+    /**
+     * \brief Starts the threads of the pool.
+     * \param thread_count The number of threads running tasks, including the
+     * thread calling `run`. 0 uses one per hardware thread.
+     */
+    explicit ThreadPool(size_t thread_count = 0);
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool(ThreadPool&&) = delete;
+    auto operator=(const ThreadPool&) -> ThreadPool& = delete;
+    auto operator=(ThreadPool&&) -> ThreadPool& = delete;
+
+    ~ThreadPool();
+
+    /**
+     * \brief Returns the number of threads running tasks, including the
+     * thread calling `run`.
+     */
+    [[nodiscard]] auto concurrency() const noexcept -> size_t {
+        return this->workers.size() + 1;
+    }
+
+    /**
+     * \brief Calls `task(i)` for every `i` in `[0, count)` and waits for all
+     * of them to finish.
+     * \param count The number of tasks.
+     * \param task The function running a task from its index.
+     * \throw Any exception thrown by a task, the first one if several throw.
+     * The tasks not yet started when a task throws are skipped.
+     */
+    auto run(size_t count, const std::function<void(size_t)>& task) -> void;
+
+private:
+    auto work() -> void;
+    auto worker_loop() -> void;
+
+    std::vector<std::thread> workers;
+
+    /// Held for the whole of a `run`, so only one set of tasks is shared.
+    std::mutex run_mutex;
+
+    std::mutex mutex;
+    std::condition_variable wake;
+    std::condition_variable done;
+
+    const std::function<void(size_t)>* task = nullptr;
+    size_t task_count = 0;
+    std::atomic<size_t> next_task = 0;
+    std::exception_ptr error;
+
+    /// Incremented by every `run`, so workers wake up once per set of tasks.
+    uint64_t generation = 0;
+    size_t busy_workers = 0;
+    bool stopping = false;
+};
+
+/**
+ * \brief Returns the pool running the standard parallel policies, with one
+ * thread per hardware thread.
+ */
+[[nodiscard]] auto default_pool() -> ThreadPool&;
+
+/**
+ * \brief The working set of a chunk in bytes, half of a typical 128 KiB L2
+ * cache so the prefetched next chunk fits as well.
+ */
+constexpr auto chunk_bytes = size_t{64 * 1024};
+
+/**
+ * \brief Chunk sizes are rounded to a multiple of this many elements, a cache
+ * line of floats.
+ */
+constexpr auto chunk_alignment = size_t{16};
+
+/**
+ * \brief Returns the number of elements in a chunk.
+ * \param element_bytes The number of bytes read and written per element.
+ * \return The number of elements whose working set fits in `chunk_bytes`,
+ * rounded up to a multiple of `chunk_alignment`.
+ */
+[[nodiscard]] constexpr auto chunk_size(size_t element_bytes) -> size_t {
+    const auto elements = chunk_bytes / std::max(element_bytes, size_t{1});
+    return std::max(
+        (elements + chunk_alignment - 1) / chunk_alignment * chunk_alignment,
+        chunk_alignment
+    );
+}
+
+/**
+ * \brief Splits `[0, count)` into cache sized chunks and calls
+ * `function(begin, end)` for each of them under the given policy.
+ *
+ * Inputs that fit in a single chunk, and every input under a sequential
+ * policy, are processed with one call on the calling thread.
+ *
+ * \param policy The execution policy.
+ * \param count The number of elements.
+ * \param element_bytes The number of bytes read and written per element.
+ * \param function The function processing the elements of a chunk.
+ * \throw Any exception thrown by `function`.
+ */
+template <Policy P, typename Function>
+auto for_each_chunk(
+    P&& policy, size_t count, size_t element_bytes, Function&& function
+) -> void {
+    using PolicyType = std::remove_cvref_t<P>;
+
+    const auto size = chunk_size(element_bytes);
+
+    if constexpr (TaskPool<PolicyType>) {
+        if (count > size && policy.concurrency() > 1) {
+            const auto chunks = (count + size - 1) / size;
+            policy.run(chunks, [&](size_t chunk) {
+                const auto begin = chunk * size;
+                function(begin, std::min(begin + size, count));
+            });
+            return;
+        }
+    } else if constexpr (PolicyTraits<PolicyType>::is_parallel) {
+        for_each_chunk(
+            default_pool(),
+            count,
+            element_bytes,
+            std::forward<Function>(function)
+        );
+        return;
+    }
+
+    if (count > 0) {
+        function(size_t{0}, count);
+    }
+}
+
+}  // namespace Luminol::Maths::Execution
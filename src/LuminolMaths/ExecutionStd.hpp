@@ -0,0 +1,29 @@
+#pragma once
+
+#include <execution>
+#include <type_traits>
+
+#include <LuminolMaths/Execution.hpp>
+
+/**
+ * Lets the kernels taking an execution policy accept the standard policies.
+ *
+ * The standard policies are only used as tags, the chunks of the parallel ones
+ * run on `Execution::default_pool()` rather than on a parallel algorithm of the
+ * standard library. Including `<execution>` may still require linking the
+ * backend of the standard library, TBB for libstdc++ when it is installed, so
+ * targets including this header link `LuminolMaths.ExecutionStd`.
+ */
+namespace Luminol::Maths::Execution {
+
+template <typename P>
+    requires std::is_execution_policy_v<P>
+struct PolicyTraits<P> {
+    constexpr static auto is_policy = true;
+
+    constexpr static auto is_parallel =
+        std::is_same_v<P, std::execution::parallel_policy> ||
+        std::is_same_v<P, std::execution::parallel_unsequenced_policy>;
+};
+
+}  // namespace Luminol::Maths::Execution
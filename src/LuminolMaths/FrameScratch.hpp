@@ -0,0 +1,134 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+#include <LuminolMaths/MemoryResource.hpp>
+#include <LuminolMaths/VectorBatch.hpp>
+
+namespace Luminol::Maths {
+
+/**
+ * \brief Scratch memory for the temporary results of a frame, such as the
+ * transformed points and visibility masks of the transform and cull kernels.
+ *
+ * Everything allocated during a frame is freed at once by `begin_frame`, and
+ * `scope` frees what a kernel allocated when it returns. The memory comes from
+ * an `ArenaResource`, so once the scratch has grown to the working set of a
+ * frame, frames no longer allocate from the heap. Not thread safe, use one per
+ * thread.
+ */
+class FrameScratch {
+public:
+    /**
+     * \brief Frees the allocations made since its construction when destroyed,
+     * see `FrameScratch::scope`.
+     */
+    class Scope {
+    public:
+        explicit Scope(ArenaResource& arena) noexcept
+            : arena{arena}, marker{arena.mark()} {}
+
+        Scope(const Scope&) = delete;
+        Scope(Scope&&) = delete;
+        ~Scope() { this->arena.rewind(this->marker); }
+
+        auto operator=(const Scope&) -> Scope& = delete;
+        auto operator=(Scope&&) -> Scope& = delete;
+
+    private:
+        ArenaResource& arena;
+        ArenaResource::Marker marker;
+    };
+
+    /**
+     * \brief Constructs an empty scratch.
+     * \param block_size The size of the first block of the arena, see
+     * `ArenaResource`.
+     * \param upstream The resource providing the blocks.
+     */
+    explicit FrameScratch(
+        size_t block_size = size_t{1024} * 1024,
+        std::pmr::memory_resource* upstream = std::pmr::get_default_resource()
+    )
+        : arena{block_size, ArenaResource::default_alignment, upstream} {}
+
+    /**
+     * \brief Frees everything allocated during the previous frame.
+     * \pre Nothing allocated from the scratch is used anymore.
+     */
+    auto begin_frame() noexcept -> void { this->arena.reset(); }
+
+    /**
+     * \brief Returns a guard freeing what is allocated until it is destroyed.
+     * Scopes must be destroyed in the reverse order of their creation.
+     */
+    [[nodiscard]] auto scope() noexcept -> Scope { return Scope{this->arena}; }
+
+    /**
+     * \brief Allocates an array of `count` elements, valid until the end of
+     * the frame or of the enclosing scope.
+     * \param count The number of elements.
+     * \throw std::bad_alloc If the allocation fails.
+     * \return The elements, default initialized, so left uninitialized for
+     * scalars.
+     */
+    template <typename T>
+        requires std::is_trivially_destructible_v<T>
+    [[nodiscard]] auto allocate(size_t count) -> std::span<T> {
+        auto allocator = std::pmr::polymorphic_allocator<T>{&this->arena};
+        auto* elements = allocator.allocate(count);
+        std::uninitialized_default_construct_n(elements, count);
+        return {elements, count};
+    }
+
+    /**
+     * \brief Returns an empty vector allocating from the scratch.
+     */
+    template <typename T>
+    [[nodiscard]] auto make_vector() -> std::pmr::vector<T> {
+        return std::pmr::vector<T>{&this->arena};
+    }
+
+    /**
+     * \brief Returns a batch of `count` zero vectors allocating from the
+     * scratch.
+     * \param count The number of vectors in the batch.
+     */
+    template <typename T, size_t N>
+    [[nodiscard]] auto make_batch(size_t count = 0) -> pmr::VectorBatch<T, N> {
+        return pmr::VectorBatch<T, N>{
+            count, std::pmr::polymorphic_allocator<T>{&this->arena}
+        };
+    }
+
+    /**
+     * \brief Returns the arena, to pass to other `std::pmr` containers.
+     */
+    [[nodiscard]] auto resource() noexcept -> ArenaResource& {
+        return this->arena;
+    }
+
+    /**
+     * \brief Returns the number of bytes allocated during the frame.
+     */
+    [[nodiscard]] auto used() const noexcept -> size_t {
+        return this->arena.used();
+    }
+
+    /**
+     * \brief Returns the number of bytes held by the scratch.
+     */
+    [[nodiscard]] auto capacity() const noexcept -> size_t {
+        return this->arena.capacity();
+    }
+
+private:
+    ArenaResource arena;
+};
+
+}  // namespace Luminol::Maths
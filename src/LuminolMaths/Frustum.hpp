@@ -0,0 +1,298 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <cstdint>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+
+#include <LuminolMaths/AABB.hpp>
+#include <LuminolMaths/BitMask.hpp>
+#include <LuminolMaths/Matrix.hpp>
+#include <LuminolMaths/Simd.hpp>
+#include <LuminolMaths/Sphere.hpp>
+#include <LuminolMaths/Vector.hpp>
+#include <LuminolMaths/VectorBatch.hpp>
+
+namespace Luminol::Maths {
+
+/**
+ * \brief The six planes bounding the volume visible through a camera.
+ *
+ * The planes are extracted from a view-projection matrix in the row vector
+ * convention of `Transform`, i.e. `view * projection`, whose clip space
+ * depth ranges from 0 to w as produced by
+ * `Transform::left_handed_perspective_projection_matrix`. Each plane is
+ * stored as `[a, b, c, d]` with a unit normal pointing into the frustum, so
+ * `a * x + b * y + c * z + d` is the signed distance of a point to it.
+ *
+ * The sphere and box tests are conservative: every object that intersects
+ * the frustum is reported as visible, as may some objects that lie outside
+ * of it near its edges.
+ *
+ * \tparam T The underlying type of the plane coefficients.
+ */
+template <std::floating_point T>
+class Frustum {
+public:
+    using Plane = Vector<T, 4>;
+
+    enum class Side : uint8_t { Left, Right, Bottom, Top, Near, Far };
+
+    constexpr static auto plane_count = size_t{6};
+
+    /**
+     * \brief Extracts the frustum planes from a view-projection matrix.
+     * \param view_projection The matrix transforming world space points into
+     * clip space.
+     */
+    explicit constexpr Frustum(const Matrix<T, 4, 4>& view_projection) {
+        const auto column = [&](size_t j) {
+            return Plane{
+                view_projection[0][j],
+                view_projection[1][j],
+                view_projection[2][j],
+                view_projection[3][j],
+            };
+        };
+
+        const auto x = column(0);
+        const auto y = column(1);
+        const auto z = column(2);
+        const auto w = column(3);
+
+        this->planes = {w + x, w - x, w + y, w - y, z, w - z};
+
+        for (auto& plane : this->planes) {
+            const auto normal = Vector<T, 3>{plane.x(), plane.y(), plane.z()};
+            plane /= normal.length();
+        }
+    }
+
+    /**
+     * \brief Returns the plane of the given side.
+     * \param side The side of the frustum.
+     * \return The plane as `[a, b, c, d]`, with the normal pointing inwards.
+     */
+    [[nodiscard]] constexpr auto plane(Side side) const -> const Plane& {
+        return this->planes.at(static_cast<size_t>(side));
+    }
+
+    /**
+     * \brief Returns whether the point lies inside of the frustum.
+     * \param point The point to test.
+     * \return Whether the point is on the inner side of every plane.
+     */
+    [[nodiscard]] constexpr auto contains(const Vector<T, 3>& point) const
+        -> bool {
+        return this->intersects(point, T{0});
+    }
+
+    /**
+     * \brief Returns whether a sphere may intersect the frustum.
+     * \param center The center of the sphere.
+     * \param radius The radius of the sphere.
+     * \return False if the sphere lies entirely outside of one of the planes.
+     */
+    [[nodiscard]] constexpr auto intersects(
+        const Vector<T, 3>& center, T radius
+    ) const -> bool {
+        return std::ranges::all_of(this->planes, [&](const Plane& plane) {
+            return Frustum::distance(plane, center) >= -radius;
+        });
+    }
+
+    /**
+     * \brief Returns whether an axis-aligned box may intersect the frustum.
+     * \param min The corner of the box with the smallest coordinates.
+     * \param max The corner of the box with the largest coordinates.
+     * \return False if the box lies entirely outside of one of the planes.
+     */
+    [[nodiscard]] constexpr auto intersects(
+        const Vector<T, 3>& min, const Vector<T, 3>& max
+    ) const -> bool {
+        return std::ranges::all_of(this->planes, [&](const Plane& plane) {
+            // The corner furthest along the normal is the last to leave.
+            const auto corner = Vector<T, 3>{
+                plane.x() >= T{0} ? max.x() : min.x(),
+                plane.y() >= T{0} ? max.y() : min.y(),
+                plane.z() >= T{0} ? max.z() : min.z(),
+            };
+            return Frustum::distance(plane, corner) >= T{0};
+        });
+    }
+
+    /**
+     * \brief Returns whether a sphere may intersect the frustum.
+     * \param sphere The sphere to test.
+     * \return False if the sphere is empty or lies entirely outside of one
+     * of the planes.
+     */
+    [[nodiscard]] constexpr auto intersects(const Sphere<T>& sphere) const
+        -> bool {
+        return !sphere.is_empty() &&
+               this->intersects(sphere.center(), sphere.radius());
+    }
+
+    /**
+     * \brief Returns whether an axis-aligned box may intersect the frustum.
+     * \param box The box to test.
+     * \return False if the box is empty or lies entirely outside of one of
+     * the planes.
+     */
+    [[nodiscard]] constexpr auto intersects(const AABB<T>& box) const -> bool {
+        return !box.is_empty() && this->intersects(box.min(), box.max());
+    }
+
+    /**
+     * \brief Tests every sphere against the frustum and writes one bit per
+     * sphere, set when it may be visible.
+     *
+     * The bits are laid out as described in `BitMask`.
+     *
+     * \param centers The centers of the spheres.
+     * \param radii The radii of the spheres.
+     * \param visible The destination of the bits.
+     * \pre radii.size() == centers.size() &&
+     * visible.size() == BitMask::word_count(centers.size())
+     * \throw std::invalid_argument If the sizes do not match.
+     */
+    template <typename Allocator>
+    auto cull_spheres(
+        const VectorBatch<T, 3, Allocator>& centers,
+        std::span<const T> radii,
+        std::span<uint64_t> visible
+    ) const -> void {
+        Frustum::check_sizes(centers.size(), radii.size(), visible.size());
+
+        const auto lanes = std::array{
+            centers.x().data(), centers.y().data(), centers.z().data()
+        };
+
+        const auto planes = this->coefficients();
+
+        using Kernels = Simd::LaneKernels<T>;
+
+        if constexpr (requires { Kernels::cull_spheres; }) {
+            std::ranges::fill(visible, uint64_t{0});
+            Kernels::cull_spheres(
+                planes, lanes, radii.data(), visible.data(), radii.size()
+            );
+        } else {
+            // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+            BitMask::assign(visible, radii.size(), [&](size_t i) {
+                auto inside = true;
+                for (const auto& plane : planes) {
+                    inside &= plane[0] * lanes[0][i] + plane[1] * lanes[1][i] +
+                                  plane[2] * lanes[2][i] + plane[3] >=
+                              -radii[i];
+                }
+                return inside;
+            });
+            // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        }
+    }
+
+    /**
+     * \brief Tests every axis-aligned box against the frustum and writes one
+     * bit per box, set when it may be visible.
+     *
+     * The bits are laid out as described in `BitMask`.
+     *
+     * \param mins The corners of the boxes with the smallest coordinates.
+     * \param maxs The corners of the boxes with the largest coordinates.
+     * \param visible The destination of the bits.
+     * \pre maxs.size() == mins.size() &&
+     * visible.size() == BitMask::word_count(mins.size())
+     * \throw std::invalid_argument If the sizes do not match.
+     */
+    template <typename Allocator>
+    auto cull_boxes(
+        const VectorBatch<T, 3, Allocator>& mins,
+        const VectorBatch<T, 3, Allocator>& maxs,
+        std::span<uint64_t> visible
+    ) const -> void {
+        Frustum::check_sizes(mins.size(), maxs.size(), visible.size());
+
+        const auto min_lanes =
+            std::array{mins.x().data(), mins.y().data(), mins.z().data()};
+        const auto max_lanes =
+            std::array{maxs.x().data(), maxs.y().data(), maxs.z().data()};
+
+        const auto planes = this->coefficients();
+        const auto corners =
+            Frustum::corner_lanes(planes, min_lanes, max_lanes);
+
+        using Kernels = Simd::LaneKernels<T>;
+
+        if constexpr (requires { Kernels::cull_boxes; }) {
+            std::ranges::fill(visible, uint64_t{0});
+            Kernels::cull_boxes(planes, corners, visible.data(), mins.size());
+        } else {
+            // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+            BitMask::assign(visible, mins.size(), [&](size_t i) {
+                auto inside = true;
+                for (size_t p = 0; p < plane_count; ++p) {
+                    const auto& plane = planes[p];
+                    inside &= plane[0] * corners[p][0][i] +
+                                  plane[1] * corners[p][1][i] +
+                                  plane[2] * corners[p][2][i] + plane[3] >=
+                              T{0};
+                }
+                return inside;
+            });
+            // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        }
+    }
+
+private:
+    std::array<Plane, plane_count> planes{};
+
+    [[nodiscard]] constexpr static auto distance(
+        const Plane& plane, const Vector<T, 3>& point
+    ) -> T {
+        return plane.x() * point.x() + plane.y() * point.y() +
+               plane.z() * point.z() + plane.w();
+    }
+
+    [[nodiscard]] auto coefficients() const
+        -> std::array<std::array<T, 4>, plane_count> {
+        auto result = std::array<std::array<T, 4>, plane_count>{};
+        for (size_t i = 0; i < plane_count; ++i) {
+            const auto& plane = this->planes[i];
+            result[i] = {plane.x(), plane.y(), plane.z(), plane.w()};
+        }
+        return result;
+    }
+
+    /**
+     * \brief Returns, for every plane, the lanes of the box corners furthest
+     * along its normal. That corner is the last to leave the plane and only
+     * depends on the signs of the normal.
+     */
+    [[nodiscard]] static auto corner_lanes(
+        const std::array<std::array<T, 4>, plane_count>& planes,
+        const std::array<const T*, 3>& min_lanes,
+        const std::array<const T*, 3>& max_lanes
+    ) -> std::array<std::array<const T*, 3>, plane_count> {
+        auto result = std::array<std::array<const T*, 3>, plane_count>{};
+        for (size_t p = 0; p < plane_count; ++p) {
+            for (size_t j = 0; j < 3; ++j) {
+                result[p][j] =
+                    planes[p][j] >= T{0} ? max_lanes[j] : min_lanes[j];
+            }
+        }
+        return result;
+    }
+
+    static auto check_sizes(size_t count, size_t other, size_t words)
+        -> void {
+        if (other != count || words != BitMask::word_count(count)) {
+            throw std::invalid_argument("Batch sizes do not match");
+        }
+    }
+};
+
+}  // namespace Luminol::Maths
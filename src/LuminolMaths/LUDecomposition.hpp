@@ -0,0 +1,231 @@
+#pragma once
+
+#include <array>
+#include <utility>
+
+#include <LuminolMaths/Matrix.hpp>
+#include <LuminolMaths/Vector.hpp>
+
+namespace Luminol::Maths {
+
+/**
+ * \brief The LU factorization with partial pivoting of a square matrix, such
+ * that `P * A = L * U`.
+ *
+ * The factorization costs O(N^3) once, after which the determinant, the
+ * inverse and the solutions of `A * x = b` are obtained by substitution
+ * without forming the cofactor matrix. Prefer it over `Matrix::determinant`
+ * and `Matrix::inverse` for matrices larger than 4x4, or when the same matrix
+ * is solved against several right-hand sides.
+ *
+ * `L` has an implicit unit diagonal and is stored with `U` in a single
+ * matrix. A matrix is considered singular when one of its pivots is exactly
+ * zero, the same criterion `Matrix::inverse` applies to the determinant.
+ *
+ * \tparam T The underlying type of the elements in the matrix.
+ * \tparam N The number of rows and columns of the matrix.
+ */
+template <typename T, size_t N>
+    requires(N >= 1)
+class LUDecomposition {
+public:
+    // NOLINTBEGIN(cppcoreguidelines-pro-bounds-constant-array-index)
+    /**
+     * \brief Factorizes the given matrix.
+     * \param matrix The matrix to factorize.
+     */
+    [[nodiscard]] constexpr explicit LUDecomposition(
+        const Matrix<T, N, N>& matrix
+    )
+        : lu{matrix} {
+        for (size_t i = 0; i < N; ++i) {
+            this->permutation[i] = i;
+        }
+
+        for (size_t k = 0; k < N; ++k) {
+            auto pivot = k;
+            for (size_t i = k + 1; i < N; ++i) {
+                if (absolute(this->lu[i][k]) > absolute(this->lu[pivot][k])) {
+                    pivot = i;
+                }
+            }
+
+            if (this->lu[pivot][k] == T{0}) {
+                this->singular = true;
+                continue;
+            }
+
+            if (pivot != k) {
+                std::swap(this->lu[pivot], this->lu[k]);
+                std::swap(this->permutation[pivot], this->permutation[k]);
+                this->sign = -this->sign;
+            }
+
+            for (size_t i = k + 1; i < N; ++i) {
+                const auto factor = this->lu[i][k] / this->lu[k][k];
+                this->lu[i][k] = factor;
+
+                for (size_t j = k + 1; j < N; ++j) {
+                    this->lu[i][j] -= factor * this->lu[k][j];
+                }
+            }
+        }
+    }
+
+    /**
+     * \brief Returns whether the factorized matrix is singular.
+     */
+    [[nodiscard]] constexpr auto is_singular() const -> bool {
+        return this->singular;
+    }
+
+    /**
+     * \brief Returns the determinant of the factorized matrix, the product of
+     * the pivots with the sign of the row permutation.
+     */
+    [[nodiscard]] constexpr auto determinant() const -> T {
+        if (this->singular) {
+            return T{0};
+        }
+
+        auto result = this->sign;
+        for (size_t i = 0; i < N; ++i) {
+            result *= this->lu[i][i];
+        }
+        return result;
+    }
+
+    /**
+     * \brief Returns the inverse of the factorized matrix.
+     * \return The inverse of the matrix.
+     * \return A zero matrix if the matrix is singular.
+     */
+    [[nodiscard]] constexpr auto inverse() const -> Matrix<T, N, N> {
+        return this->solve(Matrix<T, N, N>::identity());
+    }
+
+    /**
+     * \brief Solves `A * x = b` for `x`, where `A` is the factorized matrix.
+     * \pre N <= 4, the sizes `Vector` supports.
+     * \param rhs The right-hand side `b`.
+     * \return The solution `x`.
+     * \return A zero vector if the matrix is singular.
+     */
+    template <size_t Size>
+        requires(Size == N)
+    [[nodiscard]] constexpr auto solve(const Vector<T, Size>& rhs) const
+        -> Vector<T, Size> {
+        auto result = Vector<T, Size>{};
+        if (this->singular) {
+            return result;
+        }
+
+        for (size_t i = 0; i < N; ++i) {
+            auto value = rhs[this->permutation[i]];
+            for (size_t j = 0; j < i; ++j) {
+                value -= this->lu[i][j] * result[j];
+            }
+            result[i] = value;
+        }
+
+        for (size_t i = N; i-- > 0;) {
+            auto value = result[i];
+            for (size_t j = i + 1; j < N; ++j) {
+                value -= this->lu[i][j] * result[j];
+            }
+            result[i] = value / this->lu[i][i];
+        }
+
+        return result;
+    }
+
+    /**
+     * \brief Solves `A * X = B` for `X`, where `A` is the factorized matrix,
+     * column by column.
+     * \param rhs The right-hand sides `B`, one per column.
+     * \return The solutions `X`, one per column.
+     * \return A zero matrix if the matrix is singular.
+     */
+    template <size_t K>
+    [[nodiscard]] constexpr auto solve(const Matrix<T, N, K>& rhs) const
+        -> Matrix<T, N, K> {
+        auto result = Matrix<T, N, K>::zero();
+        if (this->singular) {
+            return result;
+        }
+
+        for (size_t i = 0; i < N; ++i) {
+            result[i] = rhs[this->permutation[i]];
+            for (size_t j = 0; j < i; ++j) {
+                const auto factor = this->lu[i][j];
+                for (size_t column = 0; column < K; ++column) {
+                    result[i][column] -= factor * result[j][column];
+                }
+            }
+        }
+
+        for (size_t i = N; i-- > 0;) {
+            for (size_t j = i + 1; j < N; ++j) {
+                const auto factor = this->lu[i][j];
+                for (size_t column = 0; column < K; ++column) {
+                    result[i][column] -= factor * result[j][column];
+                }
+            }
+
+            const auto pivot = this->lu[i][i];
+            for (size_t column = 0; column < K; ++column) {
+                result[i][column] /= pivot;
+            }
+        }
+
+        return result;
+    }
+
+    /**
+     * \brief Returns the unit lower triangular factor `L`.
+     */
+    [[nodiscard]] constexpr auto lower() const -> Matrix<T, N, N> {
+        auto result = Matrix<T, N, N>::identity();
+        for (size_t i = 0; i < N; ++i) {
+            for (size_t j = 0; j < i; ++j) {
+                result[i][j] = this->lu[i][j];
+            }
+        }
+        return result;
+    }
+
+    /**
+     * \brief Returns the upper triangular factor `U`.
+     */
+    [[nodiscard]] constexpr auto upper() const -> Matrix<T, N, N> {
+        auto result = Matrix<T, N, N>::zero();
+        for (size_t i = 0; i < N; ++i) {
+            for (size_t j = i; j < N; ++j) {
+                result[i][j] = this->lu[i][j];
+            }
+        }
+        return result;
+    }
+
+    /**
+     * \brief Returns the row permutation, where row `i` of `P * A` is row
+     * `pivots()[i]` of `A`.
+     */
+    [[nodiscard]] constexpr auto pivots() const
+        -> const std::array<size_t, N>& {
+        return this->permutation;
+    }
+    // NOLINTEND(cppcoreguidelines-pro-bounds-constant-array-index)
+
+private:
+    Matrix<T, N, N> lu;
+    std::array<size_t, N> permutation{};
+    T sign = T{1};
+    bool singular = false;
+
+    [[nodiscard]] constexpr static auto absolute(T value) -> T {
+        return value < T{0} ? -value : value;
+    }
+};
+
+}  // namespace Luminol::Maths
@@ -0,0 +1,333 @@
+#pragma once
+
+#include <concepts>
+#include <functional>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include <LuminolMaths/Matrix.hpp>
+#include <LuminolMaths/Vector.hpp>
+
+/**
+ * An opt-in layer of lazy element-wise expressions over `Vector` and
+ * `Matrix`.
+ *
+ * The eager operators of `Vector` and `Matrix` materialize a temporary per
+ * operator, so `a + b * s - c` makes three passes and three stores. Wrapping
+ * an operand with `lazy` instead builds an expression tree, and converting
+ * that tree to a `Vector` or `Matrix` evaluates every element once in a single
+ * loop:
+ *
+ * \code
+ * using namespace Luminol::Maths;
+ * const auto result = Vector3{Lazy::lazy(a) + Lazy::lazy(b) * s - c};
+ * \endcode
+ *
+ * Only one operand of each operator needs to be lazy, the other may be a
+ * plain `Vector` or `Matrix` of the same type. Scaling a plain `Vector` is
+ * still eager, so wrap it too, as `b` above. Vectors support `+`, `-`, unary
+ * `-`, component-wise `*` and scaling by a scalar. Matrices support the same
+ * except `*` between two matrices, which stays the matrix product of the
+ * eager API.
+ *
+ * Expressions hold references to their operands, so they must be evaluated
+ * within the full-expression that creates them. Store the evaluated result,
+ * never the expression itself.
+ */
+namespace Luminol::Maths::Lazy {
+
+namespace Detail {
+
+/**
+ * \brief Flat element access to the containers an expression can wrap.
+ */
+template <typename Container>
+struct ContainerTraits {
+    constexpr static auto is_container = false;
+};
+
+template <typename T, size_t N>
+struct ContainerTraits<Vector<T, N>> {
+    using Value = T;
+
+    constexpr static auto is_container = true;
+    constexpr static auto is_vector = true;
+    constexpr static auto size = N;
+
+    [[nodiscard]] constexpr static auto make() -> Vector<T, N> {
+        return Vector<T, N>{};
+    }
+
+    [[nodiscard]] constexpr static auto get(
+        const Vector<T, N>& vector, size_t index
+    ) -> T {
+        return vector[index];
+    }
+
+    constexpr static auto set(Vector<T, N>& vector, size_t index, T value)
+        -> void {
+        vector[index] = value;
+    }
+};
+
+template <typename T, size_t M, size_t N>
+struct ContainerTraits<Matrix<T, M, N>> {
+    using Value = T;
+
+    constexpr static auto is_container = true;
+    constexpr static auto is_vector = false;
+    constexpr static auto size = M * N;
+
+    [[nodiscard]] constexpr static auto make() -> Matrix<T, M, N> {
+        return Matrix<T, M, N>::zero();
+    }
+
+    [[nodiscard]] constexpr static auto get(
+        const Matrix<T, M, N>& matrix, size_t index
+    ) -> T {
+        return matrix[index / N][index % N];
+    }
+
+    constexpr static auto set(
+        Matrix<T, M, N>& matrix, size_t index, T value
+    ) -> void {
+        matrix[index / N][index % N] = value;
+    }
+};
+
+template <typename Container>
+concept Wrappable = ContainerTraits<Container>::is_container;
+
+}  // namespace Detail
+
+/**
+ * \brief The base of every expression node, which evaluates the node into its
+ * `Result` container.
+ * \tparam Derived The expression node type.
+ * \tparam ResultT The `Vector` or `Matrix` the expression evaluates to.
+ */
+template <typename Derived, Detail::Wrappable ResultT>
+class ExpressionBase {
+public:
+    using Result = ResultT;
+    using Value = typename Detail::ContainerTraits<ResultT>::Value;
+
+    constexpr static auto size = Detail::ContainerTraits<ResultT>::size;
+
+    /**
+     * \brief Evaluates every element of the expression in a single pass.
+     *
+     * The pass is unrolled over compile-time indices, so the bounds checks of
+     * the element accessors fold away and the compiler can vectorize the
+     * fused element-wise operations.
+     */
+    [[nodiscard]] constexpr auto eval() const -> Result {
+        return this->eval(std::make_index_sequence<size>{});
+    }
+
+    // NOLINTNEXTLINE(google-explicit-constructor, hicpp-explicit-conversions)
+    [[nodiscard]] constexpr operator Result() const { return this->eval(); }
+
+private:
+    template <size_t... Indices>
+    [[nodiscard]] constexpr auto eval(std::index_sequence<Indices...>) const
+        -> Result {
+        using Traits = Detail::ContainerTraits<Result>;
+
+        const auto& expression = static_cast<const Derived&>(*this);
+
+        auto result = Traits::make();
+        (Traits::set(result, Indices, expression[Indices]), ...);
+        return result;
+    }
+};
+
+template <typename E>
+concept Expression = requires {
+    typename E::Result;
+    requires std::derived_from<E, ExpressionBase<E, typename E::Result>>;
+};
+
+template <typename E>
+concept Operand = Expression<E> || Detail::Wrappable<E>;
+
+/**
+ * \brief A leaf of the expression, referencing a `Vector` or `Matrix`.
+ */
+template <Detail::Wrappable Container>
+class Terminal : public ExpressionBase<Terminal<Container>, Container> {
+public:
+    [[nodiscard]] constexpr explicit Terminal(const Container& container)
+        : container{container} {}
+
+    [[nodiscard]] constexpr auto operator[](size_t index) const {
+        return Detail::ContainerTraits<Container>::get(this->container, index);
+    }
+
+private:
+    const Container& container;
+};
+
+/**
+ * \brief Applies `Operation` to the matching elements of two expressions.
+ */
+template <typename Operation, Expression Lhs, Expression Rhs>
+    requires std::same_as<typename Lhs::Result, typename Rhs::Result>
+class Binary
+    : public ExpressionBase<Binary<Operation, Lhs, Rhs>, typename Lhs::Result> {
+public:
+    [[nodiscard]] constexpr Binary(const Lhs& lhs, const Rhs& rhs)
+        : lhs{lhs}, rhs{rhs} {}
+
+    [[nodiscard]] constexpr auto operator[](size_t index) const {
+        return Operation{}(this->lhs[index], this->rhs[index]);
+    }
+
+private:
+    Lhs lhs;
+    Rhs rhs;
+};
+
+/**
+ * \brief Applies `Operation` to every element of an expression and a scalar.
+ */
+template <typename Operation, Expression Lhs>
+class Scalar
+    : public ExpressionBase<Scalar<Operation, Lhs>, typename Lhs::Result> {
+public:
+    [[nodiscard]] constexpr Scalar(const Lhs& lhs, typename Lhs::Value scalar)
+        : lhs{lhs}, scalar{scalar} {}
+
+    [[nodiscard]] constexpr auto operator[](size_t index) const {
+        return Operation{}(this->lhs[index], this->scalar);
+    }
+
+private:
+    Lhs lhs;
+    typename Lhs::Value scalar;
+};
+
+/**
+ * \brief Applies `Operation` to every element of an expression.
+ */
+template <typename Operation, Expression Inner>
+class Unary
+    : public ExpressionBase<Unary<Operation, Inner>, typename Inner::Result> {
+public:
+    [[nodiscard]] constexpr explicit Unary(const Inner& operand)
+        : operand{operand} {}
+
+    [[nodiscard]] constexpr auto operator[](size_t index) const {
+        return Operation{}(this->operand[index]);
+    }
+
+private:
+    Inner operand;
+};
+
+/**
+ * \brief Starts a lazy expression from a `Vector` or `Matrix`.
+ * \param container The vector or matrix, which must outlive the expression.
+ */
+template <Detail::Wrappable Container>
+[[nodiscard]] constexpr auto lazy(const Container& container)
+    -> Terminal<Container> {
+    return Terminal<Container>{container};
+}
+
+/// Expressions only reference their operands, so temporaries would dangle.
+template <Detail::Wrappable Container>
+auto lazy(const Container&& container) -> Terminal<Container> = delete;
+
+namespace Detail {
+
+template <Operand E>
+[[nodiscard]] constexpr auto as_expression(const E& operand) {
+    if constexpr (Expression<E>) {
+        return operand;
+    } else {
+        return Terminal<E>{operand};
+    }
+}
+
+template <Operand E>
+using AsExpression = decltype(as_expression(std::declval<const E&>()));
+
+/// At least one side is lazy, so the eager operators keep handling the rest.
+template <typename Lhs, typename Rhs>
+concept LazyOperands =
+    Operand<Lhs> && Operand<Rhs> && (Expression<Lhs> || Expression<Rhs>) &&
+    std::same_as<
+        typename AsExpression<Lhs>::Result,
+        typename AsExpression<Rhs>::Result>;
+
+template <typename Operation, typename Lhs, typename Rhs>
+[[nodiscard]] constexpr auto make_binary(const Lhs& lhs, const Rhs& rhs) {
+    return Binary<Operation, AsExpression<Lhs>, AsExpression<Rhs>>{
+        as_expression(lhs), as_expression(rhs)
+    };
+}
+
+}  // namespace Detail
+
+template <typename Lhs, typename Rhs>
+    requires Detail::LazyOperands<Lhs, Rhs>
+[[nodiscard]] constexpr auto operator+(const Lhs& lhs, const Rhs& rhs) {
+    return Detail::make_binary<std::plus<>>(lhs, rhs);
+}
+
+template <typename Lhs, typename Rhs>
+    requires Detail::LazyOperands<Lhs, Rhs>
+[[nodiscard]] constexpr auto operator-(const Lhs& lhs, const Rhs& rhs) {
+    return Detail::make_binary<std::minus<>>(lhs, rhs);
+}
+
+/**
+ * \brief Multiplies two vector expressions component-wise, like
+ * `Vector::operator*`.
+ */
+template <typename Lhs, typename Rhs>
+    requires Detail::LazyOperands<Lhs, Rhs> &&
+             Detail::ContainerTraits<
+                 typename Detail::AsExpression<Lhs>::Result>::is_vector
+[[nodiscard]] constexpr auto operator*(const Lhs& lhs, const Rhs& rhs) {
+    return Detail::make_binary<std::multiplies<>>(lhs, rhs);
+}
+
+template <Expression E>
+[[nodiscard]] constexpr auto operator*(
+    const E& expression, typename E::Value scalar
+) {
+    return Scalar<std::multiplies<>, E>{expression, scalar};
+}
+
+template <Expression E>
+[[nodiscard]] constexpr auto operator*(
+    typename E::Value scalar, const E& expression
+) {
+    return Scalar<std::multiplies<>, E>{expression, scalar};
+}
+
+/**
+ * \brief Divides every element of an expression by a scalar.
+ * \pre scalar != 0
+ * \throw std::runtime_error If the scalar is 0, like `Vector::operator/`.
+ */
+template <Expression E>
+[[nodiscard]] constexpr auto operator/(
+    const E& expression, typename E::Value scalar
+) {
+    if (scalar == 0) {
+        throw std::runtime_error("Cannot divide by zero");
+    }
+
+    return Scalar<std::divides<>, E>{expression, scalar};
+}
+
+template <Expression E>
+[[nodiscard]] constexpr auto operator-(const E& expression) {
+    return Unary<std::negate<>, E>{expression};
+}
+
+}  // namespace Luminol::Maths::Lazy
@@ -1,11 +1,22 @@
 #pragma once
 
 #include <array>
+#include <type_traits>
+#include <utility>
+
+#include <LuminolMaths/Config.hpp>
+#include <LuminolMaths/Simd.hpp>
+#include <LuminolMaths/Vector.hpp>
 
 namespace Luminol::Maths {
 
 /**
  * A row-major matrix class.
+ *
+ * When the library is built with `LUMINOL_MATHS_ENABLE_SIMD`, the arithmetic
+ * and transpose of `Matrix<float, 4, 4>`, and float products whose result has
+ * three or four columns and whose inner dimension is at most four, use SSE
+ * kernels at runtime. Constant evaluation always uses the scalar loops.
  */
 template <typename T, size_t M, size_t N>
 class Matrix {
@@ -43,6 +54,14 @@ public:
 
     [[nodiscard]] constexpr auto transpose() const -> Matrix<T, N, M> {
         auto result = Matrix<T, N, M>::zero();
+
+        if constexpr (requires { Kernels::transpose; }) {
+            if (!std::is_constant_evaluated()) {
+                Kernels::transpose(this->data(), result.data());
+                return result;
+            }
+        }
+
         for (size_t i = 0; i < M; ++i) {
             for (size_t j = 0; j < N; ++j) {
                 result[j][i] = this->matrix[i][j];
@@ -95,21 +114,38 @@ public:
         return cofactor_matrix;
     }
 
+    /**
+     * \brief Returns the determinant of the matrix. Sizes up to 4x4 use closed
+     * forms, larger sizes expand along the first row.
+     */
     [[nodiscard]] constexpr auto determinant() const -> T
         requires(M == N)
     {
+        // NOLINTBEGIN(readability-identifier-length)
+        const auto& a = this->matrix;
+
         if constexpr (M == 1) {
-            return this->matrix[0][0];
+            return a[0][0];
         } else if constexpr (M == 2) {
-            return (this->matrix[0][0] * this->matrix[1][1]) -
-                   (this->matrix[0][1] * this->matrix[1][0]);
+            return (a[0][0] * a[1][1]) - (a[0][1] * a[1][0]);
+        } else if constexpr (M == 3) {
+            return a[0][0] * (a[1][1] * a[2][2] - a[1][2] * a[2][1]) +
+                   a[0][1] * (a[1][2] * a[2][0] - a[1][0] * a[2][2]) +
+                   a[0][2] * (a[1][0] * a[2][1] - a[1][1] * a[2][0]);
+        } else if constexpr (M == 4) {
+            const auto [s, c] = this->sub_determinants_4x4();
+
+            return s[0] * c[5] - s[1] * c[4] + s[2] * c[3] + s[3] * c[2] -
+                   s[4] * c[1] + s[5] * c[0];
         } else {
             auto result = T{0};
             for (size_t i = 0; i < M; ++i) {
-                result += this->matrix[0][i] * this->cofactor()[0][i];
+                const auto sign = (i % 2 == 0) ? T{1} : T{-1};
+                result += a[0][i] * sign * this->minor(0, i).determinant();
             }
             return result;
         }
+        // NOLINTEND(readability-identifier-length)
     }
 
     [[nodiscard]] constexpr auto adjugate() const -> Matrix
@@ -118,32 +154,145 @@ public:
         return this->cofactor().transpose();
     }
 
+    /**
+     * \brief Returns the inverse of the matrix. Sizes up to 4x4 use closed
+     * forms that never build the cofactor matrix, larger sizes divide the
+     * adjugate by the determinant.
+     * \return The inverse of the matrix.
+     * \return A zero matrix if the matrix is singular.
+     */
     [[nodiscard]] constexpr auto inverse() const -> Matrix
         requires(M == N)
     {
-        const auto det = this->determinant();
-        if (det == T{0}) {
-            return Matrix::zero();
+        if constexpr (M <= 4) {
+            return this->closed_form_inverse();
+        } else {
+            const auto det = this->determinant();
+            if (det == T{0}) {
+                return Matrix::zero();
+            }
+
+            return this->adjugate() / det;
+        }
+    }
+
+    /**
+     * \brief Returns the inverse of an affine transformation matrix, such as
+     * the ones built by `Transform::translate`, `Transform::rotate_*` and
+     * `Transform::scale`, or products of them.
+     *
+     * Following the row vector convention of `Transform`, the matrix is
+     * `[L 0; t 1]` where `L` is the linear part and `t` the translation. Its
+     * inverse is `[L^-1 0; -t * L^-1 1]`, so only the linear part is inverted.
+     *
+     * \pre M == N && (M == 3 || M == 4)
+     * \pre The last column of the matrix is `[0, ..., 0, 1]`.
+     * \return The inverse of the matrix.
+     * \return A zero matrix if the linear part is singular.
+     */
+    [[nodiscard]] constexpr auto affine_inverse() const -> Matrix
+        requires(M == N && (M == 3 || M == 4))
+    {
+        constexpr auto L = M - 1;
+
+        const auto linear_inverse = this->minor(L, L).inverse();
+
+        auto result = Matrix::zero();
+
+        for (size_t i = 0; i < L; ++i) {
+            for (size_t j = 0; j < L; ++j) {
+                result.matrix[i][j] = linear_inverse[i][j];
+            }
+        }
+
+        if (linear_inverse == Matrix<T, L, L>::zero()) {
+            return result;
+        }
+
+        for (size_t j = 0; j < L; ++j) {
+            auto translation = T{0};
+            for (size_t k = 0; k < L; ++k) {
+                translation -= this->matrix[L][k] * linear_inverse[k][j];
+            }
+            result.matrix[L][j] = translation;
         }
 
-        return this->adjugate() / det;
+        result.matrix[L][L] = T{1};
+
+        return result;
     }
 
-    [[nodiscard]] constexpr auto operator[](size_t index) -> std::array<T, N>& {
-        return this->matrix.at(index);
+    /**
+     * \brief Returns the row at the given index.
+     * \param index The index of the row to return.
+     * \pre index < M
+     * \throw std::out_of_range If the index is out of range and
+     * `Config::checked_access` is enabled, otherwise the behavior is undefined.
+     * \return The row at the given index.
+     */
+    [[nodiscard]] constexpr auto operator[](size_t index)
+        noexcept(!Config::checked_access) -> std::array<T, N>& {
+        if constexpr (Config::checked_access) {
+            return this->matrix.at(index);
+        } else {
+            return this->matrix[index];
+        }
     }
 
+    /**
+     * \brief Returns the row at the given index.
+     * \param index The index of the row to return.
+     * \pre index < M
+     * \throw std::out_of_range If the index is out of range and
+     * `Config::checked_access` is enabled, otherwise the behavior is undefined.
+     * \return The row at the given index.
+     */
     [[nodiscard]] constexpr auto operator[](size_t index) const
-        -> const std::array<T, N>& {
-        return this->matrix.at(index);
+        noexcept(!Config::checked_access) -> const std::array<T, N>& {
+        if constexpr (Config::checked_access) {
+            return this->matrix.at(index);
+        } else {
+            return this->matrix[index];
+        }
     }
 
+    static_assert(
+        sizeof(MatrixType) == sizeof(T) * M * N,
+        "The rows of a matrix must be tightly packed"
+    );
+
+    // NOLINTBEGIN(cppcoreguidelines-pro-type-reinterpret-cast)
+    /**
+     * \brief Returns a pointer to the M * N contiguous elements of the matrix
+     * in row-major order, for iterating over them without per-element checks.
+     */
+    [[nodiscard]] auto data() noexcept -> T* {
+        return reinterpret_cast<T*>(this->matrix.data());
+    }
+
+    /**
+     * \brief Returns a pointer to the M * N contiguous elements of the matrix
+     * in row-major order, for iterating over them without per-element checks.
+     */
+    [[nodiscard]] auto data() const noexcept -> const T* {
+        return reinterpret_cast<const T*>(this->matrix.data());
+    }
+    // NOLINTEND(cppcoreguidelines-pro-type-reinterpret-cast)
+
     [[nodiscard]] constexpr auto operator+(const Matrix& other) const
         -> Matrix {
         auto result = Matrix::zero();
+
+        if constexpr (requires { Kernels::add; }) {
+            if (!std::is_constant_evaluated()) {
+                Kernels::add(this->data(), other.data(), result.data());
+                return result;
+            }
+        }
+
         for (size_t i = 0; i < M; ++i) {
             for (size_t j = 0; j < N; ++j) {
-                result.matrix.at(i).at(j) =
+                result.matrix[i][j] =
                     this->matrix[i][j] + other.matrix[i][j];
             }
         }
@@ -153,6 +302,14 @@ public:
     [[nodiscard]] constexpr auto operator-(const Matrix& other) const
         -> Matrix {
         auto result = Matrix::zero();
+
+        if constexpr (requires { Kernels::subtract; }) {
+            if (!std::is_constant_evaluated()) {
+                Kernels::subtract(this->data(), other.data(), result.data());
+                return result;
+            }
+        }
+
         for (size_t i = 0; i < M; ++i) {
             for (size_t j = 0; j < N; ++j) {
                 result.matrix[i][j] = this->matrix[i][j] - other.matrix[i][j];
@@ -161,22 +318,75 @@ public:
         return result;
     }
 
-    [[nodiscard]] constexpr auto operator*(const Matrix& other) const
-        -> Matrix {
-        auto result = Matrix::zero();
+    /**
+     * \brief Returns the product of this matrix and a matrix with as many rows
+     * as this matrix has columns.
+     * \param other The right-hand side of the product.
+     * \return The `M`x`K` product.
+     */
+    template <size_t K>
+    [[nodiscard]] constexpr auto operator*(const Matrix<T, N, K>& other) const
+        -> Matrix<T, M, K> {
+        auto result = Matrix<T, M, K>::zero();
+
+        using ProductKernels = Simd::ProductKernels<T, M, N, K>;
+
+        if constexpr (requires { ProductKernels::multiply; }) {
+            if (!std::is_constant_evaluated()) {
+                ProductKernels::multiply(
+                    this->data(), other.data(), result.data()
+                );
+                return result;
+            }
+        }
+
+        // Accumulates whole rows of the result, which keeps them in registers
+        // and lets the compiler vectorize along j.
         for (size_t i = 0; i < M; ++i) {
-            for (size_t j = 0; j < N; ++j) {
-                for (size_t k = 0; k < N; ++k) {
-                    result.matrix[i][j] +=
-                        this->matrix[i][k] * other.matrix[k][j];
+            auto& row = result.matrix[i];
+            for (size_t k = 0; k < N; ++k) {
+                const auto element = this->matrix[i][k];
+                for (size_t j = 0; j < K; ++j) {
+                    row[j] += element * other.matrix[k][j];
                 }
             }
         }
         return result;
     }
 
+    /**
+     * \brief Returns the product of this matrix and the column vector
+     * `vector`. Note that `Transform` uses row vectors, see
+     * `operator*(const Vector<T, M>&, const Matrix<T, M, N>&)` for those.
+     * \param vector The column vector.
+     * \pre M <= 4
+     * \return The `Vector<T, M>` product.
+     */
+    template <size_t Size>
+        requires(Size == N && M <= 4)
+    [[nodiscard]] constexpr auto operator*(const Vector<T, Size>& vector
+    ) const {
+        auto result = Vector<T, M>{};
+        for (size_t i = 0; i < M; ++i) {
+            auto value = T{0};
+            for (size_t j = 0; j < N; ++j) {
+                value += this->matrix[i][j] * vector[j];
+            }
+            result[i] = value;
+        }
+        return result;
+    }
+
     [[nodiscard]] constexpr auto operator*(T scalar) const -> Matrix {
         auto result = Matrix::zero();
+
+        if constexpr (requires { Kernels::scale; }) {
+            if (!std::is_constant_evaluated()) {
+                Kernels::scale(this->data(), scalar, result.data());
+                return result;
+            }
+        }
+
         for (size_t i = 0; i < M; ++i) {
             for (size_t j = 0; j < N; ++j) {
                 result.matrix[i][j] = this->matrix[i][j] * scalar;
@@ -224,15 +434,8 @@ public:
         return *this;
     }
 
-    constexpr auto operator*=(const Matrix& other) -> Matrix& {
-        for (size_t i = 0; i < M; ++i) {
-            for (size_t j = 0; j < N; ++j) {
-                for (size_t k = 0; k < N; ++k) {
-                    this->matrix[i][j] +=
-                        this->matrix[i][k] * other.matrix[k][j];
-                }
-            }
-        }
+    constexpr auto operator*=(const Matrix<T, N, N>& other) -> Matrix& {
+        *this = *this * other;
         return *this;
     }
 
@@ -256,9 +459,183 @@ public:
     // NOLINTEND(cppcoreguidelines-pro-bounds-constant-array-index)
 
 private:
+    template <typename OtherT, size_t OtherM, size_t OtherN>
+    friend class Matrix;
+
+    template <typename U, size_t Rows, size_t Columns>
+        requires(Rows <= 4 && Columns <= 4)
+    friend constexpr auto operator*(
+        const Vector<U, Rows>& vector, const Matrix<U, Rows, Columns>& matrix
+    ) -> Vector<U, Columns>;
+
+    // NOLINTBEGIN(readability-identifier-length)
+    /**
+     * \brief Returns the six 2x2 determinants of the upper two rows and the
+     * six of the lower two rows, shared by the 4x4 determinant and inverse.
+     */
+    [[nodiscard]] constexpr auto sub_determinants_4x4() const
+        -> std::pair<std::array<T, 6>, std::array<T, 6>>
+        requires(M == 4 && N == 4)
+    {
+        const auto& a = this->matrix;
+
+        return {
+            std::array{
+                a[0][0] * a[1][1] - a[1][0] * a[0][1],
+                a[0][0] * a[1][2] - a[1][0] * a[0][2],
+                a[0][0] * a[1][3] - a[1][0] * a[0][3],
+                a[0][1] * a[1][2] - a[1][1] * a[0][2],
+                a[0][1] * a[1][3] - a[1][1] * a[0][3],
+                a[0][2] * a[1][3] - a[1][2] * a[0][3],
+            },
+            std::array{
+                a[2][0] * a[3][1] - a[3][0] * a[2][1],
+                a[2][0] * a[3][2] - a[3][0] * a[2][2],
+                a[2][0] * a[3][3] - a[3][0] * a[2][3],
+                a[2][1] * a[3][2] - a[3][1] * a[2][2],
+                a[2][1] * a[3][3] - a[3][1] * a[2][3],
+                a[2][2] * a[3][3] - a[3][2] * a[2][3],
+            },
+        };
+    }
+
+    /**
+     * \brief Returns the inverse of a matrix of up to 4x4 from its closed
+     * form adjugate. The adjugate is divided by the determinant rather than
+     * multiplied by its reciprocal, so exact results stay exact.
+     */
+    [[nodiscard]] constexpr auto closed_form_inverse() const -> Matrix
+        requires(M == N && M <= 4)
+    {
+        const auto& a = this->matrix;
+
+        auto det = T{0};
+        auto adjugate = MatrixType{};
+
+        if constexpr (M == 1) {
+            det = a[0][0];
+            adjugate = {Row{T{1}}};
+        } else if constexpr (M == 2) {
+            det = this->determinant();
+            adjugate = {
+                Row{a[1][1], -a[0][1]},
+                Row{-a[1][0], a[0][0]},
+            };
+        } else if constexpr (M == 3) {
+            adjugate = {
+                Row{
+                    a[1][1] * a[2][2] - a[1][2] * a[2][1],
+                    a[0][2] * a[2][1] - a[0][1] * a[2][2],
+                    a[0][1] * a[1][2] - a[0][2] * a[1][1],
+                },
+                Row{
+                    a[1][2] * a[2][0] - a[1][0] * a[2][2],
+                    a[0][0] * a[2][2] - a[0][2] * a[2][0],
+                    a[0][2] * a[1][0] - a[0][0] * a[1][2],
+                },
+                Row{
+                    a[1][0] * a[2][1] - a[1][1] * a[2][0],
+                    a[0][1] * a[2][0] - a[0][0] * a[2][1],
+                    a[0][0] * a[1][1] - a[0][1] * a[1][0],
+                },
+            };
+            det = a[0][0] * adjugate[0][0] + a[0][1] * adjugate[1][0] +
+                  a[0][2] * adjugate[2][0];
+        } else {
+            const auto [s, c] = this->sub_determinants_4x4();
+
+            det = s[0] * c[5] - s[1] * c[4] + s[2] * c[3] + s[3] * c[2] -
+                  s[4] * c[1] + s[5] * c[0];
+
+            adjugate = {
+                Row{
+                    a[1][1] * c[5] - a[1][2] * c[4] + a[1][3] * c[3],
+                    -a[0][1] * c[5] + a[0][2] * c[4] - a[0][3] * c[3],
+                    a[3][1] * s[5] - a[3][2] * s[4] + a[3][3] * s[3],
+                    -a[2][1] * s[5] + a[2][2] * s[4] - a[2][3] * s[3],
+                },
+                Row{
+                    -a[1][0] * c[5] + a[1][2] * c[2] - a[1][3] * c[1],
+                    a[0][0] * c[5] - a[0][2] * c[2] + a[0][3] * c[1],
+                    -a[3][0] * s[5] + a[3][2] * s[2] - a[3][3] * s[1],
+                    a[2][0] * s[5] - a[2][2] * s[2] + a[2][3] * s[1],
+                },
+                Row{
+                    a[1][0] * c[4] - a[1][1] * c[2] + a[1][3] * c[0],
+                    -a[0][0] * c[4] + a[0][1] * c[2] - a[0][3] * c[0],
+                    a[3][0] * s[4] - a[3][1] * s[2] + a[3][3] * s[0],
+                    -a[2][0] * s[4] + a[2][1] * s[2] - a[2][3] * s[0],
+                },
+                Row{
+                    -a[1][0] * c[3] + a[1][1] * c[1] - a[1][2] * c[0],
+                    a[0][0] * c[3] - a[0][1] * c[1] + a[0][2] * c[0],
+                    -a[3][0] * s[3] + a[3][1] * s[1] - a[3][2] * s[0],
+                    a[2][0] * s[3] - a[2][1] * s[1] + a[2][2] * s[0],
+                },
+            };
+        }
+
+        if (det == T{0}) {
+            return Matrix::zero();
+        }
+
+        for (auto& row : adjugate) {
+            for (auto& element : row) {
+                element /= det;
+            }
+        }
+
+        return Matrix{adjugate};
+    }
+    // NOLINTEND(readability-identifier-length)
+
+    /// The SSE kernels for this matrix, only specialized for 4x4 floats.
+    using Kernels = Simd::MatrixKernels<T, M, N>;
+
     MatrixType matrix;
 };
 
+/**
+ * \brief Returns the product of the row vector `vector` and the matrix, the
+ * convention `Transform` uses.
+ * \param vector The row vector.
+ * \param matrix The matrix.
+ * \return The `Vector<T, N>` product.
+ */
+template <typename T, size_t M, size_t N>
+    requires(M <= 4 && N <= 4)
+[[nodiscard]] constexpr auto operator*(
+    const Vector<T, M>& vector, const Matrix<T, M, N>& matrix
+) -> Vector<T, N> {
+    auto result = Vector<T, N>{};
+
+    using Kernels = Simd::MatrixKernels<T, M, N>;
+
+    if constexpr (requires { Kernels::transform_vectors4; }) {
+        static_assert(sizeof(Vector<T, M>) == sizeof(T) * M);
+
+        if (!std::is_constant_evaluated()) {
+            Kernels::transform_vectors4(
+                matrix.data(),
+                reinterpret_cast<const T*>(&vector),
+                reinterpret_cast<T*>(&result),
+                1
+            );
+            return result;
+        }
+    }
+
+    // NOLINTBEGIN(cppcoreguidelines-pro-bounds-constant-array-index)
+    for (size_t k = 0; k < M; ++k) {
+        const auto element = vector[k];
+        for (size_t j = 0; j < N; ++j) {
+            result[j] += element * matrix.matrix[k][j];
+        }
+    }
+    // NOLINTEND(cppcoreguidelines-pro-bounds-constant-array-index)
+    return result;
+}
+
 using Matrix2x2 = Matrix<double, 2, 2>;
 using Matrix2x2f = Matrix<float, 2, 2>;
 using Matrix3x3 = Matrix<double, 3, 3>;
@@ -0,0 +1,201 @@
+#include <LuminolMaths/MemoryResource.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <new>
+#include <stdexcept>
+
+namespace Luminol::Maths {
+
+namespace {
+
+[[nodiscard]] auto is_power_of_two(size_t value) -> bool {
+    return value != 0 && (value & (value - 1)) == 0;
+}
+
+/// Rounds `value` up to a multiple of `alignment`, a power of two.
+[[nodiscard]] auto round_up(size_t value, size_t alignment) -> size_t {
+    if (value > std::numeric_limits<size_t>::max() - (alignment - 1)) {
+        throw std::bad_alloc{};
+    }
+    return (value + alignment - 1) & ~(alignment - 1);
+}
+
+}  // namespace
+
+ArenaResource::ArenaResource(
+    size_t block_size, size_t alignment, std::pmr::memory_resource* upstream
+)
+    : block_size{block_size}, alignment{alignment}, upstream{upstream} {
+    if (block_size == 0) {
+        throw std::invalid_argument("Block size must not be 0");
+    }
+    if (!is_power_of_two(alignment)) {
+        throw std::invalid_argument("Alignment must be a power of two");
+    }
+}
+
+ArenaResource::~ArenaResource() { this->release(); }
+
+auto ArenaResource::release() noexcept -> void {
+    for (const auto& block : this->blocks) {
+        this->upstream->deallocate(block.data, block.size, block.alignment);
+    }
+    this->blocks.clear();
+    this->current = 0;
+    this->offset = 0;
+}
+
+auto ArenaResource::used() const noexcept -> size_t {
+    auto bytes = this->offset;
+    for (size_t i = 0; i < this->current && i < this->blocks.size(); ++i) {
+        bytes += this->blocks[i].size;
+    }
+    return bytes;
+}
+
+auto ArenaResource::capacity() const noexcept -> size_t {
+    auto bytes = size_t{0};
+    for (const auto& block : this->blocks) {
+        bytes += block.size;
+    }
+    return bytes;
+}
+
+auto ArenaResource::do_allocate(size_t bytes, size_t alignment) -> void* {
+    alignment = std::max(alignment, this->alignment);
+
+    // Walk through the blocks kept by reset before growing the arena, the
+    // blocks too small for this allocation are skipped until the next reset.
+    while (this->current < this->blocks.size()) {
+        const auto& block = this->blocks[this->current];
+
+        const auto address =
+            reinterpret_cast<uintptr_t>(block.data) + this->offset;
+        const auto padding = (alignment - address % alignment) % alignment;
+
+        if (padding <= block.size - this->offset &&
+            bytes <= block.size - this->offset - padding) {
+            this->offset += padding + bytes;
+            return block.data + (this->offset - bytes);
+        }
+
+        ++this->current;
+        this->offset = 0;
+    }
+
+    // Doubling the blocks keeps their number logarithmic in the working set.
+    const auto previous_size =
+        this->blocks.empty() ? this->block_size / 2 : this->blocks.back().size;
+    const auto size = std::max(
+        round_up(bytes, this->alignment),
+        std::max(this->block_size, previous_size * 2)
+    );
+
+    // Reserved first, so a failing push_back cannot leak the block.
+    this->blocks.reserve(this->blocks.size() + 1);
+    auto* data =
+        static_cast<std::byte*>(this->upstream->allocate(size, alignment));
+    this->blocks.push_back({data, size, alignment});
+
+    this->current = this->blocks.size() - 1;
+    this->offset = bytes;
+    return data;
+}
+
+auto ArenaResource::do_deallocate(
+    void* /*pointer*/, size_t /*bytes*/, size_t /*alignment*/
+) -> void {}
+
+auto ArenaResource::do_is_equal(const std::pmr::memory_resource& other
+) const noexcept -> bool {
+    return this == &other;
+}
+
+PoolResource::PoolResource(
+    size_t block_size,
+    size_t blocks_per_chunk,
+    size_t alignment,
+    std::pmr::memory_resource* upstream
+)
+    : block_size{block_size},
+      blocks_per_chunk{blocks_per_chunk},
+      alignment{alignment},
+      upstream{upstream} {
+    if (block_size == 0 || blocks_per_chunk == 0) {
+        throw std::invalid_argument("Block size and count must not be 0");
+    }
+    if (!is_power_of_two(alignment)) {
+        throw std::invalid_argument("Alignment must be a power of two");
+    }
+
+    // Free blocks hold the link to the next one.
+    this->alignment = std::max(alignment, alignof(FreeBlock));
+    this->block_size =
+        round_up(std::max(block_size, sizeof(FreeBlock)), this->alignment);
+
+    if (this->block_size >
+        std::numeric_limits<size_t>::max() / this->blocks_per_chunk) {
+        throw std::invalid_argument("Chunk size overflows");
+    }
+}
+
+PoolResource::~PoolResource() { this->release(); }
+
+auto PoolResource::release() noexcept -> void {
+    const auto chunk_size = this->block_size * this->blocks_per_chunk;
+    for (auto* chunk : this->chunks) {
+        this->upstream->deallocate(chunk, chunk_size, this->alignment);
+    }
+    this->chunks.clear();
+    this->free_list = nullptr;
+}
+
+auto PoolResource::do_allocate(size_t bytes, size_t alignment) -> void* {
+    if (!this->is_pooled(bytes, alignment)) {
+        return this->upstream->allocate(
+            bytes, std::max(alignment, this->alignment)
+        );
+    }
+
+    if (this->free_list == nullptr) {
+        const auto chunk_size = this->block_size * this->blocks_per_chunk;
+
+        this->chunks.reserve(this->chunks.size() + 1);
+        auto* chunk = static_cast<std::byte*>(
+            this->upstream->allocate(chunk_size, this->alignment)
+        );
+        this->chunks.push_back(chunk);
+
+        // Linked in reverse, so the blocks are handed out in address order.
+        for (size_t i = this->blocks_per_chunk; i > 0; --i) {
+            auto* block = chunk + (i - 1) * this->block_size;
+            this->free_list = new (block) FreeBlock{this->free_list};
+        }
+    }
+
+    auto* block = this->free_list;
+    this->free_list = block->next;
+    return block;
+}
+
+auto PoolResource::do_deallocate(
+    void* pointer, size_t bytes, size_t alignment
+) -> void {
+    if (!this->is_pooled(bytes, alignment)) {
+        this->upstream->deallocate(
+            pointer, bytes, std::max(alignment, this->alignment)
+        );
+        return;
+    }
+
+    this->free_list = new (pointer) FreeBlock{this->free_list};
+}
+
+auto PoolResource::do_is_equal(const std::pmr::memory_resource& other
+) const noexcept -> bool {
+    return this == &other;
+}
+
+}  // namespace Luminol::Maths
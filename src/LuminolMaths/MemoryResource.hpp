@@ -0,0 +1,243 @@
+#pragma once
+
+#include <cstddef>
+#include <memory_resource>
+#include <vector>
+
+/**
+ * Memory resources for batch buffers, usable with `std::pmr` containers and
+ * with the allocator parameter of `VectorBatch` and `UnitArray`.
+ *
+ * Both resources align every allocation to at least a cache line, whatever
+ * the alignment requested, because `std::pmr::polymorphic_allocator` only
+ * asks for the alignment of the element type while the SIMD kernels load the
+ * lanes in 16 to 32 byte registers. Neither resource is thread safe, use one
+ * per thread.
+ */
+namespace Luminol::Maths {
+
+/**
+ * \brief A monotonic arena, handing out memory by bumping a pointer through
+ * blocks obtained from an upstream resource.
+ *
+ * Deallocating is a no-op, the memory is reclaimed all at once by `reset`,
+ * which keeps the blocks for the next round of allocations, or down to a
+ * marker by `rewind`. Once the arena has grown to the working set of a frame,
+ * later frames allocate without touching the upstream resource, unlike
+ * `std::pmr::monotonic_buffer_resource` whose `release` frees its blocks.
+ */
+class ArenaResource : public std::pmr::memory_resource {
+public:
+    /// A cache line, the alignment of every allocation by default.
+    constexpr static auto default_alignment = size_t{64};
+
+    /**
+     * \brief A position in the arena, see `mark` and `rewind`.
+     */
+    struct Marker {
+        size_t block = 0;
+        size_t offset = 0;
+    };
+
+    /**
+     * \brief Constructs an empty arena, which allocates its first block on the
+     * first allocation.
+     * \param block_size The size of the first block, later blocks double in
+     * size or fit the allocation requiring them.
+     * \param alignment The minimum alignment of every allocation, a power of
+     * two.
+     * \param upstream The resource providing the blocks.
+     * \throw std::invalid_argument If `block_size` is 0 or `alignment` is not a
+     * power of two.
+     */
+    explicit ArenaResource(
+        size_t block_size = size_t{64} * 1024,
+        size_t alignment = default_alignment,
+        std::pmr::memory_resource* upstream = std::pmr::get_default_resource()
+    );
+
+    ArenaResource(const ArenaResource&) = delete;
+    ArenaResource(ArenaResource&&) = delete;
+    ~ArenaResource() override;
+
+    auto operator=(const ArenaResource&) -> ArenaResource& = delete;
+    auto operator=(ArenaResource&&) -> ArenaResource& = delete;
+
+    /**
+     * \brief Makes the whole arena available again, keeping its blocks.
+     * \pre Nothing allocated from the arena is used anymore.
+     */
+    auto reset() noexcept -> void { this->rewind(Marker{}); }
+
+    /**
+     * \brief Returns the blocks to the upstream resource.
+     * \pre Nothing allocated from the arena is used anymore.
+     */
+    auto release() noexcept -> void;
+
+    /**
+     * \brief Returns the current position of the arena.
+     */
+    [[nodiscard]] auto mark() const noexcept -> Marker {
+        return {this->current, this->offset};
+    }
+
+    /**
+     * \brief Makes the memory allocated since `marker` available again.
+     * \param marker A marker returned by `mark` since the last `reset` or
+     * `release`, and not rewound past.
+     * \pre Nothing allocated since `marker` is used anymore.
+     */
+    auto rewind(Marker marker) noexcept -> void {
+        this->current = marker.block;
+        this->offset = marker.offset;
+    }
+
+    /**
+     * \brief Returns the number of bytes up to the current position, including
+     * padding and the unused ends of the blocks left behind.
+     */
+    [[nodiscard]] auto used() const noexcept -> size_t;
+
+    /**
+     * \brief Returns the total size of the blocks of the arena.
+     */
+    [[nodiscard]] auto capacity() const noexcept -> size_t;
+
+    [[nodiscard]] auto get_alignment() const noexcept -> size_t {
+        return this->alignment;
+    }
+
+    [[nodiscard]] auto upstream_resource() const noexcept
+        -> std::pmr::memory_resource* {
+        return this->upstream;
+    }
+
+protected:
+    /**
+     * \throw std::bad_alloc If the upstream resource cannot provide a block.
+     */
+    auto do_allocate(size_t bytes, size_t alignment) -> void* override;
+
+    auto do_deallocate(void* pointer, size_t bytes, size_t alignment)
+        -> void override;
+
+    [[nodiscard]] auto do_is_equal(const std::pmr::memory_resource& other
+    ) const noexcept -> bool override;
+
+private:
+    struct Block {
+        std::byte* data = nullptr;
+        size_t size = 0;
+        size_t alignment = 0;
+    };
+
+    std::vector<Block> blocks;
+
+    /// The block being allocated from, `blocks.size()` when there is none.
+    size_t current = 0;
+    size_t offset = 0;
+
+    size_t block_size;
+    size_t alignment;
+    std::pmr::memory_resource* upstream;
+};
+
+/**
+ * \brief A pool of fixed-size blocks, recycled through a free list.
+ *
+ * Allocations up to the block size are served from chunks of blocks obtained
+ * from the upstream resource, and deallocating them returns them to the pool,
+ * so objects created and destroyed every frame reuse the same memory. Larger
+ * or more aligned allocations go directly to the upstream resource.
+ */
+class PoolResource : public std::pmr::memory_resource {
+public:
+    /**
+     * \brief Constructs an empty pool.
+     * \param block_size The largest allocation served by the pool, rounded up
+     * to a multiple of `alignment`.
+     * \param blocks_per_chunk The number of blocks requested from the upstream
+     * resource at once.
+     * \param alignment The minimum alignment of every allocation, a power of
+     * two.
+     * \param upstream The resource providing the chunks.
+     * \throw std::invalid_argument If `block_size` or `blocks_per_chunk` is 0,
+     * or `alignment` is not a power of two.
+     */
+    explicit PoolResource(
+        size_t block_size,
+        size_t blocks_per_chunk = 64,
+        size_t alignment = ArenaResource::default_alignment,
+        std::pmr::memory_resource* upstream = std::pmr::get_default_resource()
+    );
+
+    PoolResource(const PoolResource&) = delete;
+    PoolResource(PoolResource&&) = delete;
+    ~PoolResource() override;
+
+    auto operator=(const PoolResource&) -> PoolResource& = delete;
+    auto operator=(PoolResource&&) -> PoolResource& = delete;
+
+    /**
+     * \brief Returns the chunks to the upstream resource.
+     * \pre No block of the pool is used anymore.
+     */
+    auto release() noexcept -> void;
+
+    /**
+     * \brief Returns the size of the blocks, the largest allocation served by
+     * the pool.
+     */
+    [[nodiscard]] auto get_block_size() const noexcept -> size_t {
+        return this->block_size;
+    }
+
+    /**
+     * \brief Returns the number of blocks obtained from the upstream resource.
+     */
+    [[nodiscard]] auto capacity() const noexcept -> size_t {
+        return this->chunks.size() * this->blocks_per_chunk;
+    }
+
+    [[nodiscard]] auto get_alignment() const noexcept -> size_t {
+        return this->alignment;
+    }
+
+    [[nodiscard]] auto upstream_resource() const noexcept
+        -> std::pmr::memory_resource* {
+        return this->upstream;
+    }
+
+protected:
+    /**
+     * \throw std::bad_alloc If the upstream resource cannot provide a chunk.
+     */
+    auto do_allocate(size_t bytes, size_t alignment) -> void* override;
+
+    auto do_deallocate(void* pointer, size_t bytes, size_t alignment)
+        -> void override;
+
+    [[nodiscard]] auto do_is_equal(const std::pmr::memory_resource& other
+    ) const noexcept -> bool override;
+
+private:
+    struct FreeBlock {
+        FreeBlock* next;
+    };
+
+    [[nodiscard]] auto is_pooled(size_t bytes, size_t alignment) const noexcept
+        -> bool {
+        return bytes <= this->block_size && alignment <= this->alignment;
+    }
+
+    std::vector<std::byte*> chunks;
+    FreeBlock* free_list = nullptr;
+
+    size_t block_size;
+    size_t blocks_per_chunk;
+    size_t alignment;
+    std::pmr::memory_resource* upstream;
+};
+
+}  // namespace Luminol::Maths
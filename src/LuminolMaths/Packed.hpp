@@ -0,0 +1,726 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
+#include <concepts>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+#include <LuminolMaths/Simd.hpp>
+#include <LuminolMaths/Vector.hpp>
+#include <LuminolMaths/VectorBatch.hpp>
+
+/**
+ * Compact storage formats for vectors of floats.
+ *
+ * `Vector<Half, N>` stores IEEE 754 half precision components, and
+ * `Vector<Snorm8, N>` and `Vector<Snorm16, N>` store components in [-1, 1]
+ * quantized to signed normalized integers. `OctahedralNormal` stores a unit
+ * vector in 32 bits by projecting it onto an octahedron. These types are only
+ * meant for storage: decode them to `Vector<float, N>` to compute with them.
+ *
+ * The batch overloads of `encode` and `decode` pick the format from the type
+ * of their output. When the library is built with `LUMINOL_MATHS_ENABLE_SIMD`
+ * the snorm conversions use SSE, and the half precision ones use F16C when
+ * the compiler targets it.
+ */
+namespace Luminol::Maths {
+
+namespace Detail {
+
+/**
+ * \brief Returns the bits of the half precision float nearest to `value`,
+ * rounded to nearest even like the F16C instructions.
+ */
+[[nodiscard]] constexpr auto float_to_half_bits(float value) -> uint16_t {
+    const auto bits = std::bit_cast<uint32_t>(value);
+    const auto sign = static_cast<uint16_t>((bits >> 16) & 0x8000U);
+    const auto magnitude = bits & 0x7FFF'FFFFU;
+
+    // Infinities stay infinities and NaNs stay quiet NaNs with the top bits of
+    // their payload.
+    if (magnitude >= 0x7F80'0000U) {
+        const auto payload = magnitude > 0x7F80'0000U
+                                 ? 0x0200U | ((magnitude >> 13) & 0x03FFU)
+                                 : 0U;
+        return static_cast<uint16_t>(sign | 0x7C00U | payload);
+    }
+
+    // 65520 and above round to infinity.
+    if (magnitude >= 0x477F'F000U) {
+        return static_cast<uint16_t>(sign | 0x7C00U);
+    }
+
+    // Below 2^-14 the result is subnormal, and at most 2^-25 it is zero.
+    if (magnitude < 0x3880'0000U) {
+        if (magnitude <= 0x3300'0000U) {
+            return sign;
+        }
+
+        const auto exponent = magnitude >> 23;
+        const auto mantissa = (magnitude & 0x007F'FFFFU) | 0x0080'0000U;
+        const auto shift = 126 - exponent;
+
+        auto result = mantissa >> shift;
+        const auto remainder = mantissa & ((1U << shift) - 1);
+        const auto halfway = 1U << (shift - 1);
+        if (remainder > halfway || (remainder == halfway && (result & 1U))) {
+            ++result;
+        }
+        return static_cast<uint16_t>(sign | result);
+    }
+
+    // Rebias the exponent from 127 to 15, a carry out of the mantissa when
+    // rounding up correctly increments the exponent.
+    auto result = (magnitude - 0x3800'0000U) >> 13;
+    const auto remainder = magnitude & 0x1FFFU;
+    if (remainder > 0x1000U || (remainder == 0x1000U && (result & 1U))) {
+        ++result;
+    }
+    return static_cast<uint16_t>(sign | result);
+}
+
+/**
+ * \brief Returns the float equal to the half precision float with the given
+ * bits, which is always exact.
+ */
+[[nodiscard]] constexpr auto half_bits_to_float(uint16_t bits) -> float {
+    const auto sign = static_cast<uint32_t>(bits & 0x8000U) << 16;
+    const auto exponent = static_cast<uint32_t>(bits >> 10) & 0x1FU;
+    const auto mantissa = static_cast<uint32_t>(bits) & 0x03FFU;
+
+    if (exponent == 0x1FU) {
+        return std::bit_cast<float>(sign | 0x7F80'0000U | (mantissa << 13));
+    }
+
+    if (exponent == 0) {
+        // Subnormals are mantissa * 2^-24, exactly representable as floats.
+        const auto magnitude = static_cast<float>(mantissa) * 0x1P-24F;
+        return sign != 0 ? -magnitude : magnitude;
+    }
+
+    return std::bit_cast<float>(
+        sign | ((exponent + 112) << 23) | (mantissa << 13)
+    );
+}
+
+}  // namespace Detail
+
+/**
+ * \brief An IEEE 754 half precision float, with an 11-bit significand and a
+ * range of +-65504. Only meant for storage, it converts to and from float.
+ */
+class Half {
+public:
+    constexpr Half() = default;
+
+    /**
+     * \brief Constructs the half precision float nearest to `value`, rounded
+     * to nearest even. Values of 65520 and above become infinities.
+     * \param value The float to convert.
+     */
+    constexpr explicit Half(float value)
+        : bits{Detail::float_to_half_bits(value)} {}
+
+    /**
+     * \brief Returns the half precision float with the given bits.
+     * \param bits The IEEE 754 binary16 bits.
+     */
+    [[nodiscard]] constexpr static auto from_bits(uint16_t bits) -> Half {
+        auto half = Half{};
+        half.bits = bits;
+        return half;
+    }
+
+    /**
+     * \brief Returns the IEEE 754 binary16 bits of this half precision float.
+     */
+    [[nodiscard]] constexpr auto get_bits() const -> uint16_t {
+        return this->bits;
+    }
+
+    /**
+     * \brief Returns this half precision float as a float, which is exact.
+     */
+    [[nodiscard]] constexpr explicit operator float() const {
+        return Detail::half_bits_to_float(this->bits);
+    }
+
+    /**
+     * \brief Returns whether the bits of both half precision floats are equal.
+     */
+    [[nodiscard]] constexpr auto operator==(const Half& other) const
+        -> bool = default;
+
+private:
+    uint16_t bits = 0;
+};
+
+/**
+ * \brief A value in [-1, 1] quantized to a signed normalized integer: 1 and
+ * -1 map to plus and minus the largest integer, so 0 is exact and the lowest
+ * integer also decodes to -1. Only meant for storage, it converts to and from
+ * float.
+ *
+ * \tparam I The signed integer storing the value, 8 or 16 bits wide.
+ */
+template <std::signed_integral I>
+    requires(sizeof(I) <= 2)
+class Snorm {
+public:
+    using Integer = I;
+
+    constexpr Snorm() = default;
+
+    /**
+     * \brief Quantizes `value`, clamped to [-1, 1] and rounded to nearest
+     * even. NaN is quantized to -1.
+     * \param value The float to quantize.
+     */
+    explicit Snorm(float value) {
+        // Written so it compiles to maxss/minss, which turn NaN into -1.
+        const auto clamped = std::min(value >= -1.0F ? value : -1.0F, 1.0F);
+        this->bits = static_cast<I>(std::rint(clamped * scale));
+    }
+
+    /**
+     * \brief Returns the snorm with the given integer.
+     * \param bits The signed normalized integer.
+     */
+    [[nodiscard]] constexpr static auto from_bits(I bits) -> Snorm {
+        auto snorm = Snorm{};
+        snorm.bits = bits;
+        return snorm;
+    }
+
+    /**
+     * \brief Returns the signed normalized integer of this snorm.
+     */
+    [[nodiscard]] constexpr auto get_bits() const -> I { return this->bits; }
+
+    /**
+     * \brief Returns this snorm as a float in [-1, 1].
+     */
+    [[nodiscard]] explicit operator float() const {
+        return std::max(static_cast<float>(this->bits) * inverse_scale, -1.0F);
+    }
+
+    [[nodiscard]] constexpr auto operator==(const Snorm& other) const
+        -> bool = default;
+
+private:
+    constexpr static auto scale =
+        static_cast<float>(std::numeric_limits<I>::max());
+    constexpr static auto inverse_scale = 1.0F / scale;
+
+    I bits = 0;
+};
+
+using Snorm8 = Snorm<int8_t>;
+using Snorm16 = Snorm<int16_t>;
+
+/**
+ * \brief A unit vector stored in 32 bits, as the two snorm16 coordinates of
+ * its projection onto an octahedron unfolded into a square. The angular error
+ * is below 0.01 degrees.
+ */
+class OctahedralNormal {
+public:
+    constexpr OctahedralNormal() = default;
+
+    /**
+     * \brief Encodes the direction of `normal`, which does not need to be
+     * normalized. A zero vector is encoded as +z.
+     * \param normal The direction to encode.
+     */
+    explicit OctahedralNormal(const Vector<float, 3>& normal)
+        : OctahedralNormal{normal.x(), normal.y(), normal.z()} {}
+
+    // NOLINTBEGIN(readability-identifier-length)
+    /**
+     * \brief Encodes the direction of `(x, y, z)`, see the constructor taking
+     * a vector.
+     */
+    OctahedralNormal(float x, float y, float z) {
+        // Dividing by at least the smallest float keeps the loop free of
+        // branches, a zero vector still ends up at (0, 0).
+        const auto l1_norm = std::abs(x) + std::abs(y) + std::abs(z);
+        const auto inverse =
+            1.0F / std::max(l1_norm, std::numeric_limits<float>::min());
+
+        auto u = x * inverse;
+        auto v = y * inverse;
+
+        // The lower hemisphere is folded over the diagonals of the square.
+        const auto folded_u = (1.0F - std::abs(v)) * sign_not_zero(u);
+        const auto folded_v = (1.0F - std::abs(u)) * sign_not_zero(v);
+        u = z < 0.0F ? folded_u : u;
+        v = z < 0.0F ? folded_v : v;
+
+        const auto low = static_cast<uint16_t>(Snorm16{u}.get_bits());
+        const auto high = static_cast<uint16_t>(Snorm16{v}.get_bits());
+        this->bits = static_cast<uint32_t>(low) |
+                     (static_cast<uint32_t>(high) << 16);
+    }
+    // NOLINTEND(readability-identifier-length)
+
+    /**
+     * \brief Returns the octahedral normal with the given bits.
+     * \param bits The two snorm16 coordinates, u in the low half.
+     */
+    [[nodiscard]] constexpr static auto from_bits(uint32_t bits)
+        -> OctahedralNormal {
+        auto normal = OctahedralNormal{};
+        normal.bits = bits;
+        return normal;
+    }
+
+    /**
+     * \brief Returns the two snorm16 coordinates, u in the low half.
+     */
+    [[nodiscard]] constexpr auto get_bits() const -> uint32_t {
+        return this->bits;
+    }
+
+    /**
+     * \brief Returns the decoded unit vector.
+     */
+    [[nodiscard]] auto to_vector() const -> Vector<float, 3> {
+        const auto u = static_cast<float>(Snorm16::from_bits(
+            static_cast<int16_t>(static_cast<uint16_t>(this->bits))
+        ));
+        const auto v = static_cast<float>(Snorm16::from_bits(
+            static_cast<int16_t>(static_cast<uint16_t>(this->bits >> 16))
+        ));
+
+        // NOLINTBEGIN(readability-identifier-length)
+        const auto z = 1.0F - std::abs(u) - std::abs(v);
+        const auto unfold = std::max(-z, 0.0F);
+        const auto x = u >= 0.0F ? u - unfold : u + unfold;
+        const auto y = v >= 0.0F ? v - unfold : v + unfold;
+        // NOLINTEND(readability-identifier-length)
+
+        const auto length = std::sqrt(x * x + y * y + z * z);
+        return Vector<float, 3>{x / length, y / length, z / length};
+    }
+
+    [[nodiscard]] constexpr auto operator==(const OctahedralNormal& other
+    ) const -> bool = default;
+
+private:
+    [[nodiscard]] static auto sign_not_zero(float value) -> float {
+        return value >= 0.0F ? 1.0F : -1.0F;
+    }
+
+    uint32_t bits = 0;
+};
+
+/**
+ * \brief Whether `P` is a packed component type for `Vector<P, N>`.
+ */
+template <typename P>
+concept PackedComponent =
+    std::same_as<P, Half> || std::same_as<P, Snorm8> ||
+    std::same_as<P, Snorm16>;
+
+namespace Detail {
+
+/**
+ * \brief Encodes `count` contiguous floats to the packed component `P`.
+ */
+template <PackedComponent P, typename T>
+auto encode_lane(const T* in, P* out, size_t count) -> void {
+    using Kernels = Simd::PackKernels<T>;
+
+    // NOLINTBEGIN(cppcoreguidelines-pro-type-reinterpret-cast)
+    if constexpr (std::same_as<P, Half>) {
+        if constexpr (requires { Kernels::encode_half; }) {
+            Kernels::encode_half(in, reinterpret_cast<uint16_t*>(out), count);
+            return;
+        }
+    } else if constexpr (Kernels::enabled) {
+        using Integer = typename P::Integer;
+        Kernels::encode_snorm(in, reinterpret_cast<Integer*>(out), count);
+        return;
+    }
+    // NOLINTEND(cppcoreguidelines-pro-type-reinterpret-cast)
+
+    // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    for (size_t i = 0; i < count; ++i) {
+        out[i] = P{in[i]};
+    }
+    // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+}
+
+/**
+ * \brief Decodes `count` contiguous packed components `P` to floats.
+ */
+template <PackedComponent P, typename T>
+auto decode_lane(const P* in, T* out, size_t count) -> void {
+    using Kernels = Simd::PackKernels<T>;
+
+    // NOLINTBEGIN(cppcoreguidelines-pro-type-reinterpret-cast)
+    if constexpr (std::same_as<P, Half>) {
+        if constexpr (requires { Kernels::decode_half; }) {
+            Kernels::decode_half(
+                reinterpret_cast<const uint16_t*>(in), out, count
+            );
+            return;
+        }
+    } else if constexpr (Kernels::enabled) {
+        using Integer = typename P::Integer;
+        Kernels::decode_snorm(
+            reinterpret_cast<const Integer*>(in), out, count
+        );
+        return;
+    }
+    // NOLINTEND(cppcoreguidelines-pro-type-reinterpret-cast)
+
+    // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    for (size_t i = 0; i < count; ++i) {
+        out[i] = static_cast<T>(in[i]);
+    }
+    // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+}
+
+/**
+ * \brief Encodes `count` directions stored as separate x, y and z lanes.
+ */
+template <typename T>
+auto encode_octahedral_lanes(
+    const std::array<const T*, 3>& in, OctahedralNormal* out, size_t count
+) -> void {
+    using Kernels = Simd::PackKernels<T>;
+
+    // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    if constexpr (Kernels::enabled) {
+        static_assert(sizeof(OctahedralNormal) == sizeof(uint32_t));
+        Kernels::encode_octahedral(
+            in[0],
+            in[1],
+            in[2],
+            reinterpret_cast<uint32_t*>(out),
+            count
+        );
+    } else {
+        for (size_t i = 0; i < count; ++i) {
+            out[i] = OctahedralNormal{in[0][i], in[1][i], in[2][i]};
+        }
+    }
+    // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+}
+
+/**
+ * \brief Decodes `count` octahedral normals into separate x, y and z lanes.
+ */
+template <typename T>
+auto decode_octahedral_lanes(
+    const OctahedralNormal* in, const std::array<T*, 3>& out, size_t count
+) -> void {
+    using Kernels = Simd::PackKernels<T>;
+
+    // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    if constexpr (Kernels::enabled) {
+        static_assert(sizeof(OctahedralNormal) == sizeof(uint32_t));
+        Kernels::decode_octahedral(
+            reinterpret_cast<const uint32_t*>(in),
+            out[0],
+            out[1],
+            out[2],
+            count
+        );
+    } else {
+        for (size_t i = 0; i < count; ++i) {
+            const auto vector = in[i].to_vector();
+            out[0][i] = vector.x();
+            out[1][i] = vector.y();
+            out[2][i] = vector.z();
+        }
+    }
+    // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+}
+
+/// The number of vectors a lane of a batch is converted by at a time.
+constexpr auto pack_chunk_size = size_t{256};
+
+/// Separate x, y and z lanes for one chunk of vectors.
+using ChunkLanes = std::array<std::array<float, pack_chunk_size>, 3>;
+
+}  // namespace Detail
+
+/**
+ * \brief Returns the vector with its components packed to `P`.
+ * \tparam P The packed component type: `Half`, `Snorm8` or `Snorm16`.
+ * \param vector The vector to encode.
+ */
+template <PackedComponent P, size_t N>
+[[nodiscard]] auto encode(const Vector<float, N>& vector) -> Vector<P, N> {
+    auto result = Vector<P, N>{};
+    for (size_t i = 0; i < N; ++i) {
+        result[i] = P{vector[i]};
+    }
+    return result;
+}
+
+/**
+ * \brief Returns the vector with its packed components expanded to floats.
+ * \param vector The vector to decode.
+ */
+template <PackedComponent P, size_t N>
+[[nodiscard]] auto decode(const Vector<P, N>& vector) -> Vector<float, N> {
+    auto result = Vector<float, N>{};
+    for (size_t i = 0; i < N; ++i) {
+        result[i] = static_cast<float>(vector[i]);
+    }
+    return result;
+}
+
+/**
+ * \brief Packs every vector of `in` into `out`.
+ * \param in The vectors to encode, any contiguous container of vectors.
+ * \param out The packed vectors, their component type selects the format.
+ * \throw std::invalid_argument If the sizes of the spans do not match.
+ */
+template <PackedComponent P, size_t N>
+auto encode(
+    std::type_identity_t<std::span<const Vector<float, N>>> in,
+    std::span<Vector<P, N>> out
+) -> void {
+    if (in.size() != out.size()) {
+        throw std::invalid_argument("Input and output sizes do not match");
+    }
+
+    static_assert(sizeof(Vector<float, N>) == sizeof(float) * N);
+    static_assert(sizeof(Vector<P, N>) == sizeof(P) * N);
+
+    // Both arrays are contiguous components, so they convert as one lane.
+    // NOLINTBEGIN(cppcoreguidelines-pro-type-reinterpret-cast)
+    Detail::encode_lane(
+        reinterpret_cast<const float*>(in.data()),
+        reinterpret_cast<P*>(out.data()),
+        in.size() * N
+    );
+    // NOLINTEND(cppcoreguidelines-pro-type-reinterpret-cast)
+}
+
+/**
+ * \brief Packs every vector of a batch into `out`, interleaving its lanes.
+ * \param in The batch to encode.
+ * \param out The packed vectors, their component type selects the format.
+ * \throw std::invalid_argument If the sizes do not match.
+ */
+template <PackedComponent P, size_t N, typename Allocator>
+auto encode(
+    const VectorBatch<float, N, Allocator>& in, std::span<Vector<P, N>> out
+) -> void {
+    if (in.size() != out.size()) {
+        throw std::invalid_argument("Input and output sizes do not match");
+    }
+
+    auto chunk = std::array<P, Detail::pack_chunk_size>{};
+
+    for (size_t begin = 0; begin < in.size();
+         begin += Detail::pack_chunk_size) {
+        const auto count = std::min(Detail::pack_chunk_size, in.size() - begin);
+
+        for (size_t j = 0; j < N; ++j) {
+            Detail::encode_lane(
+                in.lane(j).data() + begin, chunk.data(), count
+            );
+            for (size_t i = 0; i < count; ++i) {
+                out[begin + i][j] = chunk[i];
+            }
+        }
+    }
+}
+
+/**
+ * \brief Expands every packed vector of `in` into `out`.
+ * \param in The packed vectors to decode.
+ * \param out The decoded vectors.
+ * \throw std::invalid_argument If the sizes of the spans do not match.
+ */
+template <PackedComponent P, size_t N>
+auto decode(std::span<const Vector<P, N>> in, std::span<Vector<float, N>> out)
+    -> void {
+    if (in.size() != out.size()) {
+        throw std::invalid_argument("Input and output sizes do not match");
+    }
+
+    static_assert(sizeof(Vector<float, N>) == sizeof(float) * N);
+    static_assert(sizeof(Vector<P, N>) == sizeof(P) * N);
+
+    // NOLINTBEGIN(cppcoreguidelines-pro-type-reinterpret-cast)
+    Detail::decode_lane(
+        reinterpret_cast<const P*>(in.data()),
+        reinterpret_cast<float*>(out.data()),
+        in.size() * N
+    );
+    // NOLINTEND(cppcoreguidelines-pro-type-reinterpret-cast)
+}
+
+/**
+ * \brief Expands every packed vector of a vector into `out`.
+ * \see decode(std::span<const Vector<P, N>>, std::span<Vector<float, N>>)
+ */
+template <PackedComponent P, size_t N, typename Allocator>
+auto decode(
+    const std::vector<Vector<P, N>, Allocator>& in,
+    std::span<Vector<float, N>> out
+) -> void {
+    decode(std::span<const Vector<P, N>>{in}, out);
+}
+
+/**
+ * \brief Expands every packed vector of `in` into the lanes of a batch,
+ * resized to the number of vectors.
+ * \param in The packed vectors to decode.
+ * \param out The batch receiving the decoded vectors.
+ */
+template <PackedComponent P, size_t N, typename Allocator>
+auto decode(
+    std::span<const Vector<P, N>> in, VectorBatch<float, N, Allocator>& out
+) -> void {
+    out.resize(in.size());
+
+    auto chunk = std::array<P, Detail::pack_chunk_size>{};
+
+    for (size_t begin = 0; begin < in.size();
+         begin += Detail::pack_chunk_size) {
+        const auto count = std::min(Detail::pack_chunk_size, in.size() - begin);
+
+        for (size_t j = 0; j < N; ++j) {
+            for (size_t i = 0; i < count; ++i) {
+                chunk[i] = in[begin + i][j];
+            }
+            Detail::decode_lane(
+                chunk.data(), out.lane(j).data() + begin, count
+            );
+        }
+    }
+}
+
+/**
+ * \brief Expands every packed vector of a vector into the lanes of a batch.
+ * \see decode(std::span<const Vector<P, N>>, VectorBatch<float, N>&)
+ */
+template <
+    PackedComponent P,
+    size_t N,
+    typename InAllocator,
+    typename OutAllocator>
+auto decode(
+    const std::vector<Vector<P, N>, InAllocator>& in,
+    VectorBatch<float, N, OutAllocator>& out
+) -> void {
+    decode(std::span<const Vector<P, N>>{in}, out);
+}
+
+/**
+ * \brief Encodes the direction of every vector of `in` into `out`.
+ * \param in The directions to encode.
+ * \param out The octahedral normals.
+ * \throw std::invalid_argument If the sizes of the spans do not match.
+ */
+inline auto encode(
+    std::span<const Vector<float, 3>> in, std::span<OctahedralNormal> out
+) -> void {
+    if (in.size() != out.size()) {
+        throw std::invalid_argument("Input and output sizes do not match");
+    }
+
+    auto lanes = Detail::ChunkLanes{};
+
+    for (size_t begin = 0; begin < in.size();
+         begin += Detail::pack_chunk_size) {
+        const auto count = std::min(Detail::pack_chunk_size, in.size() - begin);
+
+        for (size_t i = 0; i < count; ++i) {
+            lanes[0][i] = in[begin + i].x();
+            lanes[1][i] = in[begin + i].y();
+            lanes[2][i] = in[begin + i].z();
+        }
+        Detail::encode_octahedral_lanes<float>(
+            {lanes[0].data(), lanes[1].data(), lanes[2].data()},
+            out.data() + begin,
+            count
+        );
+    }
+}
+
+/**
+ * \brief Encodes the direction of every vector of a batch into `out`.
+ * \param in The batch of directions to encode.
+ * \param out The octahedral normals.
+ * \throw std::invalid_argument If the sizes do not match.
+ */
+template <typename Allocator>
+auto encode(
+    const VectorBatch<float, 3, Allocator>& in, std::span<OctahedralNormal> out
+) -> void {
+    if (in.size() != out.size()) {
+        throw std::invalid_argument("Input and output sizes do not match");
+    }
+
+    Detail::encode_octahedral_lanes<float>(
+        {in.x().data(), in.y().data(), in.z().data()}, out.data(), in.size()
+    );
+}
+
+/**
+ * \brief Decodes every octahedral normal of `in` into `out`.
+ * \param in The octahedral normals to decode.
+ * \param out The decoded unit vectors.
+ * \throw std::invalid_argument If the sizes of the spans do not match.
+ */
+inline auto decode(
+    std::span<const OctahedralNormal> in, std::span<Vector<float, 3>> out
+) -> void {
+    if (in.size() != out.size()) {
+        throw std::invalid_argument("Input and output sizes do not match");
+    }
+
+    auto lanes = Detail::ChunkLanes{};
+
+    for (size_t begin = 0; begin < in.size();
+         begin += Detail::pack_chunk_size) {
+        const auto count = std::min(Detail::pack_chunk_size, in.size() - begin);
+
+        Detail::decode_octahedral_lanes<float>(
+            in.data() + begin,
+            {lanes[0].data(), lanes[1].data(), lanes[2].data()},
+            count
+        );
+        for (size_t i = 0; i < count; ++i) {
+            out[begin + i] = Vector<float, 3>{
+                lanes[0][i], lanes[1][i], lanes[2][i]
+            };
+        }
+    }
+}
+
+/**
+ * \brief Decodes every octahedral normal of `in` into the lanes of a batch,
+ * resized to the number of normals.
+ * \param in The octahedral normals to decode.
+ * \param out The batch receiving the decoded unit vectors.
+ */
+template <typename Allocator>
+auto decode(
+    std::span<const OctahedralNormal> in,
+    VectorBatch<float, 3, Allocator>& out
+) -> void {
+    out.resize(in.size());
+
+    Detail::decode_octahedral_lanes<float>(
+        in.data(), {out.x().data(), out.y().data(), out.z().data()}, in.size()
+    );
+}
+
+}  // namespace Luminol::Maths
@@ -0,0 +1,226 @@
+#pragma once
+
+#include <bit>
+#include <cmath>
+#include <concepts>
+#include <cstdint>
+#include <type_traits>
+
+#include <LuminolMaths/Simd.hpp>
+
+namespace Luminol::Maths {
+
+/**
+ * \brief Selects between the exact standard library functions and faster
+ * approximations with a bounded error.
+ *
+ * `Exact` is the default everywhere. `Fast` is opt-in per call, e.g.
+ * `vector.normalized<Precision::Fast>()` or
+ * `Transform::rotate_x<float, 4, Precision::Fast>(angle)`, and its error is
+ * documented on the functions of `FastMath`.
+ */
+enum class Precision { Exact, Fast };
+
+namespace FastMath {
+
+/**
+ * \brief The sine and cosine of the same angle.
+ */
+template <std::floating_point T>
+struct SinCos {
+    T sin;
+    T cos;
+};
+
+namespace Detail {
+
+/**
+ * \brief Returns the reciprocal square root by Newton iterations from the
+ * bit-level initial estimate, for constant evaluation.
+ */
+template <std::floating_point T>
+[[nodiscard]] constexpr auto newton_rsqrt(T value) -> T {
+    auto estimate = T{0};
+    auto iterations = 0;
+
+    if constexpr (sizeof(T) == sizeof(uint32_t)) {
+        const auto bits = std::bit_cast<uint32_t>(value);
+        estimate = std::bit_cast<T>(uint32_t{0x5F375A86} - (bits >> 1));
+        iterations = 4;
+    } else {
+        const auto bits = std::bit_cast<uint64_t>(value);
+        estimate = std::bit_cast<T>(uint64_t{0x5FE6EB50C7B537A9} - (bits >> 1));
+        iterations = 5;
+    }
+
+    const auto half = value * T{0.5};
+    for (auto i = 0; i < iterations; ++i) {
+        estimate *= T{1.5} - half * estimate * estimate;
+    }
+    return estimate;
+}
+
+/**
+ * \brief Rounds to the nearest integer, ties to even, by adding and removing
+ * 1.5 times the magnitude at which the spacing of `T` reaches 1.
+ * \pre |value| < 2^22 for floats and 2^51 for doubles.
+ */
+template <std::floating_point T>
+[[nodiscard]] constexpr auto round_to_integer(T value) -> T {
+    constexpr auto shift =
+        sizeof(T) == 4 ? T{12582912.0} : T{6755399441055744.0};
+    return (value + shift) - shift;
+}
+
+/// pi / 2 split into parts whose products with the quadrant are exact.
+template <std::floating_point T>
+struct HalfPi;
+
+template <>
+struct HalfPi<float> {
+    constexpr static auto inverse = 0.636619772367581343076F;
+    constexpr static auto high = 1.5703125F;
+    constexpr static auto middle = 4.837512969970703125e-4F;
+    constexpr static auto low = 7.54978995489188216e-8F;
+};
+
+template <>
+struct HalfPi<double> {
+    constexpr static auto inverse = 0.636619772367581343076;
+    constexpr static auto high = 1.57079632673412561417e+00;
+    constexpr static auto middle = 6.07710050630396597660e-11;
+    constexpr static auto low = 2.02226624871116645580e-21;
+};
+
+/**
+ * \brief Returns the sine and cosine of an angle in [-pi / 4, pi / 4] from
+ * their minimax polynomials.
+ */
+template <std::floating_point T>
+[[nodiscard]] constexpr auto polynomial_sin_cos(T angle) -> SinCos<T> {
+    const auto square = angle * angle;
+
+    if constexpr (std::same_as<T, float>) {
+        const auto sin = angle + angle * square *
+                                     (-1.6666654611e-1F +
+                                      square * (8.3321608736e-3F +
+                                                square * -1.9515295891e-4F));
+        const auto cos = 1.0F - 0.5F * square +
+                         square * square *
+                             (4.166664568298827e-2F +
+                              square * (-1.388731625493765e-3F +
+                                        square * 2.443315711809948e-5F));
+        return {sin, cos};
+    } else {
+        const auto sin =
+            angle +
+            angle * square *
+                (-1.66666666666666307295e-1 +
+                 square *
+                     (8.33333333332211858878e-3 +
+                      square *
+                          (-1.98412698295895385996e-4 +
+                           square * (2.75573136213857245213e-6 +
+                                     square * (-2.50507477628578072866e-8 +
+                                               square *
+                                                   1.58962301576546568060e-10
+                                     )))));
+        const auto cos =
+            1.0 - 0.5 * square +
+            square * square *
+                (4.16666666666665929218e-2 +
+                 square *
+                     (-1.38888888888730564116e-3 +
+                      square *
+                          (2.48015872888517045348e-5 +
+                           square * (-2.75573141792967388112e-7 +
+                                     square * (2.08757008419747316778e-9 +
+                                               square *
+                                                   -1.13585365213876817300e-11
+                                     )))));
+        return {sin, cos};
+    }
+}
+
+}  // namespace Detail
+
+/**
+ * \brief Returns an approximation of `1 / sqrt(value)`.
+ *
+ * For floats built with `LUMINOL_MATHS_ENABLE_SIMD`, this is the 12-bit
+ * hardware estimate refined by one Newton step, within 4 ULP of the exact
+ * result. Otherwise, and for doubles which have no hardware estimate, it is
+ * `1 / std::sqrt(value)`, within 1.5 ULP. Constant evaluation iterates
+ * Newton's method instead, within 2 ULP.
+ *
+ * \pre value > 0
+ * \param value The value to take the reciprocal square root of.
+ * \return The approximate reciprocal square root of the value.
+ */
+template <std::floating_point T>
+[[nodiscard]] constexpr auto rsqrt(T value) -> T {
+    if (std::is_constant_evaluated()) {
+        return Detail::newton_rsqrt(value);
+    }
+
+    if constexpr (requires { Simd::ScalarKernels<T>::rsqrt; }) {
+        return Simd::ScalarKernels<T>::rsqrt(value);
+    } else {
+        return T{1} / std::sqrt(value);
+    }
+}
+
+/**
+ * \brief Returns the sine and cosine of an angle from a single range
+ * reduction and a pair of polynomials.
+ *
+ * The angle is reduced to [-pi / 4, pi / 4] by a multiple of pi / 2, with
+ * pi / 2 split in three parts so the reduction stays exact. For angles of
+ * magnitude up to 1e4 radians, both results are within 1 ULP of the exact
+ * values, where the ULP is that of 1 near the zeros of the sine and cosine.
+ * Larger angles lose precision in the reduction.
+ *
+ * \param angle The angle in radians.
+ * \return The sine and cosine of the angle.
+ */
+template <std::floating_point T>
+[[nodiscard]] constexpr auto sin_cos(T angle) -> SinCos<T> {
+    using HalfPi = Detail::HalfPi<T>;
+
+    const auto multiple = Detail::round_to_integer(angle * HalfPi::inverse);
+    const auto reduced = ((angle - multiple * HalfPi::high) -
+                          multiple * HalfPi::middle) -
+                         multiple * HalfPi::low;
+
+    const auto [sin, cos] = Detail::polynomial_sin_cos(reduced);
+
+    // Odd quadrants swap the sine and cosine, the sign of the sine flips in
+    // quadrants 2 and 3 and that of the cosine in quadrants 1 and 2. Both are
+    // applied on the bits, as branches on the quadrant would be mispredicted
+    // and keep loops over angles from vectorizing.
+    using Bits = std::conditional_t<sizeof(T) == 4, uint32_t, uint64_t>;
+
+    constexpr auto sign_shift = sizeof(T) * 8 - 2;
+
+    // The quadrant fits in 32 bits for any angle the reduction supports, and
+    // the 32-bit conversion is the one SSE2 has for both floats and doubles.
+    const auto quadrant = static_cast<Bits>(static_cast<int32_t>(multiple));
+    const auto swap = Bits{0} - (quadrant & 1);
+    const auto sin_bits = std::bit_cast<Bits>(sin);
+    const auto cos_bits = std::bit_cast<Bits>(cos);
+
+    return {
+        std::bit_cast<T>(
+            ((sin_bits & ~swap) | (cos_bits & swap)) ^
+            ((quadrant & 2) << sign_shift)
+        ),
+        std::bit_cast<T>(
+            ((cos_bits & ~swap) | (sin_bits & swap)) ^
+            (((quadrant + 1) & 2) << sign_shift)
+        ),
+    };
+}
+
+}  // namespace FastMath
+
+}  // namespace Luminol::Maths
@@ -0,0 +1,528 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <concepts>
+#include <ranges>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+
+#include <LuminolMaths/Matrix.hpp>
+#include <LuminolMaths/TransformBatch.hpp>
+#include <LuminolMaths/Vector.hpp>
+
+#include <LuminolMaths/Units/Angle.hpp>
+
+namespace Luminol::Maths {
+
+template <std::floating_point T>
+struct AxisAngle {
+    Vector<T, 3> axis;
+    Units::Angle<T, Units::Radian> angle = {0.0};
+};
+
+/**
+ * \brief A rotation quaternion `x*i + y*j + z*k + w`.
+ *
+ * The components are stored as a `Vector<T, 4>` in x, y, z, w order, so a
+ * quaternion is four contiguous elements and float quaternions share the SSE
+ * kernels of `Vector<float, 4>` when the library is built with
+ * `LUMINOL_MATHS_ENABLE_SIMD`.
+ *
+ * Quaternions follow the row vector convention of `Transform`: `to_matrix_3x3`
+ * returns the matrix `M` such that `v * M` equals `rotate(v)`, and the axis
+ * angle constructor matches `Transform::rotate_x/y/z` for the unit axes.
+ * Composition follows the matrix order too, `(a * b)` applies `a` first, so
+ * `(a * b).to_matrix_3x3() == a.to_matrix_3x3() * b.to_matrix_3x3()`.
+ *
+ * \tparam T The underlying type of the components.
+ */
+template <std::floating_point T>
+class Quaternion {
+public:
+    // NOLINTBEGIN(readability-identifier-length)
+    /**
+     * \brief Constructs a quaternion from its components.
+     * \param x The i component.
+     * \param y The j component.
+     * \param z The k component.
+     * \param w The real component.
+     */
+    [[nodiscard]] constexpr Quaternion(T x, T y, T z, T w)
+        : components{x, y, z, w} {}
+    // NOLINTEND(readability-identifier-length)
+
+    /**
+     * \brief Constructs a quaternion from a vector holding x, y, z and w.
+     * \param components The components of the quaternion.
+     */
+    [[nodiscard]] constexpr explicit Quaternion(const Vector<T, 4>& components)
+        : components{components} {}
+
+    [[nodiscard]] constexpr static auto identity() -> Quaternion {
+        return Quaternion{T{0}, T{0}, T{0}, T{1}};
+    }
+
+    /**
+     * \brief Returns the rotation of `angle` around `axis`.
+     * \param axis The axis of rotation.
+     * \param angle The angle of rotation.
+     * \pre axis is normalized.
+     * \return The rotation quaternion.
+     */
+    [[nodiscard]] static auto from_axis_angle(
+        const Vector<T, 3>& axis,
+        const Units::Angle<T, Units::Radian>& angle
+    ) -> Quaternion {
+        const auto half_angle = angle.get_value() / T{2};
+        const auto sin_half = std::sin(half_angle);
+
+        return Quaternion{
+            axis.x() * sin_half,
+            axis.y() * sin_half,
+            axis.z() * sin_half,
+            std::cos(half_angle),
+        };
+    }
+
+    /**
+     * \brief Returns the rotation of a rotation matrix, such as the ones built
+     * by `Transform::rotate_x/y/z`.
+     * \param matrix The rotation matrix.
+     * \pre The matrix is orthonormal with a determinant of 1.
+     * \return The normalized rotation quaternion.
+     */
+    [[nodiscard]] static auto from_matrix(const Matrix<T, 3, 3>& matrix)
+        -> Quaternion {
+        // NOLINTBEGIN(readability-identifier-length)
+        const auto& m = matrix;
+
+        const auto trace = m[0][0] + m[1][1] + m[2][2];
+
+        // Picks the largest of w, x, y and z to divide by, which keeps the
+        // square root away from zero.
+        if (trace > T{0}) {
+            const auto s = std::sqrt(trace + T{1}) * T{2};
+            return Quaternion{
+                (m[1][2] - m[2][1]) / s,
+                (m[2][0] - m[0][2]) / s,
+                (m[0][1] - m[1][0]) / s,
+                s / T{4},
+            }
+                .normalized();
+        }
+
+        if (m[0][0] > m[1][1] && m[0][0] > m[2][2]) {
+            const auto s = std::sqrt(T{1} + m[0][0] - m[1][1] - m[2][2]) * T{2};
+            return Quaternion{
+                s / T{4},
+                (m[0][1] + m[1][0]) / s,
+                (m[0][2] + m[2][0]) / s,
+                (m[1][2] - m[2][1]) / s,
+            }
+                .normalized();
+        }
+
+        if (m[1][1] > m[2][2]) {
+            const auto s = std::sqrt(T{1} + m[1][1] - m[0][0] - m[2][2]) * T{2};
+            return Quaternion{
+                (m[0][1] + m[1][0]) / s,
+                s / T{4},
+                (m[1][2] + m[2][1]) / s,
+                (m[2][0] - m[0][2]) / s,
+            }
+                .normalized();
+        }
+
+        const auto s = std::sqrt(T{1} + m[2][2] - m[0][0] - m[1][1]) * T{2};
+        return Quaternion{
+            (m[0][2] + m[2][0]) / s,
+            (m[1][2] + m[2][1]) / s,
+            s / T{4},
+            (m[0][1] - m[1][0]) / s,
+        }
+            .normalized();
+        // NOLINTEND(readability-identifier-length)
+    }
+
+    /**
+     * \brief Returns the rotation of the upper 3x3 block of a transformation
+     * matrix.
+     * \param matrix The transformation matrix.
+     * \pre The upper 3x3 block is orthonormal with a determinant of 1.
+     * \return The normalized rotation quaternion.
+     */
+    [[nodiscard]] static auto from_matrix(const Matrix<T, 4, 4>& matrix)
+        -> Quaternion {
+        return Quaternion::from_matrix(matrix.minor(3, 3));
+    }
+
+    [[nodiscard]] constexpr auto x() const -> T {
+        return this->components.x();
+    }
+
+    [[nodiscard]] constexpr auto y() const -> T {
+        return this->components.y();
+    }
+
+    [[nodiscard]] constexpr auto z() const -> T {
+        return this->components.z();
+    }
+
+    [[nodiscard]] constexpr auto w() const -> T {
+        return this->components.w();
+    }
+
+    /**
+     * \brief Returns the components as a vector in x, y, z, w order.
+     */
+    [[nodiscard]] constexpr auto as_vector() const -> const Vector<T, 4>& {
+        return this->components;
+    }
+
+    /**
+     * \brief Returns the imaginary part x, y, z of the quaternion.
+     */
+    [[nodiscard]] constexpr auto vector_part() const -> Vector<T, 3> {
+        return Vector<T, 3>{this->x(), this->y(), this->z()};
+    }
+
+    /**
+     * \brief Returns the axis and angle of the rotation.
+     * \pre The quaternion is normalized.
+     * \return The axis and angle of the rotation. The axis is the x axis when
+     * the angle is zero.
+     */
+    [[nodiscard]] auto to_axis_angle() const -> AxisAngle<T> {
+        const auto w = std::clamp(this->w(), T{-1}, T{1});
+        const auto sin_half = std::sqrt(T{1} - w * w);
+
+        if (sin_half == T{0}) {
+            return {Vector<T, 3>{T{1}, T{0}, T{0}}, {T{0}}};
+        }
+
+        return {this->vector_part() / sin_half, {T{2} * std::acos(w)}};
+    }
+
+    /**
+     * \brief Returns the rotation matrix `M` such that `v * M` rotates `v` by
+     * this quaternion.
+     * \pre The quaternion is normalized.
+     */
+    [[nodiscard]] constexpr auto to_matrix_3x3() const -> Matrix<T, 3, 3> {
+        // NOLINTBEGIN(readability-identifier-length)
+        const auto x = this->x();
+        const auto y = this->y();
+        const auto z = this->z();
+        const auto w = this->w();
+
+        const auto xx = x * x;
+        const auto yy = y * y;
+        const auto zz = z * z;
+        const auto xy = x * y;
+        const auto xz = x * z;
+        const auto yz = y * z;
+        const auto wx = w * x;
+        const auto wy = w * y;
+        const auto wz = w * z;
+
+        return Matrix<T, 3, 3>{std::array{
+            std::array{
+                T{1} - T{2} * (yy + zz), T{2} * (xy + wz), T{2} * (xz - wy)
+            },
+            std::array{
+                T{2} * (xy - wz), T{1} - T{2} * (xx + zz), T{2} * (yz + wx)
+            },
+            std::array{
+                T{2} * (xz + wy), T{2} * (yz - wx), T{1} - T{2} * (xx + yy)
+            },
+        }};
+        // NOLINTEND(readability-identifier-length)
+    }
+
+    /**
+     * \brief Returns the rotation as a 4x4 transformation matrix without
+     * translation.
+     * \pre The quaternion is normalized.
+     */
+    [[nodiscard]] constexpr auto to_matrix_4x4() const -> Matrix<T, 4, 4> {
+        const auto rotation = this->to_matrix_3x3();
+
+        auto result = Matrix<T, 4, 4>::identity();
+        for (size_t i = 0; i < 3; ++i) {
+            for (size_t j = 0; j < 3; ++j) {
+                result[i][j] = rotation[i][j];
+            }
+        }
+        return result;
+    }
+
+    [[nodiscard]] constexpr auto dot(const Quaternion& other) const -> T {
+        return this->components.dot(other.components);
+    }
+
+    [[nodiscard]] auto length() const -> T {
+        return this->components.length();
+    }
+
+    /**
+     * \brief Returns the quaternion scaled to unit length, or a zero quaternion
+     * if its length is zero.
+     */
+    [[nodiscard]] auto normalized() const -> Quaternion {
+        return Quaternion{this->components.normalized()};
+    }
+
+    [[nodiscard]] constexpr auto conjugate() const -> Quaternion {
+        return Quaternion{-this->x(), -this->y(), -this->z(), this->w()};
+    }
+
+    /**
+     * \brief Returns the inverse of the quaternion, the conjugate divided by
+     * the squared length. For unit quaternions prefer `conjugate`.
+     * \return A zero quaternion if the length is zero.
+     */
+    [[nodiscard]] constexpr auto inverse() const -> Quaternion {
+        const auto length_squared = this->dot(*this);
+        if (length_squared == T{0}) {
+            return Quaternion{Vector<T, 4>{}};
+        }
+
+        return Quaternion{this->conjugate().components / length_squared};
+    }
+
+    /**
+     * \brief Rotates a vector by the quaternion.
+     * \param vector The vector to rotate.
+     * \pre The quaternion is normalized.
+     * \return The rotated vector, equal to `vector * to_matrix_3x3()`.
+     */
+    [[nodiscard]] constexpr auto rotate(const Vector<T, 3>& vector) const
+        -> Vector<T, 3> {
+        // v' = v + w * t + u x t, with t = 2 * (u x v)
+        const auto imaginary = this->vector_part();
+        const auto twice_cross = imaginary.cross(vector) * T{2};
+
+        return vector + twice_cross * this->w() +
+               imaginary.cross(twice_cross);
+    }
+
+    /**
+     * \brief Returns the composition of this rotation followed by `other`.
+     * \param other The rotation to apply after this one.
+     * \return The Hamilton product `other * this`.
+     */
+    [[nodiscard]] constexpr auto operator*(const Quaternion& other) const
+        -> Quaternion {
+        // NOLINTBEGIN(readability-identifier-length)
+        const auto& p = other;
+        const auto& q = *this;
+
+        return Quaternion{
+            p.w() * q.x() + p.x() * q.w() + p.y() * q.z() - p.z() * q.y(),
+            p.w() * q.y() - p.x() * q.z() + p.y() * q.w() + p.z() * q.x(),
+            p.w() * q.z() + p.x() * q.y() - p.y() * q.x() + p.z() * q.w(),
+            p.w() * q.w() - p.x() * q.x() - p.y() * q.y() - p.z() * q.z(),
+        };
+        // NOLINTEND(readability-identifier-length)
+    }
+
+    constexpr auto operator*=(const Quaternion& other) -> Quaternion& {
+        *this = *this * other;
+        return *this;
+    }
+
+    [[nodiscard]] constexpr auto operator+(const Quaternion& other) const
+        -> Quaternion {
+        return Quaternion{this->components + other.components};
+    }
+
+    [[nodiscard]] constexpr auto operator-(const Quaternion& other) const
+        -> Quaternion {
+        return Quaternion{this->components - other.components};
+    }
+
+    [[nodiscard]] constexpr auto operator*(T scalar) const -> Quaternion {
+        return Quaternion{this->components * scalar};
+    }
+
+    [[nodiscard]] constexpr auto operator-() const -> Quaternion {
+        return Quaternion{-this->components};
+    }
+
+    [[nodiscard]] constexpr auto operator==(const Quaternion& other) const
+        -> bool {
+        return this->components == other.components;
+    }
+
+private:
+    Vector<T, 4> components;
+};
+
+/**
+ * \brief Linearly interpolates between two rotations and normalizes the
+ * result. Cheaper than `slerp`, but the angular speed is not constant.
+ * \param from The rotation at `t == 0`.
+ * \param to The rotation at `t == 1`.
+ * \param t The interpolation factor.
+ * \pre `from` and `to` are normalized.
+ * \return The interpolated rotation along the shortest path.
+ */
+template <std::floating_point T>
+[[nodiscard]] auto nlerp(
+    const Quaternion<T>& from,
+    const Quaternion<T>& to,
+    std::type_identity_t<T> t  // NOLINT(readability-identifier-length)
+) -> Quaternion<T> {
+    const auto target = from.dot(to) < T{0} ? -to : to;
+
+    return (from * (T{1} - t) + target * t).normalized();
+}
+
+/**
+ * \brief Spherically interpolates between two rotations at constant angular
+ * speed. Nearly parallel rotations fall back to `nlerp` to avoid dividing by a
+ * vanishing sine.
+ * \param from The rotation at `t == 0`.
+ * \param to The rotation at `t == 1`.
+ * \param t The interpolation factor.
+ * \pre `from` and `to` are normalized.
+ * \return The interpolated rotation along the shortest path.
+ */
+template <std::floating_point T>
+[[nodiscard]] auto slerp(
+    const Quaternion<T>& from,
+    const Quaternion<T>& to,
+    std::type_identity_t<T> t  // NOLINT(readability-identifier-length)
+) -> Quaternion<T> {
+    constexpr auto nlerp_threshold = T{0.9995};
+
+    auto cos_angle = from.dot(to);
+    auto target = to;
+
+    if (cos_angle < T{0}) {
+        cos_angle = -cos_angle;
+        target = -to;
+    }
+
+    if (cos_angle > nlerp_threshold) {
+        return (from * (T{1} - t) + target * t).normalized();
+    }
+
+    const auto angle = std::acos(cos_angle);
+    const auto sin_angle = std::sin(angle);
+
+    const auto from_weight = std::sin((T{1} - t) * angle) / sin_angle;
+    const auto to_weight = std::sin(t * angle) / sin_angle;
+
+    return from * from_weight + target * to_weight;
+}
+
+/**
+ * \brief Spherically interpolates every pair of rotations by the same factor.
+ * \param from The rotations at `t == 0`.
+ * \param to The rotations at `t == 1`.
+ * \param t The interpolation factor.
+ * \param out The destination of the interpolated rotations, may alias `from`
+ * or `to`.
+ * \pre from.size() == to.size() == out.size()
+ * \throw std::invalid_argument If the sizes do not match.
+ */
+template <std::floating_point T>
+auto slerp(
+    std::type_identity_t<std::span<const Quaternion<T>>> from,
+    std::type_identity_t<std::span<const Quaternion<T>>> to,
+    T t,  // NOLINT(readability-identifier-length)
+    std::type_identity_t<std::span<Quaternion<T>>> out
+) -> void {
+    if (from.size() != to.size() || from.size() != out.size()) {
+        throw std::invalid_argument("Input and output sizes do not match");
+    }
+
+    for (size_t i = 0; i < from.size(); ++i) {
+        out[i] = slerp(from[i], to[i], t);
+    }
+}
+
+/**
+ * \brief Spherically interpolates every pair of rotations by its own factor.
+ * \param from The rotations at `t == 0`.
+ * \param to The rotations at `t == 1`.
+ * \param t The interpolation factor of every pair, any contiguous range such
+ * as a `std::span` or `std::vector`, its element type selects `T`.
+ * \param out The destination of the interpolated rotations, may alias `from`
+ * or `to`.
+ * \pre from.size() == to.size() == t.size() == out.size()
+ * \throw std::invalid_argument If the sizes do not match.
+ */
+template <
+    std::ranges::contiguous_range Factors,
+    std::floating_point T = std::ranges::range_value_t<Factors>>
+    requires std::ranges::sized_range<Factors>
+auto slerp(
+    std::type_identity_t<std::span<const Quaternion<T>>> from,
+    std::type_identity_t<std::span<const Quaternion<T>>> to,
+    const Factors& t,  // NOLINT(readability-identifier-length)
+    std::type_identity_t<std::span<Quaternion<T>>> out
+) -> void {
+    const auto factors = std::span<const T>{t};
+
+    if (from.size() != to.size() || from.size() != factors.size() ||
+        from.size() != out.size()) {
+        throw std::invalid_argument("Input and output sizes do not match");
+    }
+
+    for (size_t i = 0; i < from.size(); ++i) {
+        out[i] = slerp(from[i], to[i], factors[i]);
+    }
+}
+
+/**
+ * \brief Rotates every vector by the same rotation. The quaternion is
+ * converted to a matrix once, so this goes through the bulk kernels of
+ * `Transform::transform_directions`.
+ * \param rotation The rotation.
+ * \param vectors The vectors to rotate.
+ * \param out The destination of the rotated vectors, may alias `vectors`.
+ * \pre rotation is normalized.
+ * \pre vectors.size() == out.size()
+ * \throw std::invalid_argument If the sizes do not match.
+ */
+template <std::floating_point T>
+auto rotate(
+    const Quaternion<T>& rotation,
+    std::type_identity_t<std::span<const Vector<T, 3>>> vectors,
+    std::type_identity_t<std::span<Vector<T, 3>>> out
+) -> void {
+    Transform::transform_directions(rotation.to_matrix_4x4(), vectors, out);
+}
+
+/**
+ * \brief Rotates every vector by its own rotation.
+ * \param rotations The rotation of every vector.
+ * \param vectors The vectors to rotate.
+ * \param out The destination of the rotated vectors, may alias `vectors`.
+ * \pre Every rotation is normalized.
+ * \pre rotations.size() == vectors.size() == out.size()
+ * \throw std::invalid_argument If the sizes do not match.
+ */
+template <std::floating_point T>
+auto rotate(
+    std::type_identity_t<std::span<const Quaternion<T>>> rotations,
+    std::type_identity_t<std::span<const Vector<T, 3>>> vectors,
+    std::type_identity_t<std::span<Vector<T, 3>>> out
+) -> void {
+    if (rotations.size() != vectors.size() || vectors.size() != out.size()) {
+        throw std::invalid_argument("Input and output sizes do not match");
+    }
+
+    for (size_t i = 0; i < vectors.size(); ++i) {
+        out[i] = rotations[i].rotate(vectors[i]);
+    }
+}
+
+using Quaternionf = Quaternion<float>;
+using Quaterniond = Quaternion<double>;
+
+}  // namespace Luminol::Maths
@@ -0,0 +1,1438 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+#include <LuminolMaths/Config.hpp>
+
+#if LUMINOL_MATHS_HAS_SSE
+#include <immintrin.h>
+#endif
+
+namespace Luminol::Maths::Simd {
+
+/**
+ * \brief SIMD kernels operating on the raw components of a `Vector<T, N>`.
+ *
+ * The primary template is disabled, in which case `Vector` falls back to its
+ * scalar loops. Specializations only exist for the types and sizes that map
+ * cleanly to a single SSE register.
+ *
+ * \tparam T The underlying type of the elements in the vector.
+ * \tparam N The number of elements in the vector.
+ */
+template <typename T, size_t N>
+struct VectorKernels {
+    constexpr static auto enabled = false;
+};
+
+/**
+ * \brief SIMD kernels operating on the raw, row-major elements of a
+ * `Matrix<T, M, N>`.
+ *
+ * \tparam T The underlying type of the elements in the matrix.
+ * \tparam M The number of rows in the matrix.
+ * \tparam N The number of columns in the matrix.
+ */
+template <typename T, size_t M, size_t N>
+struct MatrixKernels {
+    constexpr static auto enabled = false;
+};
+
+/**
+ * \brief SIMD kernels for the product of a row-major `Matrix<T, M, K>` and a
+ * row-major `Matrix<T, K, N>`.
+ *
+ * \tparam T The underlying type of the elements in the matrices.
+ * \tparam M The number of rows of the left-hand side.
+ * \tparam K The number of columns of the left-hand side and rows of the
+ * right-hand side.
+ * \tparam N The number of columns of the right-hand side.
+ */
+template <typename T, size_t M, size_t K, size_t N>
+struct ProductKernels {
+    constexpr static auto enabled = false;
+};
+
+/**
+ * \brief SIMD kernels operating on contiguous lanes of `count` elements, used
+ * by the structure-of-arrays containers. Every kernel accepts arbitrary counts
+ * and handles the remainder with scalar code.
+ *
+ * \tparam T The underlying type of the elements in the lanes.
+ */
+template <typename T>
+struct LaneKernels {
+    constexpr static auto enabled = false;
+};
+
+/**
+ * \brief SIMD kernels operating on a single scalar, for the approximations
+ * of `FastMath` that have a hardware estimate.
+ *
+ * \tparam T The type of the scalar.
+ */
+template <typename T>
+struct ScalarKernels {
+    constexpr static auto enabled = false;
+};
+
+/**
+ * \brief SIMD kernels testing four axis-aligned boxes at once, used by the
+ * traversal of `BVH`. The boxes are stored as 24 contiguous lanes: the four
+ * minimum x, y and z coordinates followed by the four maximum ones.
+ *
+ * \tparam T The underlying type of the coordinates.
+ */
+template <typename T>
+struct QuadKernels {
+    constexpr static auto enabled = false;
+};
+
+/**
+ * \brief SIMD kernels converting contiguous lanes of `count` elements to and
+ * from the packed storage formats of `Packed.hpp`. The half precision kernels
+ * only exist when the target has F16C.
+ *
+ * \tparam T The underlying type of the unpacked elements.
+ */
+template <typename T>
+struct PackKernels {
+    constexpr static auto enabled = false;
+};
+
+#if LUMINOL_MATHS_HAS_SSE
+
+// NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+namespace Detail {
+
+/**
+ * \brief Returns `a * b + c`, fused into a single instruction when FMA is
+ * available.
+ */
+[[nodiscard]] inline auto multiply_add(__m128 a, __m128 b, __m128 c) -> __m128 {
+#if LUMINOL_MATHS_HAS_FMA
+    return _mm_fmadd_ps(a, b, c);
+#else
+    return _mm_add_ps(_mm_mul_ps(a, b), c);
+#endif
+}
+
+/**
+ * \brief Returns the sum of all four lanes of the register.
+ */
+[[nodiscard]] inline auto horizontal_sum(__m128 value) -> float {
+    auto shuffled = _mm_shuffle_ps(value, value, _MM_SHUFFLE(2, 3, 0, 1));
+    auto sums = _mm_add_ps(value, shuffled);
+    shuffled = _mm_movehl_ps(shuffled, sums);
+    sums = _mm_add_ss(sums, shuffled);
+    return _mm_cvtss_f32(sums);
+}
+
+/**
+ * \brief Loads three floats into the lower lanes of a register, zeroing the
+ * upper lane.
+ */
+[[nodiscard]] inline auto load3(const float* source) -> __m128 {
+    return _mm_set_ps(0.0F, source[2], source[1], source[0]);
+}
+
+/**
+ * \brief Stores the lower three lanes of a register.
+ */
+inline auto store3(float* destination, __m128 value) -> void {
+    alignas(16) auto lanes = std::array<float, 4>{};
+    _mm_store_ps(lanes.data(), value);
+    destination[0] = lanes[0];
+    destination[1] = lanes[1];
+    destination[2] = lanes[2];
+}
+
+/**
+ * \brief A matrix column broadcast into SSE registers, with the
+ * translation row last.
+ */
+struct SseColumn {
+    __m128 x_weight;
+    __m128 y_weight;
+    __m128 z_weight;
+    __m128 translation;
+
+    /// Returns `x * x_weight + y * y_weight + z * z_weight + translation`.
+    [[nodiscard]] auto transform(__m128 x, __m128 y, __m128 z) const
+        -> __m128 {
+        auto result = multiply_add(z, this->z_weight, this->translation);
+        result = multiply_add(y, this->y_weight, result);
+        return multiply_add(x, this->x_weight, result);
+    }
+};
+
+#if defined(__AVX__)
+/// Eight float lanes in an AVX register.
+struct FloatPack {
+    using Register = __m256;
+
+    /**
+     * \brief A matrix column broadcast into registers, with the
+     * translation row last.
+     */
+    struct Column {
+        Register x_weight;
+        Register y_weight;
+        Register z_weight;
+        Register translation;
+
+        /// Returns `x * x_weight + y * y_weight + z * z_weight +
+        /// translation`.
+        [[nodiscard]] auto transform(Register x, Register y, Register z) const
+            -> Register {
+            auto result =
+                FloatPack::multiply_add(z, this->z_weight, this->translation);
+            result = FloatPack::multiply_add(y, this->y_weight, result);
+            return FloatPack::multiply_add(x, this->x_weight, result);
+        }
+    };
+
+    constexpr static auto width = size_t{8};
+
+    [[nodiscard]] static auto load(const float* source) -> Register {
+        return _mm256_loadu_ps(source);
+    }
+
+    static auto store(float* destination, Register value) -> void {
+        _mm256_storeu_ps(destination, value);
+    }
+
+    [[nodiscard]] static auto broadcast(float value) -> Register {
+        return _mm256_set1_ps(value);
+    }
+
+    [[nodiscard]] static auto add(Register lhs, Register rhs) -> Register {
+        return _mm256_add_ps(lhs, rhs);
+    }
+
+    [[nodiscard]] static auto subtract(Register lhs, Register rhs)
+        -> Register {
+        return _mm256_sub_ps(lhs, rhs);
+    }
+
+    [[nodiscard]] static auto multiply(Register lhs, Register rhs)
+        -> Register {
+        return _mm256_mul_ps(lhs, rhs);
+    }
+
+    [[nodiscard]] static auto multiply_add(
+        Register lhs, Register rhs, Register addend
+    ) -> Register {
+#if LUMINOL_MATHS_HAS_FMA
+        return _mm256_fmadd_ps(lhs, rhs, addend);
+#else
+        return _mm256_add_ps(_mm256_mul_ps(lhs, rhs), addend);
+#endif
+    }
+
+    [[nodiscard]] static auto divide(Register lhs, Register rhs) -> Register {
+        return _mm256_div_ps(lhs, rhs);
+    }
+
+    [[nodiscard]] static auto sqrt(Register value) -> Register {
+        return _mm256_sqrt_ps(value);
+    }
+
+    /// Returns `value` where `mask_source` is non-zero and zero elsewhere.
+    [[nodiscard]] static auto select_non_zero(
+        Register mask_source, Register value
+    ) -> Register {
+        const auto mask =
+            _mm256_cmp_ps(mask_source, _mm256_setzero_ps(), _CMP_NEQ_OQ);
+        return _mm256_and_ps(mask, value);
+    }
+
+    /// Returns a mask of the lanes where `lhs >= rhs`.
+    [[nodiscard]] static auto greater_equal(Register lhs, Register rhs)
+        -> Register {
+        return _mm256_cmp_ps(lhs, rhs, _CMP_GE_OQ);
+    }
+
+    [[nodiscard]] static auto bitwise_and(Register lhs, Register rhs)
+        -> Register {
+        return _mm256_and_ps(lhs, rhs);
+    }
+
+    /// Returns one bit per lane, set where the lane of the mask is set.
+    [[nodiscard]] static auto bits(Register mask) -> uint64_t {
+        return static_cast<uint64_t>(_mm256_movemask_ps(mask));
+    }
+};
+#else
+/// Four float lanes in an SSE register.
+struct FloatPack {
+    using Register = __m128;
+
+    /**
+     * \brief A matrix column broadcast into registers, with the
+     * translation row last.
+     */
+    struct Column {
+        Register x_weight;
+        Register y_weight;
+        Register z_weight;
+        Register translation;
+
+        /// Returns `x * x_weight + y * y_weight + z * z_weight +
+        /// translation`.
+        [[nodiscard]] auto transform(Register x, Register y, Register z) const
+            -> Register {
+            auto result =
+                FloatPack::multiply_add(z, this->z_weight, this->translation);
+            result = FloatPack::multiply_add(y, this->y_weight, result);
+            return FloatPack::multiply_add(x, this->x_weight, result);
+        }
+    };
+
+    constexpr static auto width = size_t{4};
+
+    [[nodiscard]] static auto load(const float* source) -> Register {
+        return _mm_loadu_ps(source);
+    }
+
+    static auto store(float* destination, Register value) -> void {
+        _mm_storeu_ps(destination, value);
+    }
+
+    [[nodiscard]] static auto broadcast(float value) -> Register {
+        return _mm_set1_ps(value);
+    }
+
+    [[nodiscard]] static auto add(Register lhs, Register rhs) -> Register {
+        return _mm_add_ps(lhs, rhs);
+    }
+
+    [[nodiscard]] static auto subtract(Register lhs, Register rhs)
+        -> Register {
+        return _mm_sub_ps(lhs, rhs);
+    }
+
+    [[nodiscard]] static auto multiply(Register lhs, Register rhs)
+        -> Register {
+        return _mm_mul_ps(lhs, rhs);
+    }
+
+    [[nodiscard]] static auto multiply_add(
+        Register lhs, Register rhs, Register addend
+    ) -> Register {
+        return Detail::multiply_add(lhs, rhs, addend);
+    }
+
+    [[nodiscard]] static auto divide(Register lhs, Register rhs) -> Register {
+        return _mm_div_ps(lhs, rhs);
+    }
+
+    [[nodiscard]] static auto sqrt(Register value) -> Register {
+        return _mm_sqrt_ps(value);
+    }
+
+    /// Returns `value` where `mask_source` is non-zero and zero elsewhere.
+    [[nodiscard]] static auto select_non_zero(
+        Register mask_source, Register value
+    ) -> Register {
+        const auto mask = _mm_cmpneq_ps(mask_source, _mm_setzero_ps());
+        return _mm_and_ps(mask, value);
+    }
+
+    /// Returns a mask of the lanes where `lhs >= rhs`.
+    [[nodiscard]] static auto greater_equal(Register lhs, Register rhs)
+        -> Register {
+        return _mm_cmpge_ps(lhs, rhs);
+    }
+
+    [[nodiscard]] static auto bitwise_and(Register lhs, Register rhs)
+        -> Register {
+        return _mm_and_ps(lhs, rhs);
+    }
+
+    /// Returns one bit per lane, set where the lane of the mask is set.
+    [[nodiscard]] static auto bits(Register mask) -> uint64_t {
+        return static_cast<uint64_t>(_mm_movemask_ps(mask));
+    }
+};
+#endif
+
+/**
+ * \brief Runs `packed` on every full register of the `count` elements and
+ * `scalar` on the remaining elements.
+ */
+template <typename PackedOperation, typename ScalarOperation>
+inline auto for_each_pack(
+    size_t count, PackedOperation packed, ScalarOperation scalar
+) -> void {
+    auto index = size_t{0};
+
+    for (; index + FloatPack::width <= count; index += FloatPack::width) {
+        packed(index);
+    }
+
+    for (; index < count; ++index) {
+        scalar(index);
+    }
+}
+
+}  // namespace Detail
+
+template <>
+struct LaneKernels<float> {
+    using Pack = Detail::FloatPack;
+
+    constexpr static auto enabled = true;
+
+    static auto add(
+        const float* lhs, const float* rhs, float* out, size_t count
+    ) -> void {
+        Detail::for_each_pack(
+            count,
+            [&](size_t i) {
+                Pack::store(
+                    out + i, Pack::add(Pack::load(lhs + i), Pack::load(rhs + i))
+                );
+            },
+            [&](size_t i) { out[i] = lhs[i] + rhs[i]; }
+        );
+    }
+
+    static auto subtract(
+        const float* lhs, const float* rhs, float* out, size_t count
+    ) -> void {
+        Detail::for_each_pack(
+            count,
+            [&](size_t i) {
+                Pack::store(
+                    out + i,
+                    Pack::subtract(Pack::load(lhs + i), Pack::load(rhs + i))
+                );
+            },
+            [&](size_t i) { out[i] = lhs[i] - rhs[i]; }
+        );
+    }
+
+    static auto multiply(
+        const float* lhs, const float* rhs, float* out, size_t count
+    ) -> void {
+        Detail::for_each_pack(
+            count,
+            [&](size_t i) {
+                Pack::store(
+                    out + i,
+                    Pack::multiply(Pack::load(lhs + i), Pack::load(rhs + i))
+                );
+            },
+            [&](size_t i) { out[i] = lhs[i] * rhs[i]; }
+        );
+    }
+
+    static auto scale(const float* lhs, float scalar, float* out, size_t count)
+        -> void {
+        const auto broadcast = Pack::broadcast(scalar);
+
+        Detail::for_each_pack(
+            count,
+            [&](size_t i) {
+                Pack::store(
+                    out + i, Pack::multiply(Pack::load(lhs + i), broadcast)
+                );
+            },
+            [&](size_t i) { out[i] = lhs[i] * scalar; }
+        );
+    }
+
+    /// Computes `out = lhs * rhs + addend`.
+    static auto multiply_add(
+        const float* lhs,
+        const float* rhs,
+        const float* addend,
+        float* out,
+        size_t count
+    ) -> void {
+        Detail::for_each_pack(
+            count,
+            [&](size_t i) {
+                Pack::store(
+                    out + i,
+                    Pack::multiply_add(
+                        Pack::load(lhs + i),
+                        Pack::load(rhs + i),
+                        Pack::load(addend + i)
+                    )
+                );
+            },
+            [&](size_t i) { out[i] = lhs[i] * rhs[i] + addend[i]; }
+        );
+    }
+
+    /// Computes `out = lhs * scalar + addend`.
+    static auto scale_add(
+        const float* lhs,
+        float scalar,
+        const float* addend,
+        float* out,
+        size_t count
+    ) -> void {
+        const auto broadcast = Pack::broadcast(scalar);
+
+        Detail::for_each_pack(
+            count,
+            [&](size_t i) {
+                Pack::store(
+                    out + i,
+                    Pack::multiply_add(
+                        Pack::load(lhs + i), broadcast, Pack::load(addend + i)
+                    )
+                );
+            },
+            [&](size_t i) { out[i] = lhs[i] * scalar + addend[i]; }
+        );
+    }
+
+    static auto sqrt(const float* value, float* out, size_t count) -> void {
+        Detail::for_each_pack(
+            count,
+            [&](size_t i) {
+                Pack::store(out + i, Pack::sqrt(Pack::load(value + i)));
+            },
+            [&](size_t i) { out[i] = std::sqrt(value[i]); }
+        );
+    }
+
+    /// Computes `out = lhs / rhs`, or zero where `rhs` is zero.
+    static auto divide_or_zero(
+        const float* lhs, const float* rhs, float* out, size_t count
+    ) -> void {
+        Detail::for_each_pack(
+            count,
+            [&](size_t i) {
+                const auto divisor = Pack::load(rhs + i);
+                Pack::store(
+                    out + i,
+                    Pack::select_non_zero(
+                        divisor, Pack::divide(Pack::load(lhs + i), divisor)
+                    )
+                );
+            },
+            [&](size_t i) {
+                out[i] = rhs[i] == 0.0F ? 0.0F : lhs[i] / rhs[i];
+            }
+        );
+    }
+
+    /**
+     * \brief Transforms `count` vectors stored as x, y and z lanes by a
+     * row-major 4x4 matrix, treating each vector as the row vector
+     * `[x, y, z, w]`. The output lanes may alias the input lanes.
+     */
+    static auto transform3(
+        const float* matrix,
+        const std::array<const float*, 3>& in,
+        const std::array<float*, 3>& out,
+        size_t count,
+        float w
+    ) -> void {
+        const auto column = [&](size_t j) {
+            return std::array{
+                matrix[j],
+                matrix[4 + j],
+                matrix[8 + j],
+                w * matrix[12 + j],
+            };
+        };
+
+        const auto columns = std::array{column(0), column(1), column(2)};
+
+        const auto broadcast_column = [&](size_t j) {
+            return Pack::Column{
+                Pack::broadcast(columns[j][0]),
+                Pack::broadcast(columns[j][1]),
+                Pack::broadcast(columns[j][2]),
+                Pack::broadcast(columns[j][3]),
+            };
+        };
+
+        const auto packed_columns = std::array{
+            broadcast_column(0), broadcast_column(1), broadcast_column(2)
+        };
+
+        Detail::for_each_pack(
+            count,
+            [&](size_t i) {
+                const auto x = Pack::load(in[0] + i);
+                const auto y = Pack::load(in[1] + i);
+                const auto z = Pack::load(in[2] + i);
+
+                const auto out_x = packed_columns[0].transform(x, y, z);
+                const auto out_y = packed_columns[1].transform(x, y, z);
+                const auto out_z = packed_columns[2].transform(x, y, z);
+
+                Pack::store(out[0] + i, out_x);
+                Pack::store(out[1] + i, out_y);
+                Pack::store(out[2] + i, out_z);
+            },
+            [&](size_t i) {
+                const auto x = in[0][i];
+                const auto y = in[1][i];
+                const auto z = in[2][i];
+
+                for (size_t j = 0; j < 3; ++j) {
+                    const auto& c = columns[j];
+                    out[j][i] = x * c[0] + y * c[1] + z * c[2] + c[3];
+                }
+            }
+        );
+    }
+
+    /**
+     * \brief Tests `count` spheres against six planes `[a, b, c, d]` and sets
+     * bit `i % 64` of `visible[i / 64]` for every sphere that is not entirely
+     * behind one of them. The bits must be cleared beforehand.
+     */
+    static auto cull_spheres(
+        const std::array<std::array<float, 4>, 6>& planes,
+        const std::array<const float*, 3>& centers,
+        const float* radii,
+        uint64_t* visible,
+        size_t count
+    ) -> void {
+        const auto packed_planes = broadcast_planes(planes);
+
+        Detail::for_each_pack(
+            count,
+            [&](size_t i) {
+                const auto x = Pack::load(centers[0] + i);
+                const auto y = Pack::load(centers[1] + i);
+                const auto z = Pack::load(centers[2] + i);
+                const auto negative_radius = Pack::subtract(
+                    Pack::broadcast(0.0F), Pack::load(radii + i)
+                );
+
+                auto inside = Pack::greater_equal(
+                    packed_planes[0].transform(x, y, z), negative_radius
+                );
+                for (size_t p = 1; p < packed_planes.size(); ++p) {
+                    inside = Pack::bitwise_and(
+                        inside,
+                        Pack::greater_equal(
+                            packed_planes[p].transform(x, y, z),
+                            negative_radius
+                        )
+                    );
+                }
+
+                visible[i / 64] |= Pack::bits(inside) << (i % 64);
+            },
+            [&](size_t i) {
+                auto inside = true;
+                for (const auto& plane : planes) {
+                    inside &= plane[0] * centers[0][i] +
+                                  plane[1] * centers[1][i] +
+                                  plane[2] * centers[2][i] + plane[3] >=
+                              -radii[i];
+                }
+
+                visible[i / 64] |= uint64_t{inside} << (i % 64);
+            }
+        );
+    }
+
+    /**
+     * \brief Tests `count` axis-aligned boxes against six planes
+     * `[a, b, c, d]` and sets bit `i % 64` of `visible[i / 64]` for every box
+     * that is not entirely behind one of them. `corners[p]` holds the x, y
+     * and z lanes of the box corners furthest along the normal of plane `p`.
+     * The bits must be cleared beforehand.
+     */
+    static auto cull_boxes(
+        const std::array<std::array<float, 4>, 6>& planes,
+        const std::array<std::array<const float*, 3>, 6>& corners,
+        uint64_t* visible,
+        size_t count
+    ) -> void {
+        const auto packed_planes = broadcast_planes(planes);
+
+        const auto corner_distance = [&](size_t p, size_t i) {
+            return packed_planes[p].transform(
+                Pack::load(corners[p][0] + i),
+                Pack::load(corners[p][1] + i),
+                Pack::load(corners[p][2] + i)
+            );
+        };
+
+        Detail::for_each_pack(
+            count,
+            [&](size_t i) {
+                const auto zero = Pack::broadcast(0.0F);
+
+                auto inside = Pack::greater_equal(corner_distance(0, i), zero);
+                for (size_t p = 1; p < packed_planes.size(); ++p) {
+                    inside = Pack::bitwise_and(
+                        inside, Pack::greater_equal(corner_distance(p, i), zero)
+                    );
+                }
+
+                visible[i / 64] |= Pack::bits(inside) << (i % 64);
+            },
+            [&](size_t i) {
+                auto inside = true;
+                for (size_t p = 0; p < planes.size(); ++p) {
+                    const auto& plane = planes[p];
+                    inside &= plane[0] * corners[p][0][i] +
+                                  plane[1] * corners[p][1][i] +
+                                  plane[2] * corners[p][2][i] + plane[3] >=
+                              0.0F;
+                }
+
+                visible[i / 64] |= uint64_t{inside} << (i % 64);
+            }
+        );
+    }
+
+private:
+    [[nodiscard]] static auto broadcast_planes(
+        const std::array<std::array<float, 4>, 6>& planes
+    ) -> std::array<Pack::Column, 6> {
+        auto result = std::array<Pack::Column, 6>{};
+        for (size_t p = 0; p < planes.size(); ++p) {
+            result[p] = Pack::Column{
+                Pack::broadcast(planes[p][0]),
+                Pack::broadcast(planes[p][1]),
+                Pack::broadcast(planes[p][2]),
+                Pack::broadcast(planes[p][3]),
+            };
+        }
+        return result;
+    }
+};
+
+template <>
+struct ScalarKernels<float> {
+    constexpr static auto enabled = true;
+
+    /**
+     * \brief Returns the 12-bit hardware estimate of `1 / sqrt(value)`
+     * refined by one Newton step.
+     */
+    [[nodiscard]] static auto rsqrt(float value) -> float {
+        const auto input = _mm_set_ss(value);
+        const auto estimate = _mm_rsqrt_ss(input);
+
+        // estimate * (1.5 - 0.5 * value * estimate^2)
+        const auto half_input = _mm_mul_ss(input, _mm_set_ss(0.5F));
+        const auto square = _mm_mul_ss(estimate, estimate);
+        const auto correction = _mm_sub_ss(
+            _mm_set_ss(1.5F), _mm_mul_ss(half_input, square)
+        );
+        return _mm_cvtss_f32(_mm_mul_ss(estimate, correction));
+    }
+};
+
+template <>
+struct PackKernels<float> {
+    constexpr static auto enabled = true;
+
+    /**
+     * \brief Quantizes `value` to signed normalized integers of type `I`:
+     * clamped to [-1, 1], scaled by the largest `I` and rounded to nearest
+     * even. NaN is quantized to -1.
+     */
+    template <typename I>
+        requires(sizeof(I) <= 2)
+    static auto encode_snorm(const float* value, I* out, size_t count)
+        -> void {
+        const auto scale = static_cast<float>(std::numeric_limits<I>::max());
+        const auto lower = _mm_set1_ps(-1.0F);
+        const auto upper = _mm_set1_ps(1.0F);
+        const auto scales = _mm_set1_ps(scale);
+
+        const auto quantize = [&](const float* source) {
+            // _mm_max_ps returns its second operand for NaN.
+            const auto clamped =
+                _mm_min_ps(_mm_max_ps(_mm_loadu_ps(source), lower), upper);
+            return _mm_cvtps_epi32(_mm_mul_ps(clamped, scales));
+        };
+
+        auto index = size_t{0};
+        for (; index + 8 <= count; index += 8) {
+            const auto words = _mm_packs_epi32(
+                quantize(value + index), quantize(value + index + 4)
+            );
+            auto* destination = reinterpret_cast<__m128i*>(out + index);
+
+            if constexpr (sizeof(I) == 1) {
+                _mm_storel_epi64(destination, _mm_packs_epi16(words, words));
+            } else {
+                _mm_storeu_si128(destination, words);
+            }
+        }
+
+        for (; index < count; ++index) {
+            const auto lowered = value[index] >= -1.0F ? value[index] : -1.0F;
+            const auto clamped = std::min(lowered, 1.0F);
+            out[index] = static_cast<I>(std::rint(clamped * scale));
+        }
+    }
+
+    /**
+     * \brief Expands signed normalized integers of type `I` back to floats
+     * in [-1, 1].
+     */
+    template <typename I>
+        requires(sizeof(I) <= 2)
+    static auto decode_snorm(const I* value, float* out, size_t count)
+        -> void {
+        const auto inverse =
+            1.0F / static_cast<float>(std::numeric_limits<I>::max());
+        const auto lower = _mm_set1_ps(-1.0F);
+        const auto inverses = _mm_set1_ps(inverse);
+
+        const auto expand = [&](__m128i integers, float* destination) {
+            const auto values = _mm_mul_ps(_mm_cvtepi32_ps(integers), inverses);
+            _mm_storeu_ps(destination, _mm_max_ps(values, lower));
+        };
+
+        auto index = size_t{0};
+        for (; index + 8 <= count; index += 8) {
+            const auto* source =
+                reinterpret_cast<const __m128i*>(value + index);
+
+            // Duplicating each element into both halves of a wider one and
+            // shifting it back down sign extends it.
+            auto words = __m128i{};
+            if constexpr (sizeof(I) == 1) {
+                const auto bytes = _mm_loadl_epi64(source);
+                words = _mm_srai_epi16(_mm_unpacklo_epi8(bytes, bytes), 8);
+            } else {
+                words = _mm_loadu_si128(source);
+            }
+
+            expand(
+                _mm_srai_epi32(_mm_unpacklo_epi16(words, words), 16),
+                out + index
+            );
+            expand(
+                _mm_srai_epi32(_mm_unpackhi_epi16(words, words), 16),
+                out + index + 4
+            );
+        }
+
+        for (; index < count; ++index) {
+            out[index] =
+                std::max(static_cast<float>(value[index]) * inverse, -1.0F);
+        }
+    }
+
+    /**
+     * \brief Encodes the directions `(x, y, z)` as octahedral normals: two
+     * snorm16 coordinates, u in the low half. Rounds exactly like the scalar
+     * `OctahedralNormal` constructor.
+     */
+    static auto encode_octahedral(
+        const float* x, const float* y, const float* z, uint32_t* out,
+        size_t count
+    ) -> void {
+        const auto encode = [](__m128 x, __m128 y, __m128 z) {
+            const auto zero = _mm_setzero_ps();
+            const auto one = _mm_set1_ps(1.0F);
+            const auto sign = _mm_set1_ps(-0.0F);
+
+            const auto l1_norm = _mm_add_ps(
+                _mm_add_ps(_mm_andnot_ps(sign, x), _mm_andnot_ps(sign, y)),
+                _mm_andnot_ps(sign, z)
+            );
+            const auto inverse = _mm_div_ps(
+                one,
+                _mm_max_ps(
+                    _mm_set1_ps(std::numeric_limits<float>::min()), l1_norm
+                )
+            );
+            const auto u = _mm_mul_ps(x, inverse);
+            const auto v = _mm_mul_ps(y, inverse);
+
+            // (1 - |v|) * (u >= 0 ? 1 : -1), and the same for v.
+            const auto folded_u = _mm_xor_ps(
+                _mm_sub_ps(one, _mm_andnot_ps(sign, v)),
+                _mm_and_ps(_mm_cmpnge_ps(u, zero), sign)
+            );
+            const auto folded_v = _mm_xor_ps(
+                _mm_sub_ps(one, _mm_andnot_ps(sign, u)),
+                _mm_and_ps(_mm_cmpnge_ps(v, zero), sign)
+            );
+
+            const auto lower = _mm_cmplt_ps(z, zero);
+            const auto quantize = [&](__m128 value) {
+                const auto clamped =
+                    _mm_min_ps(_mm_max_ps(value, _mm_set1_ps(-1.0F)), one);
+                return _mm_cvtps_epi32(
+                    _mm_mul_ps(clamped, _mm_set1_ps(32767.0F))
+                );
+            };
+            const auto u_bits = quantize(_mm_or_ps(
+                _mm_and_ps(lower, folded_u), _mm_andnot_ps(lower, u)
+            ));
+            const auto v_bits = quantize(_mm_or_ps(
+                _mm_and_ps(lower, folded_v), _mm_andnot_ps(lower, v)
+            ));
+
+            return _mm_or_si128(
+                _mm_and_si128(u_bits, _mm_set1_epi32(0xFFFF)),
+                _mm_slli_epi32(v_bits, 16)
+            );
+        };
+
+        auto index = size_t{0};
+        for (; index + 4 <= count; index += 4) {
+            _mm_storeu_si128(
+                reinterpret_cast<__m128i*>(out + index),
+                encode(
+                    _mm_loadu_ps(x + index),
+                    _mm_loadu_ps(y + index),
+                    _mm_loadu_ps(z + index)
+                )
+            );
+        }
+
+        // The remainder goes through the same code, padded with zeros.
+        if (index < count) {
+            auto lanes = std::array<std::array<float, 4>, 3>{};
+            for (size_t i = 0; index + i < count; ++i) {
+                lanes[0][i] = x[index + i];
+                lanes[1][i] = y[index + i];
+                lanes[2][i] = z[index + i];
+            }
+
+            auto bits = std::array<uint32_t, 4>{};
+            _mm_storeu_si128(
+                reinterpret_cast<__m128i*>(bits.data()),
+                encode(
+                    _mm_loadu_ps(lanes[0].data()),
+                    _mm_loadu_ps(lanes[1].data()),
+                    _mm_loadu_ps(lanes[2].data())
+                )
+            );
+            for (size_t i = 0; index + i < count; ++i) {
+                out[index + i] = bits[i];
+            }
+        }
+    }
+
+    /**
+     * \brief Decodes octahedral normals to the unit vectors `(x, y, z)`.
+     * Rounds exactly like `OctahedralNormal::to_vector`.
+     */
+    static auto decode_octahedral(
+        const uint32_t* in, float* x, float* y, float* z, size_t count
+    ) -> void {
+        const auto decode = [](__m128i bits, float* x, float* y, float* z) {
+            const auto one = _mm_set1_ps(1.0F);
+            const auto sign = _mm_set1_ps(-0.0F);
+            const auto inverse = _mm_set1_ps(1.0F / 32767.0F);
+
+            const auto expand = [&](__m128i integers) {
+                return _mm_max_ps(
+                    _mm_mul_ps(_mm_cvtepi32_ps(integers), inverse),
+                    _mm_set1_ps(-1.0F)
+                );
+            };
+            const auto u = expand(_mm_srai_epi32(_mm_slli_epi32(bits, 16), 16));
+            const auto v = expand(_mm_srai_epi32(bits, 16));
+
+            // z = 1 - |u| - |v|, and the lower hemisphere is unfolded by
+            // moving u and v towards 0 by max(-z, 0).
+            const auto unfolded_z = _mm_sub_ps(
+                _mm_sub_ps(one, _mm_andnot_ps(sign, u)),
+                _mm_andnot_ps(sign, v)
+            );
+            const auto unfold =
+                _mm_max_ps(_mm_xor_ps(unfolded_z, sign), _mm_setzero_ps());
+            const auto unfolded_x = _mm_sub_ps(
+                u, _mm_or_ps(unfold, _mm_and_ps(u, sign))
+            );
+            const auto unfolded_y = _mm_sub_ps(
+                v, _mm_or_ps(unfold, _mm_and_ps(v, sign))
+            );
+
+            const auto length = _mm_sqrt_ps(_mm_add_ps(
+                _mm_add_ps(
+                    _mm_mul_ps(unfolded_x, unfolded_x),
+                    _mm_mul_ps(unfolded_y, unfolded_y)
+                ),
+                _mm_mul_ps(unfolded_z, unfolded_z)
+            ));
+            _mm_storeu_ps(x, _mm_div_ps(unfolded_x, length));
+            _mm_storeu_ps(y, _mm_div_ps(unfolded_y, length));
+            _mm_storeu_ps(z, _mm_div_ps(unfolded_z, length));
+        };
+
+        auto index = size_t{0};
+        for (; index + 4 <= count; index += 4) {
+            decode(
+                _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + index)),
+                x + index,
+                y + index,
+                z + index
+            );
+        }
+
+        if (index < count) {
+            auto bits = std::array<uint32_t, 4>{};
+            for (size_t i = 0; index + i < count; ++i) {
+                bits[i] = in[index + i];
+            }
+
+            auto lanes = std::array<std::array<float, 4>, 3>{};
+            decode(
+                _mm_loadu_si128(reinterpret_cast<const __m128i*>(bits.data())),
+                lanes[0].data(),
+                lanes[1].data(),
+                lanes[2].data()
+            );
+            for (size_t i = 0; index + i < count; ++i) {
+                x[index + i] = lanes[0][i];
+                y[index + i] = lanes[1][i];
+                z[index + i] = lanes[2][i];
+            }
+        }
+    }
+
+#if LUMINOL_MATHS_HAS_F16C
+    /**
+     * \brief Converts `value` to the bits of IEEE 754 half precision floats,
+     * rounded to nearest even.
+     */
+    static auto encode_half(const float* value, uint16_t* out, size_t count)
+        -> void {
+        auto index = size_t{0};
+        for (; index + 8 <= count; index += 8) {
+            const auto halves = _mm256_cvtps_ph(
+                _mm256_loadu_ps(value + index), _MM_FROUND_TO_NEAREST_INT
+            );
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(out + index), halves);
+        }
+
+        for (; index < count; ++index) {
+            const auto halves = _mm_cvtps_ph(
+                _mm_set_ss(value[index]), _MM_FROUND_TO_NEAREST_INT
+            );
+            out[index] = static_cast<uint16_t>(_mm_extract_epi16(halves, 0));
+        }
+    }
+
+    /**
+     * \brief Converts the bits of IEEE 754 half precision floats to floats,
+     * which is exact.
+     */
+    static auto decode_half(const uint16_t* value, float* out, size_t count)
+        -> void {
+        auto index = size_t{0};
+        for (; index + 8 <= count; index += 8) {
+            const auto halves = _mm_loadu_si128(
+                reinterpret_cast<const __m128i*>(value + index)
+            );
+            _mm256_storeu_ps(out + index, _mm256_cvtph_ps(halves));
+        }
+
+        for (; index < count; ++index) {
+            const auto halves = _mm_cvtsi32_si128(value[index]);
+            out[index] = _mm_cvtss_f32(_mm_cvtph_ps(halves));
+        }
+    }
+#endif
+};
+
+template <>
+struct QuadKernels<float> {
+    constexpr static auto enabled = true;
+
+    /**
+     * \brief Intersects a ray with the four boxes and returns a 4-bit mask of
+     * the boxes it enters within `[0, max_distance]`, in multiples of the
+     * direction. Rays lying in a plane of a box are inside of it, as in
+     * `BVH::clip_slab`.
+     */
+    [[nodiscard]] static auto intersect_ray(
+        const float* boxes,
+        const std::array<float, 3>& origin,
+        const std::array<float, 3>& inverse_direction,
+        float max_distance
+    ) -> uint32_t {
+        auto near = _mm_setzero_ps();
+        auto far = _mm_set1_ps(max_distance);
+        for (size_t axis = 0; axis < 3; ++axis) {
+            const auto start = _mm_set1_ps(origin[axis]);
+            const auto inverse = _mm_set1_ps(inverse_direction[axis]);
+
+            const auto lower = _mm_mul_ps(
+                _mm_sub_ps(_mm_loadu_ps(boxes + axis * 4), start), inverse
+            );
+            const auto upper = _mm_mul_ps(
+                _mm_sub_ps(_mm_loadu_ps(boxes + 12 + axis * 4), start),
+                inverse
+            );
+
+            // A slab with a NaN distance, a ray lying in one of its planes,
+            // does not bound the ray. Its entry and exit are set to NaN, all
+            // bits set, so the maximum and minimum keep their second operand.
+            const auto parallel = _mm_cmpunord_ps(lower, upper);
+            near = _mm_max_ps(
+                _mm_or_ps(_mm_min_ps(lower, upper), parallel), near
+            );
+            far = _mm_min_ps(
+                _mm_or_ps(_mm_max_ps(lower, upper), parallel), far
+            );
+        }
+
+        return static_cast<uint32_t>(_mm_movemask_ps(_mm_cmple_ps(near, far)));
+    }
+
+    /**
+     * \brief Returns a 4-bit mask of the boxes sharing at least one point with
+     * the box from `min` to `max`.
+     */
+    [[nodiscard]] static auto overlap(
+        const float* boxes,
+        const std::array<float, 3>& min,
+        const std::array<float, 3>& max
+    ) -> uint32_t {
+        auto inside = _mm_castsi128_ps(_mm_set1_epi32(-1));
+        for (size_t axis = 0; axis < 3; ++axis) {
+            inside = _mm_and_ps(
+                inside,
+                _mm_cmple_ps(
+                    _mm_loadu_ps(boxes + axis * 4), _mm_set1_ps(max[axis])
+                )
+            );
+            inside = _mm_and_ps(
+                inside,
+                _mm_cmpge_ps(
+                    _mm_loadu_ps(boxes + 12 + axis * 4),
+                    _mm_set1_ps(min[axis])
+                )
+            );
+        }
+        return static_cast<uint32_t>(_mm_movemask_ps(inside));
+    }
+
+    /**
+     * \brief Writes the squared distance from the point to each of the four
+     * boxes, 0 for the boxes containing it.
+     */
+    static auto squared_distance(
+        const float* boxes, const std::array<float, 3>& point, float* out
+    ) -> void {
+        const auto zero = _mm_setzero_ps();
+
+        auto result = zero;
+        for (size_t axis = 0; axis < 3; ++axis) {
+            const auto coordinate = _mm_set1_ps(point[axis]);
+            const auto below =
+                _mm_sub_ps(_mm_loadu_ps(boxes + axis * 4), coordinate);
+            const auto above =
+                _mm_sub_ps(coordinate, _mm_loadu_ps(boxes + 12 + axis * 4));
+            const auto offset = _mm_max_ps(_mm_max_ps(below, above), zero);
+            result = Detail::multiply_add(offset, offset, result);
+        }
+        _mm_storeu_ps(out, result);
+    }
+};
+
+template <>
+struct VectorKernels<float, 4> {
+    constexpr static auto enabled = true;
+
+    static auto add(const float* lhs, const float* rhs, float* out) -> void {
+        _mm_storeu_ps(out, _mm_add_ps(_mm_loadu_ps(lhs), _mm_loadu_ps(rhs)));
+    }
+
+    static auto subtract(const float* lhs, const float* rhs, float* out)
+        -> void {
+        _mm_storeu_ps(out, _mm_sub_ps(_mm_loadu_ps(lhs), _mm_loadu_ps(rhs)));
+    }
+
+    static auto multiply(const float* lhs, const float* rhs, float* out)
+        -> void {
+        _mm_storeu_ps(out, _mm_mul_ps(_mm_loadu_ps(lhs), _mm_loadu_ps(rhs)));
+    }
+
+    static auto scale(const float* lhs, float scalar, float* out) -> void {
+        _mm_storeu_ps(out, _mm_mul_ps(_mm_loadu_ps(lhs), _mm_set1_ps(scalar)));
+    }
+
+    static auto divide(const float* lhs, float scalar, float* out) -> void {
+        _mm_storeu_ps(out, _mm_div_ps(_mm_loadu_ps(lhs), _mm_set1_ps(scalar)));
+    }
+
+    static auto negate(const float* lhs, float* out) -> void {
+        _mm_storeu_ps(out, _mm_xor_ps(_mm_loadu_ps(lhs), _mm_set1_ps(-0.0F)));
+    }
+
+    [[nodiscard]] static auto dot(const float* lhs, const float* rhs)
+        -> float {
+        return Detail::horizontal_sum(
+            _mm_mul_ps(_mm_loadu_ps(lhs), _mm_loadu_ps(rhs))
+        );
+    }
+};
+
+template <>
+struct VectorKernels<float, 3> {
+    constexpr static auto enabled = true;
+
+    [[nodiscard]] static auto dot(const float* lhs, const float* rhs)
+        -> float {
+        return Detail::horizontal_sum(
+            _mm_mul_ps(Detail::load3(lhs), Detail::load3(rhs))
+        );
+    }
+
+    static auto cross(const float* lhs, const float* rhs, float* out) -> void {
+        const auto lhs_xyz = Detail::load3(lhs);
+        const auto rhs_xyz = Detail::load3(rhs);
+
+        const auto lhs_yzx =
+            _mm_shuffle_ps(lhs_xyz, lhs_xyz, _MM_SHUFFLE(3, 0, 2, 1));
+        const auto rhs_yzx =
+            _mm_shuffle_ps(rhs_xyz, rhs_xyz, _MM_SHUFFLE(3, 0, 2, 1));
+
+        // (lhs * rhs.yzx - lhs.yzx * rhs) gives the cross product in zxy
+        // order, a final shuffle puts it back into xyz.
+        const auto crossed = _mm_sub_ps(
+            _mm_mul_ps(lhs_xyz, rhs_yzx), _mm_mul_ps(lhs_yzx, rhs_xyz)
+        );
+
+        Detail::store3(
+            out, _mm_shuffle_ps(crossed, crossed, _MM_SHUFFLE(3, 0, 2, 1))
+        );
+    }
+};
+
+/**
+ * \brief Products whose rows have four columns, such as 4x4 * 4x4 and
+ * 3x4 * 4x4. Each output row is the sum of the rows of `rhs` scaled by the
+ * broadcast elements of the matching `lhs` row, so a row never leaves its
+ * register.
+ */
+template <size_t M, size_t K>
+    requires(K >= 1 && K <= 4)
+struct ProductKernels<float, M, K, 4> {
+    constexpr static auto enabled = true;
+
+    static auto multiply(const float* lhs, const float* rhs, float* out)
+        -> void {
+        for (size_t i = 0; i < M; ++i) {
+            const auto* lhs_row = lhs + i * K;
+
+            auto row = _mm_mul_ps(_mm_set1_ps(lhs_row[0]), _mm_loadu_ps(rhs));
+            for (size_t k = 1; k < K; ++k) {
+                row = Detail::multiply_add(
+                    _mm_set1_ps(lhs_row[k]), _mm_loadu_ps(rhs + k * 4), row
+                );
+            }
+
+            _mm_storeu_ps(out + i * 4, row);
+        }
+    }
+};
+
+/**
+ * \brief Products whose rows have three columns, such as 4x4 * 4x3 and
+ * 3x4 * 4x3. Same scheme as the four column rows, with the rows loaded and
+ * stored three lanes at a time.
+ */
+template <size_t M, size_t K>
+    requires(K >= 1 && K <= 4)
+struct ProductKernels<float, M, K, 3> {
+    constexpr static auto enabled = true;
+
+    static auto multiply(const float* lhs, const float* rhs, float* out)
+        -> void {
+        for (size_t i = 0; i < M; ++i) {
+            const auto* lhs_row = lhs + i * K;
+
+            auto row = _mm_mul_ps(_mm_set1_ps(lhs_row[0]), Detail::load3(rhs));
+            for (size_t k = 1; k < K; ++k) {
+                row = Detail::multiply_add(
+                    _mm_set1_ps(lhs_row[k]), Detail::load3(rhs + k * 3), row
+                );
+            }
+
+            Detail::store3(out + i * 3, row);
+        }
+    }
+};
+
+template <>
+struct MatrixKernels<float, 4, 4> {
+    constexpr static auto enabled = true;
+
+    static auto add(const float* lhs, const float* rhs, float* out) -> void {
+        for (size_t i = 0; i < 16; i += 4) {
+            const auto sum =
+                _mm_add_ps(_mm_loadu_ps(lhs + i), _mm_loadu_ps(rhs + i));
+            _mm_storeu_ps(out + i, sum);
+        }
+    }
+
+    static auto subtract(const float* lhs, const float* rhs, float* out)
+        -> void {
+        for (size_t i = 0; i < 16; i += 4) {
+            const auto difference =
+                _mm_sub_ps(_mm_loadu_ps(lhs + i), _mm_loadu_ps(rhs + i));
+            _mm_storeu_ps(out + i, difference);
+        }
+    }
+
+    static auto scale(const float* lhs, float scalar, float* out) -> void {
+        const auto broadcast = _mm_set1_ps(scalar);
+        for (size_t i = 0; i < 16; i += 4) {
+            _mm_storeu_ps(
+                out + i, _mm_mul_ps(_mm_loadu_ps(lhs + i), broadcast)
+            );
+        }
+    }
+
+    static auto transpose(const float* matrix, float* out) -> void {
+        auto row0 = _mm_loadu_ps(matrix);
+        auto row1 = _mm_loadu_ps(matrix + 4);
+        auto row2 = _mm_loadu_ps(matrix + 8);
+        auto row3 = _mm_loadu_ps(matrix + 12);
+
+        _MM_TRANSPOSE4_PS(row0, row1, row2, row3);
+
+        _mm_storeu_ps(out, row0);
+        _mm_storeu_ps(out + 4, row1);
+        _mm_storeu_ps(out + 8, row2);
+        _mm_storeu_ps(out + 12, row3);
+    }
+
+    /**
+     * \brief Transforms `count` packed `[x, y, z, w]` row vectors by the
+     * matrix. The output may alias the input.
+     */
+    static auto transform_vectors4(
+        const float* matrix, const float* in, float* out, size_t count
+    ) -> void {
+        const auto row0 = _mm_loadu_ps(matrix);
+        const auto row1 = _mm_loadu_ps(matrix + 4);
+        const auto row2 = _mm_loadu_ps(matrix + 8);
+        const auto row3 = _mm_loadu_ps(matrix + 12);
+
+        for (size_t i = 0; i < count * 4; i += 4) {
+            const auto* vector = in + i;
+
+            auto result = _mm_mul_ps(_mm_set1_ps(vector[3]), row3);
+            result = Detail::multiply_add(_mm_set1_ps(vector[2]), row2, result);
+            result = Detail::multiply_add(_mm_set1_ps(vector[1]), row1, result);
+            result = Detail::multiply_add(_mm_set1_ps(vector[0]), row0, result);
+
+            _mm_storeu_ps(out + i, result);
+        }
+    }
+
+    /**
+     * \brief Transforms `count` packed `[x, y, z]` vectors by the matrix,
+     * treating each as the row vector `[x, y, z, w]` and discarding the
+     * resulting w. Four vectors at a time are de-interleaved into x, y and z
+     * registers, transformed, and interleaved back. The output may alias the
+     * input.
+     */
+    static auto transform_vectors3(
+        const float* matrix, const float* in, float* out, size_t count, float w
+    ) -> void {
+        const auto broadcast_column = [&](size_t j) {
+            return Detail::SseColumn{
+                _mm_set1_ps(matrix[j]),
+                _mm_set1_ps(matrix[4 + j]),
+                _mm_set1_ps(matrix[8 + j]),
+                _mm_set1_ps(w * matrix[12 + j]),
+            };
+        };
+
+        const auto columns = std::array{
+            broadcast_column(0), broadcast_column(1), broadcast_column(2)
+        };
+
+        const auto transform_column =
+            [&](size_t j, __m128 x, __m128 y, __m128 z) {
+                return columns.at(j).transform(x, y, z);
+            };
+
+        auto index = size_t{0};
+
+        for (; index + 4 <= count; index += 4) {
+            const auto* source = in + index * 3;
+            auto* destination = out + index * 3;
+
+            // [x0 y0 z0 x1] [y1 z1 x2 y2] [z2 x3 y3 z3]
+            const auto a0 = _mm_loadu_ps(source);
+            const auto a1 = _mm_loadu_ps(source + 4);
+            const auto a2 = _mm_loadu_ps(source + 8);
+
+            const auto x2_x3 = _mm_shuffle_ps(a1, a2, _MM_SHUFFLE(1, 0, 0, 2));
+            const auto x = _mm_shuffle_ps(a0, x2_x3, _MM_SHUFFLE(3, 0, 3, 0));
+
+            const auto y0_y1 = _mm_shuffle_ps(a0, a1, _MM_SHUFFLE(0, 0, 0, 1));
+            const auto y2_y3 = _mm_shuffle_ps(a1, a2, _MM_SHUFFLE(0, 2, 0, 3));
+            const auto y =
+                _mm_shuffle_ps(y0_y1, y2_y3, _MM_SHUFFLE(2, 0, 2, 0));
+
+            const auto z0_z1 = _mm_shuffle_ps(a0, a1, _MM_SHUFFLE(0, 1, 0, 2));
+            const auto z = _mm_shuffle_ps(z0_z1, a2, _MM_SHUFFLE(3, 0, 2, 0));
+
+            const auto out_x = transform_column(0, x, y, z);
+            const auto out_y = transform_column(1, x, y, z);
+            const auto out_z = transform_column(2, x, y, z);
+
+            // Interleave back into [x0 y0 z0 x1] [y1 z1 x2 y2] [z2 x3 y3 z3]
+            const auto xy_low = _mm_unpacklo_ps(out_x, out_y);
+            const auto xy_high = _mm_unpackhi_ps(out_x, out_y);
+            const auto yz_low = _mm_unpacklo_ps(out_y, out_z);
+
+            const auto z0_x1 =
+                _mm_shuffle_ps(out_z, out_x, _MM_SHUFFLE(1, 0, 0, 0));
+            const auto z2_x3 =
+                _mm_shuffle_ps(out_z, xy_high, _MM_SHUFFLE(0, 2, 0, 2));
+            const auto y3_z3 =
+                _mm_shuffle_ps(xy_high, out_z, _MM_SHUFFLE(3, 0, 0, 3));
+
+            _mm_storeu_ps(
+                destination,
+                _mm_shuffle_ps(xy_low, z0_x1, _MM_SHUFFLE(3, 0, 1, 0))
+            );
+            _mm_storeu_ps(
+                destination + 4,
+                _mm_shuffle_ps(yz_low, xy_high, _MM_SHUFFLE(1, 0, 3, 2))
+            );
+            _mm_storeu_ps(
+                destination + 8,
+                _mm_shuffle_ps(z2_x3, y3_z3, _MM_SHUFFLE(3, 0, 2, 0))
+            );
+        }
+
+        for (; index < count; ++index) {
+            const auto* source = in + index * 3;
+
+            const auto x = _mm_set1_ps(source[0]);
+            const auto y = _mm_set1_ps(source[1]);
+            const auto z = _mm_set1_ps(source[2]);
+
+            auto* destination = out + index * 3;
+            destination[0] = _mm_cvtss_f32(transform_column(0, x, y, z));
+            destination[1] = _mm_cvtss_f32(transform_column(1, x, y, z));
+            destination[2] = _mm_cvtss_f32(transform_column(2, x, y, z));
+        }
+    }
+};
+// NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+#endif
+
+}  // namespace Luminol::Maths::Simd
@@ -0,0 +1,390 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <concepts>
+#include <cstdint>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+#include <LuminolMaths/AABB.hpp>
+#include <LuminolMaths/BitMask.hpp>
+#include <LuminolMaths/Matrix.hpp>
+#include <LuminolMaths/Vector.hpp>
+
+namespace Luminol::Maths {
+
+/**
+ * \brief A bounding sphere, stored as its center and radius.
+ *
+ * A negative radius denotes the empty sphere, which is what the default
+ * constructor builds: it contains and overlaps nothing and merging it with
+ * another sphere returns that sphere. A sphere holding a single point has a
+ * radius of 0.
+ *
+ * \tparam T The underlying type of the coordinates.
+ */
+template <std::floating_point T>
+class Sphere {
+public:
+    /**
+     * \brief Constructs the empty sphere.
+     */
+    [[nodiscard]] constexpr Sphere() : sphere_center{}, sphere_radius{-1} {}
+
+    /**
+     * \brief Constructs a sphere from its center and radius.
+     * \param center The center of the sphere.
+     * \param radius The radius of the sphere, negative for the empty sphere.
+     */
+    [[nodiscard]] constexpr Sphere(const Vector<T, 3>& center, T radius)
+        : sphere_center{center}, sphere_radius{radius} {}
+
+    /**
+     * \brief Returns the sphere circumscribing a box.
+     * \param box The box to enclose.
+     * \return The sphere through the corners of the box, empty if the box is
+     * empty.
+     */
+    [[nodiscard]] static auto from_box(const AABB<T>& box) -> Sphere {
+        if (box.is_empty()) {
+            return Sphere{};
+        }
+        return Sphere{box.center(), box.extent().length()};
+    }
+
+    /**
+     * \brief Returns a sphere containing every point, centered on their
+     * bounding box. It is not the smallest such sphere, but needs only two
+     * passes over the points.
+     * \param points The points to enclose.
+     * \return The bounding sphere of the points, empty if there are none.
+     */
+    [[nodiscard]] static auto from_points(std::span<const Vector<T, 3>> points)
+        -> Sphere {
+        const auto box = AABB<T>::from_points(points);
+        if (box.is_empty()) {
+            return Sphere{};
+        }
+
+        const auto center = box.center();
+
+        auto squared_radius = T{0};
+        for (const auto& point : points) {
+            const auto offset = point - center;
+            squared_radius = std::max(squared_radius, offset.dot(offset));
+        }
+        return Sphere{center, std::sqrt(squared_radius)};
+    }
+
+    [[nodiscard]] constexpr auto center() const -> const Vector<T, 3>& {
+        return this->sphere_center;
+    }
+
+    [[nodiscard]] constexpr auto radius() const -> T {
+        return this->sphere_radius;
+    }
+
+    /**
+     * \brief Returns whether the sphere contains no point at all.
+     * \return Whether the radius is negative.
+     */
+    [[nodiscard]] constexpr auto is_empty() const -> bool {
+        return this->sphere_radius < T{0};
+    }
+
+    /**
+     * \brief Returns the smallest box containing the sphere.
+     * \return The bounding box of the sphere, empty if the sphere is empty.
+     */
+    [[nodiscard]] constexpr auto bounds() const -> AABB<T> {
+        if (this->is_empty()) {
+            return AABB<T>{};
+        }
+
+        const auto radius = this->sphere_radius;
+        return AABB<T>::from_center_extent(
+            this->sphere_center, Vector<T, 3>{radius, radius, radius}
+        );
+    }
+
+    /**
+     * \brief Returns whether the point lies inside of the sphere or on its
+     * boundary.
+     * \param point The point to test.
+     * \return Whether the point is inside of the sphere.
+     */
+    [[nodiscard]] constexpr auto contains(const Vector<T, 3>& point) const
+        -> bool {
+        const auto offset = point - this->sphere_center;
+        return !this->is_empty() &&
+               offset.dot(offset) <= this->sphere_radius * this->sphere_radius;
+    }
+
+    /**
+     * \brief Returns whether the other sphere lies entirely inside of this
+     * one.
+     * \param other The sphere to test.
+     * \return Whether every point of `other` is inside of this sphere, always
+     * true if `other` is empty.
+     */
+    [[nodiscard]] auto contains(const Sphere& other) const -> bool {
+        if (other.is_empty()) {
+            return true;
+        }
+
+        const auto reach = this->sphere_radius - other.sphere_radius;
+        return reach >= T{0} &&
+               Sphere::squared_distance(*this, other) <= reach * reach;
+    }
+
+    /**
+     * \brief Returns whether the two spheres share at least one point.
+     * \param other The sphere to test.
+     * \return Whether the spheres overlap, always false if either is empty.
+     */
+    [[nodiscard]] constexpr auto overlaps(const Sphere& other) const -> bool {
+        const auto reach = this->sphere_radius + other.sphere_radius;
+        return !this->is_empty() && !other.is_empty() &&
+               Sphere::squared_distance(*this, other) <= reach * reach;
+    }
+
+    /**
+     * \brief Returns whether the sphere and the box share at least one point.
+     * \param box The box to test.
+     * \return Whether the sphere overlaps the box, always false if either is
+     * empty.
+     */
+    [[nodiscard]] constexpr auto overlaps(const AABB<T>& box) const -> bool {
+        if (this->is_empty() || box.is_empty()) {
+            return false;
+        }
+
+        // The squared distance from the center to the closest point of the
+        // box, which is the center clamped to the box.
+        auto squared_distance = T{0};
+        for (size_t i = 0; i < 3; ++i) {
+            const auto coordinate = this->sphere_center[i];
+            const auto closest =
+                std::clamp(coordinate, box.min()[i], box.max()[i]);
+            squared_distance += (coordinate - closest) * (coordinate - closest);
+        }
+
+        return squared_distance <= this->sphere_radius * this->sphere_radius;
+    }
+
+    /**
+     * \brief Returns the smallest sphere containing both spheres.
+     * \param other The sphere to merge with.
+     * \return The union of the spheres.
+     */
+    [[nodiscard]] auto merged(const Sphere& other) const -> Sphere {
+        if (this->contains(other)) {
+            return *this;
+        }
+        if (other.contains(*this)) {
+            return other;
+        }
+
+        // Neither contains the other, so the centers are apart and the new
+        // sphere spans from the far side of one to the far side of the other.
+        const auto offset = other.sphere_center - this->sphere_center;
+        const auto distance = offset.length();
+        const auto radius =
+            (distance + this->sphere_radius + other.sphere_radius) * T{0.5};
+
+        return Sphere{
+            this->sphere_center +
+                offset * ((radius - this->sphere_radius) / distance),
+            radius,
+        };
+    }
+
+    /**
+     * \brief Returns the smallest sphere containing this sphere and the
+     * point.
+     * \param point The point to merge with.
+     * \return The sphere grown to include the point.
+     */
+    [[nodiscard]] auto merged(const Vector<T, 3>& point) const -> Sphere {
+        return this->merged(Sphere{point, T{0}});
+    }
+
+    /**
+     * \brief Returns a sphere containing this sphere transformed by an affine
+     * matrix.
+     *
+     * The center is transformed as a point and the radius is scaled by an
+     * upper bound of the largest stretch of the upper 3x3 block `A`, its
+     * spectral norm. The squared norm is the largest eigenvalue of both
+     * `transpose(A) * A` and `A * transpose(A)`, and is bounded by the
+     * largest absolute row sum of either product. One of the two products is
+     * diagonal whenever `A` is a rotation and a scale in either order, as in
+     * `Transform::trs` or its inverse, so the bound is exact for those and
+     * conservative for any other matrix, such as the products of a transform
+     * hierarchy.
+     *
+     * \param matrix The affine transformation matrix, in the row vector
+     * convention of `Transform`.
+     * \return The transformed bounding sphere, empty if this sphere is empty.
+     */
+    [[nodiscard]] auto transformed(const Matrix<T, 4, 4>& matrix) const
+        -> Sphere {
+        if (this->is_empty()) {
+            return Sphere{};
+        }
+
+        auto center = Vector<T, 3>{};
+
+        // NOLINTBEGIN(cppcoreguidelines-pro-bounds-constant-array-index)
+        for (size_t j = 0; j < 3; ++j) {
+            center[j] = this->sphere_center.x() * matrix[0][j] +
+                        this->sphere_center.y() * matrix[1][j] +
+                        this->sphere_center.z() * matrix[2][j] + matrix[3][j];
+        }
+
+        // Entry (i, j) of A * transpose(A) is the dot product of rows i and
+        // j, and of transpose(A) * A the dot product of columns i and j.
+        const auto rows = [&](size_t i, size_t j) {
+            return matrix[i][0] * matrix[j][0] + matrix[i][1] * matrix[j][1] +
+                   matrix[i][2] * matrix[j][2];
+        };
+        const auto columns = [&](size_t i, size_t j) {
+            return matrix[0][i] * matrix[0][j] + matrix[1][i] * matrix[1][j] +
+                   matrix[2][i] * matrix[2][j];
+        };
+        // NOLINTEND(cppcoreguidelines-pro-bounds-constant-array-index)
+
+        const auto max_row_sum = [](const auto& product) {
+            const auto xy = std::abs(product(0, 1));
+            const auto xz = std::abs(product(0, 2));
+            const auto yz = std::abs(product(1, 2));
+
+            return std::max(
+                {product(0, 0) + xy + xz,
+                 product(1, 1) + xy + yz,
+                 product(2, 2) + xz + yz}
+            );
+        };
+
+        const auto squared_scale =
+            std::min(max_row_sum(rows), max_row_sum(columns));
+
+        return Sphere{center, this->sphere_radius * std::sqrt(squared_scale)};
+    }
+
+    [[nodiscard]] constexpr auto operator==(const Sphere& other) const
+        -> bool {
+        return this->sphere_center == other.sphere_center &&
+               this->sphere_radius == other.sphere_radius;
+    }
+
+private:
+    Vector<T, 3> sphere_center;
+    T sphere_radius;
+
+    [[nodiscard]] constexpr static auto squared_distance(
+        const Sphere& lhs, const Sphere& rhs
+    ) -> T {
+        const auto offset = rhs.sphere_center - lhs.sphere_center;
+        return offset.dot(offset);
+    }
+};
+
+/**
+ * \brief Transforms every sphere by the same affine matrix.
+ * \param matrix The affine transformation matrix.
+ * \param spheres The spheres to transform.
+ * \param out The destination of the transformed spheres, may alias
+ * `spheres`.
+ * \pre spheres.size() == out.size()
+ * \throw std::invalid_argument If the sizes do not match.
+ */
+template <std::floating_point T>
+auto transform(
+    const Matrix<T, 4, 4>& matrix,
+    std::type_identity_t<std::span<const Sphere<T>>> spheres,
+    std::type_identity_t<std::span<Sphere<T>>> out
+) -> void {
+    if (spheres.size() != out.size()) {
+        throw std::invalid_argument("Input and output sizes do not match");
+    }
+
+    for (size_t i = 0; i < spheres.size(); ++i) {
+        out[i] = spheres[i].transformed(matrix);
+    }
+}
+
+/**
+ * \brief Returns a sphere containing every sphere, merged one at a time.
+ * \param spheres The spheres to merge.
+ * \return The union of the spheres, empty if there are none.
+ */
+template <std::floating_point T>
+[[nodiscard]] auto merge(
+    std::span<const Sphere<T>> spheres
+) -> Sphere<T> {
+    auto result = Sphere<T>{};
+    for (const auto& sphere : spheres) {
+        result = result.merged(sphere);
+    }
+    return result;
+}
+
+/**
+ * \brief Returns the merge of every sphere of a vector.
+ * \see merge(std::span<const Sphere<T>>)
+ */
+template <std::floating_point T, typename Allocator>
+[[nodiscard]] auto merge(const std::vector<Sphere<T>, Allocator>& spheres)
+    -> Sphere<T> {
+    return merge(std::span<const Sphere<T>>{spheres});
+}
+
+/**
+ * \brief Tests which points lie inside of the sphere and writes one bit per
+ * point, laid out as described in `BitMask`.
+ * \param sphere The sphere to test against.
+ * \param points The points to test.
+ * \param inside The destination of the bits.
+ * \pre inside.size() == BitMask::word_count(points.size())
+ * \throw std::invalid_argument If the sizes do not match.
+ */
+template <std::floating_point T>
+auto contains(
+    const Sphere<T>& sphere,
+    std::type_identity_t<std::span<const Vector<T, 3>>> points,
+    std::span<uint64_t> inside
+) -> void {
+    Detail::check_mask_size(points.size(), inside.size());
+
+    BitMask::assign(inside, points.size(), [&](size_t i) {
+        return sphere.contains(points[i]);
+    });
+}
+
+/**
+ * \brief Tests which spheres overlap the sphere and writes one bit per
+ * sphere, laid out as described in `BitMask`.
+ * \param sphere The sphere to test against.
+ * \param spheres The spheres to test.
+ * \param overlapping The destination of the bits.
+ * \pre overlapping.size() == BitMask::word_count(spheres.size())
+ * \throw std::invalid_argument If the sizes do not match.
+ */
+template <std::floating_point T>
+auto overlaps(
+    const Sphere<T>& sphere,
+    std::type_identity_t<std::span<const Sphere<T>>> spheres,
+    std::span<uint64_t> overlapping
+) -> void {
+    Detail::check_mask_size(spheres.size(), overlapping.size());
+
+    BitMask::assign(overlapping, spheres.size(), [&](size_t i) {
+        return sphere.overlaps(spheres[i]);
+    });
+}
+
+}  // namespace Luminol::Maths
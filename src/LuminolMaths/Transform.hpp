@@ -3,6 +3,7 @@
 #include <cmath>
 
 #include <LuminolMaths/Matrix.hpp>
+#include <LuminolMaths/Precision.hpp>
 #include <LuminolMaths/Vector.hpp>
 
 #include <LuminolMaths/Units/Angle.hpp>
@@ -105,17 +106,34 @@ constexpr auto translate(const Vector<T, VectorSize>& translation)
     auto translation_matrix = Matrix<T, M, M>::identity();
 
     for (size_t i = 0; i < VectorSize; ++i) {
-        translation_matrix[M - 1].at(i) = translation[i];
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+        translation_matrix[M - 1][i] = translation[i];
     }
 
     return translation_matrix;
 }
 
-template <typename T>
+namespace Detail {
+
+/**
+ * \brief Returns the sine and cosine of an angle in radians, from the standard
+ * library or from `FastMath::sin_cos` depending on the precision.
+ */
+template <Precision P, std::floating_point T>
+auto sin_cos(T angle) -> FastMath::SinCos<T> {
+    if constexpr (P == Precision::Fast) {
+        return FastMath::sin_cos(angle);
+    } else {
+        return {std::sin(angle), std::cos(angle)};
+    }
+}
+
+}  // namespace Detail
+
+template <typename T, Precision P = Precision::Exact>
 auto rotate_2x2(const Luminol::Units::Angle<T, Luminol::Units::Radian>& angle)
     -> Matrix<T, 2, 2> {
-    const auto sin_angle = std::sin(angle.get_value());
-    const auto cos_angle = std::cos(angle.get_value());
+    const auto [sin_angle, cos_angle] = Detail::sin_cos<P>(angle.get_value());
 
     auto rotation_matrix = Matrix<T, 2, 2>::identity();
 
@@ -127,13 +145,12 @@ auto rotate_2x2(const Luminol::Units::Angle<T, Luminol::Units::Radian>& angle)
     return rotation_matrix;
 }
 
-template <typename T, size_t M>
+template <typename T, size_t M, Precision P = Precision::Exact>
 auto rotate_x(const Luminol::Units::Angle<T, Luminol::Units::Radian>& angle)
     -> Matrix<T, M, M>
     requires(M == 3 || M == 4)
 {
-    const auto sin_angle = std::sin(angle.get_value());
-    const auto cos_angle = std::cos(angle.get_value());
+    const auto [sin_angle, cos_angle] = Detail::sin_cos<P>(angle.get_value());
 
     auto rotation_matrix = Matrix<T, M, M>::identity();
 
@@ -145,13 +162,12 @@ auto rotate_x(const Luminol::Units::Angle<T, Luminol::Units::Radian>& angle)
     return rotation_matrix;
 }
 
-template <typename T, size_t M>
+template <typename T, size_t M, Precision P = Precision::Exact>
 auto rotate_y(const Luminol::Units::Angle<T, Luminol::Units::Radian>& angle)
     -> Matrix<T, M, M>
     requires(M == 3 || M == 4)
 {
-    const auto sin_angle = std::sin(angle.get_value());
-    const auto cos_angle = std::cos(angle.get_value());
+    const auto [sin_angle, cos_angle] = Detail::sin_cos<P>(angle.get_value());
 
     auto rotation_matrix = Matrix<T, M, M>::identity();
 
@@ -163,13 +179,12 @@ auto rotate_y(const Luminol::Units::Angle<T, Luminol::Units::Radian>& angle)
     return rotation_matrix;
 }
 
-template <typename T, size_t M>
+template <typename T, size_t M, Precision P = Precision::Exact>
 auto rotate_z(const Luminol::Units::Angle<T, Luminol::Units::Radian>& angle)
     -> Matrix<T, M, M>
     requires(M == 3 || M == 4)
 {
-    const auto sin_angle = std::sin(angle.get_value());
-    const auto cos_angle = std::cos(angle.get_value());
+    const auto [sin_angle, cos_angle] = Detail::sin_cos<P>(angle.get_value());
 
     auto rotation_matrix = Matrix<T, M, M>::identity();
 
@@ -188,7 +203,8 @@ constexpr auto scale(const Vector<T, VectorSize>& scale) -> Matrix<T, M, M>
     auto scale_matrix = Matrix<T, M, M>::identity();
 
     for (size_t i = 0; i < VectorSize; ++i) {
-        scale_matrix[i].at(i) = scale[i];
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+        scale_matrix[i][i] = scale[i];
     }
 
     return scale_matrix;
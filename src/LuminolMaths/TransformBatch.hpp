@@ -0,0 +1,616 @@
+#pragma once
+
+#include <array>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include <LuminolMaths/Execution.hpp>
+#include <LuminolMaths/Matrix.hpp>
+#include <LuminolMaths/Simd.hpp>
+#include <LuminolMaths/Vector.hpp>
+#include <LuminolMaths/VectorBatch.hpp>
+
+/**
+ * Bulk application of 4x4 transformation matrices to arrays of vectors.
+ *
+ * The matrices follow the row vector convention of `Transform`, where the
+ * translation lives in the last row and a vector `v` is transformed as
+ * `v * matrix`. Points are treated as `[x, y, z, 1]` and directions as
+ * `[x, y, z, 0]`, the resulting w is discarded so these assume an affine
+ * matrix. Use `transform_vectors` with `Vector<T, 4>` for projective matrices.
+ *
+ * When the library is built with `LUMINOL_MATHS_ENABLE_SIMD`, float inputs go
+ * through the SSE/AVX kernels, otherwise the matrix is hoisted into locals and
+ * every vector is transformed without bounds checked accesses.
+ */
+namespace Luminol::Maths::Transform {
+
+namespace Detail {
+
+template <typename T>
+using Columns = std::array<std::array<T, 4>, 3>;
+
+/**
+ * \brief Returns the first three columns of the matrix, with the translation
+ * row scaled by `w`.
+ */
+template <typename T>
+[[nodiscard]] constexpr auto affine_columns(const Matrix<T, 4, 4>& matrix, T w)
+    -> Columns<T> {
+    auto columns = Columns<T>{};
+    for (size_t j = 0; j < 3; ++j) {
+        columns[j] = {
+            matrix[0][j], matrix[1][j], matrix[2][j], w * matrix[3][j]
+        };
+    }
+    return columns;
+}
+
+template <typename T>
+constexpr auto transform_affine(
+    const Matrix<T, 4, 4>& matrix,
+    std::span<const Vector<T, 3>> in,
+    std::span<Vector<T, 3>> out,
+    T w
+) -> void {
+    if (in.size() != out.size()) {
+        throw std::invalid_argument("Input and output sizes do not match");
+    }
+
+    using Kernels = Simd::MatrixKernels<T, 4, 4>;
+
+    if constexpr (requires { Kernels::transform_vectors3; }) {
+        static_assert(sizeof(Vector<T, 3>) == sizeof(T) * 3);
+
+        if (!std::is_constant_evaluated()) {
+            const auto matrix_copy = matrix;
+            Kernels::transform_vectors3(
+                &matrix_copy[0][0],
+                reinterpret_cast<const T*>(in.data()),
+                reinterpret_cast<T*>(out.data()),
+                in.size(),
+                w
+            );
+            return;
+        }
+    }
+
+    const auto columns = affine_columns(matrix, w);
+
+    for (size_t i = 0; i < in.size(); ++i) {
+        const auto x = in[i].x();
+        const auto y = in[i].y();
+        const auto z = in[i].z();
+
+        // NOLINTBEGIN(readability-identifier-length)
+        auto& result = out[i];
+        result.x() = x * columns[0][0] + y * columns[0][1] +
+                     z * columns[0][2] + columns[0][3];
+        result.y() = x * columns[1][0] + y * columns[1][1] +
+                     z * columns[1][2] + columns[1][3];
+        result.z() = x * columns[2][0] + y * columns[2][1] +
+                     z * columns[2][2] + columns[2][3];
+        // NOLINTEND(readability-identifier-length)
+    }
+}
+
+/**
+ * \brief Transforms `count` vectors stored as separate x, y and z lanes.
+ */
+template <typename T>
+auto transform_lanes(
+    const Matrix<T, 4, 4>& matrix,
+    const std::array<const T*, 3>& in,
+    const std::array<T*, 3>& out,
+    size_t count,
+    T w
+) -> void {
+    using Kernels = Simd::LaneKernels<T>;
+
+    if constexpr (requires { Kernels::transform3; }) {
+        const auto matrix_copy = matrix;
+        Kernels::transform3(&matrix_copy[0][0], in, out, count, w);
+    } else {
+        const auto columns = affine_columns(matrix, w);
+
+        // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        for (size_t i = 0; i < count; ++i) {
+            const auto x = in[0][i];
+            const auto y = in[1][i];
+            const auto z = in[2][i];
+
+            for (size_t j = 0; j < 3; ++j) {
+                out[j][i] = x * columns[j][0] + y * columns[j][1] +
+                            z * columns[j][2] + columns[j][3];
+            }
+        }
+        // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    }
+}
+
+template <Execution::Policy P, typename T>
+auto transform_affine(
+    P&& policy,
+    const Matrix<T, 4, 4>& matrix,
+    std::span<const Vector<T, 3>> in,
+    std::span<Vector<T, 3>> out,
+    T w
+) -> void {
+    if (in.size() != out.size()) {
+        throw std::invalid_argument("Input and output sizes do not match");
+    }
+
+    Execution::for_each_chunk(
+        std::forward<P>(policy),
+        in.size(),
+        sizeof(Vector<T, 3>) * 2,
+        [&](size_t begin, size_t end) {
+            transform_affine(
+                matrix,
+                in.subspan(begin, end - begin),
+                out.subspan(begin, end - begin),
+                w
+            );
+        }
+    );
+}
+
+template <Execution::Policy P, typename T, typename Allocator>
+auto transform_affine(
+    P&& policy,
+    const Matrix<T, 4, 4>& matrix,
+    const VectorBatch<T, 3, Allocator>& in,
+    VectorBatch<T, 3, Allocator>& out,
+    T w
+) -> void {
+    if (&in != &out) {
+        out.resize(in.size());
+    }
+
+    const auto in_lanes =
+        std::array{in.x().data(), in.y().data(), in.z().data()};
+    const auto out_lanes =
+        std::array{out.x().data(), out.y().data(), out.z().data()};
+
+    // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    Execution::for_each_chunk(
+        std::forward<P>(policy),
+        in.size(),
+        sizeof(T) * 6,
+        [&](size_t begin, size_t end) {
+            transform_lanes(
+                matrix,
+                {in_lanes[0] + begin, in_lanes[1] + begin, in_lanes[2] + begin},
+                {out_lanes[0] + begin,
+                 out_lanes[1] + begin,
+                 out_lanes[2] + begin},
+                end - begin,
+                w
+            );
+        }
+    );
+    // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+}
+
+template <typename T, typename Allocator>
+auto transform_affine(
+    const Matrix<T, 4, 4>& matrix,
+    const VectorBatch<T, 3, Allocator>& in,
+    VectorBatch<T, 3, Allocator>& out,
+    T w
+) -> void {
+    transform_affine(Execution::sequential, matrix, in, out, w);
+}
+
+}  // namespace Detail
+
+/**
+ * \brief Transforms every point by the matrix, including its translation.
+ * \param matrix The affine transformation matrix.
+ * \param points The points to transform.
+ * \param out The destination of the transformed points, may alias `points`.
+ * \pre points.size() == out.size()
+ * \throw std::invalid_argument If the sizes do not match.
+ */
+template <typename T>
+constexpr auto transform_points(
+    const Matrix<T, 4, 4>& matrix,
+    std::type_identity_t<std::span<const Vector<T, 3>>> points,
+    std::type_identity_t<std::span<Vector<T, 3>>> out
+) -> void {
+    Detail::transform_affine(matrix, points, out, T{1});
+}
+
+/**
+ * \brief Transforms every point in place by the matrix, including its
+ * translation.
+ * \param matrix The affine transformation matrix.
+ * \param points The points to transform.
+ */
+template <typename T>
+constexpr auto transform_points(
+    const Matrix<T, 4, 4>& matrix,
+    std::type_identity_t<std::span<Vector<T, 3>>> points
+) -> void {
+    Detail::transform_affine<T>(matrix, points, points, T{1});
+}
+
+/**
+ * \brief Transforms every direction by the matrix, ignoring its translation.
+ * \param matrix The affine transformation matrix.
+ * \param directions The directions to transform.
+ * \param out The destination of the transformed directions, may alias
+ * `directions`.
+ * \pre directions.size() == out.size()
+ * \throw std::invalid_argument If the sizes do not match.
+ */
+template <typename T>
+constexpr auto transform_directions(
+    const Matrix<T, 4, 4>& matrix,
+    std::type_identity_t<std::span<const Vector<T, 3>>> directions,
+    std::type_identity_t<std::span<Vector<T, 3>>> out
+) -> void {
+    Detail::transform_affine(matrix, directions, out, T{0});
+}
+
+/**
+ * \brief Transforms every direction in place by the matrix, ignoring its
+ * translation.
+ * \param matrix The affine transformation matrix.
+ * \param directions The directions to transform.
+ */
+template <typename T>
+constexpr auto transform_directions(
+    const Matrix<T, 4, 4>& matrix,
+    std::type_identity_t<std::span<Vector<T, 3>>> directions
+) -> void {
+    Detail::transform_affine<T>(matrix, directions, directions, T{0});
+}
+
+/**
+ * \brief Transforms every homogeneous vector by the matrix, without any
+ * perspective division.
+ * \param matrix The transformation matrix.
+ * \param vectors The homogeneous vectors to transform.
+ * \param out The destination of the transformed vectors, may alias
+ * `vectors`.
+ * \pre vectors.size() == out.size()
+ * \throw std::invalid_argument If the sizes do not match.
+ */
+template <typename T>
+constexpr auto transform_vectors(
+    const Matrix<T, 4, 4>& matrix,
+    std::type_identity_t<std::span<const Vector<T, 4>>> vectors,
+    std::type_identity_t<std::span<Vector<T, 4>>> out
+) -> void {
+    if (vectors.size() != out.size()) {
+        throw std::invalid_argument("Input and output sizes do not match");
+    }
+
+    using Kernels = Simd::MatrixKernels<T, 4, 4>;
+
+    if constexpr (requires { Kernels::transform_vectors4; }) {
+        static_assert(sizeof(Vector<T, 4>) == sizeof(T) * 4);
+
+        if (!std::is_constant_evaluated()) {
+            const auto matrix_copy = matrix;
+            Kernels::transform_vectors4(
+                &matrix_copy[0][0],
+                reinterpret_cast<const T*>(vectors.data()),
+                reinterpret_cast<T*>(out.data()),
+                vectors.size()
+            );
+            return;
+        }
+    }
+
+    const auto rows = std::array{matrix[0], matrix[1], matrix[2], matrix[3]};
+
+    for (size_t i = 0; i < vectors.size(); ++i) {
+        const auto components = std::array{
+            vectors[i].x(), vectors[i].y(), vectors[i].z(), vectors[i].w()
+        };
+
+        auto result = std::array<T, 4>{};
+        for (size_t k = 0; k < 4; ++k) {
+            for (size_t j = 0; j < 4; ++j) {
+                result[j] += components[k] * rows[k][j];
+            }
+        }
+
+        out[i] = Vector<T, 4>{result[0], result[1], result[2], result[3]};
+    }
+}
+
+/**
+ * \brief Transforms every homogeneous vector in place by the matrix, without
+ * any perspective division.
+ * \param matrix The transformation matrix.
+ * \param vectors The homogeneous vectors to transform.
+ */
+template <typename T>
+constexpr auto transform_vectors(
+    const Matrix<T, 4, 4>& matrix,
+    std::type_identity_t<std::span<Vector<T, 4>>> vectors
+) -> void {
+    transform_vectors<T>(matrix, vectors, vectors);
+}
+
+/**
+ * \brief Transforms every point by the matrix, including its translation,
+ * splitting the points into chunks run under the given policy.
+ * \param policy The execution policy, see `Execution`.
+ * \param matrix The affine transformation matrix.
+ * \param points The points to transform.
+ * \param out The destination of the transformed points, may alias `points`.
+ * \pre points.size() == out.size()
+ * \throw std::invalid_argument If the sizes do not match.
+ */
+template <typename T, Execution::Policy P>
+auto transform_points(
+    P&& policy,
+    const Matrix<T, 4, 4>& matrix,
+    std::type_identity_t<std::span<const Vector<T, 3>>> points,
+    std::type_identity_t<std::span<Vector<T, 3>>> out
+) -> void {
+    Detail::transform_affine(
+        std::forward<P>(policy), matrix, points, out, T{1}
+    );
+}
+
+/**
+ * \brief Transforms every point in place by the matrix, including its
+ * translation, splitting the points into chunks run under the given policy.
+ * \param policy The execution policy, see `Execution`.
+ * \param matrix The affine transformation matrix.
+ * \param points The points to transform.
+ */
+template <typename T, Execution::Policy P>
+auto transform_points(
+    P&& policy,
+    const Matrix<T, 4, 4>& matrix,
+    std::type_identity_t<std::span<Vector<T, 3>>> points
+) -> void {
+    Detail::transform_affine<P, T>(
+        std::forward<P>(policy), matrix, points, points, T{1}
+    );
+}
+
+/**
+ * \brief Transforms every direction by the matrix, ignoring its translation,
+ * splitting the directions into chunks run under the given policy.
+ * \param policy The execution policy, see `Execution`.
+ * \param matrix The affine transformation matrix.
+ * \param directions The directions to transform.
+ * \param out The destination of the transformed directions, may alias
+ * `directions`.
+ * \pre directions.size() == out.size()
+ * \throw std::invalid_argument If the sizes do not match.
+ */
+template <typename T, Execution::Policy P>
+auto transform_directions(
+    P&& policy,
+    const Matrix<T, 4, 4>& matrix,
+    std::type_identity_t<std::span<const Vector<T, 3>>> directions,
+    std::type_identity_t<std::span<Vector<T, 3>>> out
+) -> void {
+    Detail::transform_affine(
+        std::forward<P>(policy), matrix, directions, out, T{0}
+    );
+}
+
+/**
+ * \brief Transforms every direction in place by the matrix, ignoring its
+ * translation, splitting the directions into chunks run under the given
+ * policy.
+ * \param policy The execution policy, see `Execution`.
+ * \param matrix The affine transformation matrix.
+ * \param directions The directions to transform.
+ */
+template <typename T, Execution::Policy P>
+auto transform_directions(
+    P&& policy,
+    const Matrix<T, 4, 4>& matrix,
+    std::type_identity_t<std::span<Vector<T, 3>>> directions
+) -> void {
+    Detail::transform_affine<P, T>(
+        std::forward<P>(policy), matrix, directions, directions, T{0}
+    );
+}
+
+/**
+ * \brief Transforms every homogeneous vector by the matrix, without any
+ * perspective division, splitting the vectors into chunks run under the given
+ * policy.
+ * \param policy The execution policy, see `Execution`.
+ * \param matrix The transformation matrix.
+ * \param vectors The homogeneous vectors to transform.
+ * \param out The destination of the transformed vectors, may alias
+ * `vectors`.
+ * \pre vectors.size() == out.size()
+ * \throw std::invalid_argument If the sizes do not match.
+ */
+template <typename T, Execution::Policy P>
+auto transform_vectors(
+    P&& policy,
+    const Matrix<T, 4, 4>& matrix,
+    std::type_identity_t<std::span<const Vector<T, 4>>> vectors,
+    std::type_identity_t<std::span<Vector<T, 4>>> out
+) -> void {
+    if (vectors.size() != out.size()) {
+        throw std::invalid_argument("Input and output sizes do not match");
+    }
+
+    Execution::for_each_chunk(
+        std::forward<P>(policy),
+        vectors.size(),
+        sizeof(Vector<T, 4>) * 2,
+        [&](size_t begin, size_t end) {
+            transform_vectors<T>(
+                matrix,
+                vectors.subspan(begin, end - begin),
+                out.subspan(begin, end - begin)
+            );
+        }
+    );
+}
+
+/**
+ * \brief Transforms every homogeneous vector in place by the matrix, without
+ * any perspective division, splitting the vectors into chunks run under the
+ * given policy.
+ * \param policy The execution policy, see `Execution`.
+ * \param matrix The transformation matrix.
+ * \param vectors The homogeneous vectors to transform.
+ */
+template <typename T, Execution::Policy P>
+auto transform_vectors(
+    P&& policy,
+    const Matrix<T, 4, 4>& matrix,
+    std::type_identity_t<std::span<Vector<T, 4>>> vectors
+) -> void {
+    transform_vectors<T>(std::forward<P>(policy), matrix, vectors, vectors);
+}
+
+/**
+ * \brief Transforms every point of a batch by the matrix, including its
+ * translation.
+ * \param matrix The affine transformation matrix.
+ * \param points The points to transform.
+ * \param out The destination of the transformed points, resized to match
+ * `points`. May be the same batch as `points`.
+ */
+template <typename T, typename Allocator>
+auto transform_points(
+    const Matrix<T, 4, 4>& matrix,
+    const VectorBatch<T, 3, Allocator>& points,
+    VectorBatch<T, 3, Allocator>& out
+) -> void {
+    Detail::transform_affine(matrix, points, out, T{1});
+}
+
+/**
+ * \brief Transforms every point of a batch in place by the matrix, including
+ * its translation.
+ * \param matrix The affine transformation matrix.
+ * \param points The points to transform.
+ */
+template <typename T, typename Allocator>
+auto transform_points(
+    const Matrix<T, 4, 4>& matrix, VectorBatch<T, 3, Allocator>& points
+) -> void {
+    Detail::transform_affine(matrix, points, points, T{1});
+}
+
+/**
+ * \brief Transforms every direction of a batch by the matrix, ignoring its
+ * translation.
+ * \param matrix The affine transformation matrix.
+ * \param directions The directions to transform.
+ * \param out The destination of the transformed directions, resized to match
+ * `directions`. May be the same batch as `directions`.
+ */
+template <typename T, typename Allocator>
+auto transform_directions(
+    const Matrix<T, 4, 4>& matrix,
+    const VectorBatch<T, 3, Allocator>& directions,
+    VectorBatch<T, 3, Allocator>& out
+) -> void {
+    Detail::transform_affine(matrix, directions, out, T{0});
+}
+
+/**
+ * \brief Transforms every direction of a batch in place by the matrix,
+ * ignoring its translation.
+ * \param matrix The affine transformation matrix.
+ * \param directions The directions to transform.
+ */
+template <typename T, typename Allocator>
+auto transform_directions(
+    const Matrix<T, 4, 4>& matrix, VectorBatch<T, 3, Allocator>& directions
+) -> void {
+    Detail::transform_affine(matrix, directions, directions, T{0});
+}
+
+/**
+ * \brief Transforms every point of a batch by the matrix, including its
+ * translation, splitting the batch into chunks run under the given policy.
+ * \param policy The execution policy, see `Execution`.
+ * \param matrix The affine transformation matrix.
+ * \param points The points to transform.
+ * \param out The destination of the transformed points, resized to match
+ * `points`. May be the same batch as `points`.
+ */
+template <Execution::Policy P, typename T, typename Allocator>
+auto transform_points(
+    P&& policy,
+    const Matrix<T, 4, 4>& matrix,
+    const VectorBatch<T, 3, Allocator>& points,
+    VectorBatch<T, 3, Allocator>& out
+) -> void {
+    Detail::transform_affine(
+        std::forward<P>(policy), matrix, points, out, T{1}
+    );
+}
+
+/**
+ * \brief Transforms every point of a batch in place by the matrix, including
+ * its translation, splitting the batch into chunks run under the given policy.
+ * \param policy The execution policy, see `Execution`.
+ * \param matrix The affine transformation matrix.
+ * \param points The points to transform.
+ */
+template <Execution::Policy P, typename T, typename Allocator>
+auto transform_points(
+    P&& policy,
+    const Matrix<T, 4, 4>& matrix,
+    VectorBatch<T, 3, Allocator>& points
+) -> void {
+    Detail::transform_affine(
+        std::forward<P>(policy), matrix, points, points, T{1}
+    );
+}
+
+/**
+ * \brief Transforms every direction of a batch by the matrix, ignoring its
+ * translation, splitting the batch into chunks run under the given policy.
+ * \param policy The execution policy, see `Execution`.
+ * \param matrix The affine transformation matrix.
+ * \param directions The directions to transform.
+ * \param out The destination of the transformed directions, resized to match
+ * `directions`. May be the same batch as `directions`.
+ */
+template <Execution::Policy P, typename T, typename Allocator>
+auto transform_directions(
+    P&& policy,
+    const Matrix<T, 4, 4>& matrix,
+    const VectorBatch<T, 3, Allocator>& directions,
+    VectorBatch<T, 3, Allocator>& out
+) -> void {
+    Detail::transform_affine(
+        std::forward<P>(policy), matrix, directions, out, T{0}
+    );
+}
+
+/**
+ * \brief Transforms every direction of a batch in place by the matrix,
+ * ignoring its translation, splitting the batch into chunks run under the
+ * given policy.
+ * \param policy The execution policy, see `Execution`.
+ * \param matrix The affine transformation matrix.
+ * \param directions The directions to transform.
+ */
+template <Execution::Policy P, typename T, typename Allocator>
+auto transform_directions(
+    P&& policy,
+    const Matrix<T, 4, 4>& matrix,
+    VectorBatch<T, 3, Allocator>& directions
+) -> void {
+    Detail::transform_affine(
+        std::forward<P>(policy), matrix, directions, directions, T{0}
+    );
+}
+
+}  // namespace Luminol::Maths::Transform
@@ -0,0 +1,304 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <concepts>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+#include <LuminolMaths/Execution.hpp>
+#include <LuminolMaths/Matrix.hpp>
+#include <LuminolMaths/Quaternion.hpp>
+#include <LuminolMaths/TransformTrs.hpp>
+#include <LuminolMaths/Vector.hpp>
+
+namespace Luminol::Maths {
+
+/**
+ * \brief A flat scene graph of local translation, rotation and scale
+ * transforms, caching the world matrix of every node.
+ *
+ * Nodes are stored in the order they are added and a parent must be added
+ * before its children, so walking the nodes in order visits every parent
+ * first. Changing a local transform marks the node dirty, and `update` only
+ * recomputes the world matrices of dirty nodes and of their descendants, as
+ * `trs(local) * world(parent)` in the row vector convention of `Transform`.
+ *
+ * The nodes are also grouped by depth for the parallel `update`, which
+ * processes the nodes of one depth at a time since their world matrices only
+ * depend on the depth above.
+ *
+ * \tparam T The type of the elements of the matrices.
+ */
+template <std::floating_point T>
+class TransformHierarchy {
+public:
+    /// The parent of the root nodes.
+    constexpr static auto no_parent = std::numeric_limits<uint32_t>::max();
+
+    /**
+     * \brief The transform of a node relative to its parent, applying the
+     * scale first, then the rotation and then the translation.
+     */
+    struct Local {
+        Vector<T, 3> translation = {};
+        Quaternion<T> rotation = Quaternion<T>::identity();
+        Vector<T, 3> scale = {T{1}, T{1}, T{1}};
+    };
+
+    /**
+     * \brief Returns the number of nodes.
+     */
+    [[nodiscard]] auto size() const -> size_t { return this->locals.size(); }
+
+    /**
+     * \brief Reserves storage for the given number of nodes.
+     * \param count The number of nodes to reserve storage for.
+     */
+    auto reserve(size_t count) -> void {
+        this->locals.reserve(count);
+        this->parents.reserve(count);
+        this->depths.reserve(count);
+        this->worlds.reserve(count);
+        this->dirty.reserve(count);
+        this->updated.reserve(count);
+    }
+
+    /**
+     * \brief Adds a node, dirty until the next `update`.
+     * \param local The transform of the node relative to its parent.
+     * \param parent The index of the parent, or `no_parent` for a root.
+     * \throw std::out_of_range If the parent does not exist.
+     * \throw std::length_error If the hierarchy already has the maximum
+     * number of nodes.
+     * \return The index of the node.
+     */
+    auto add(const Local& local, uint32_t parent = no_parent) -> uint32_t {
+        if (parent != no_parent) {
+            this->check_index(parent);
+        }
+        if (this->size() >= no_parent) {
+            throw std::length_error("Too many nodes");
+        }
+
+        const auto index = static_cast<uint32_t>(this->size());
+        const auto depth =
+            parent == no_parent ? size_t{0} : this->depths[parent] + 1;
+
+        if (depth == this->levels.size()) {
+            this->levels.emplace_back();
+        }
+        this->levels[depth].push_back(index);
+
+        this->locals.push_back(local);
+        this->parents.push_back(parent);
+        this->depths.push_back(depth);
+        this->worlds.push_back(Matrix<T, 4, 4>::identity());
+        this->dirty.push_back(1);
+        this->updated.push_back(0);
+
+        return index;
+    }
+
+    /**
+     * \brief Returns the parent of a node.
+     * \param index The index of the node.
+     * \throw std::out_of_range If the node does not exist.
+     * \return The index of the parent, or `no_parent` for a root.
+     */
+    [[nodiscard]] auto parent(uint32_t index) const -> uint32_t {
+        this->check_index(index);
+        return this->parents[index];
+    }
+
+    /**
+     * \brief Returns the transform of a node relative to its parent.
+     * \param index The index of the node.
+     * \throw std::out_of_range If the node does not exist.
+     */
+    [[nodiscard]] auto local(uint32_t index) const -> const Local& {
+        this->check_index(index);
+        return this->locals[index];
+    }
+
+    /**
+     * \brief Replaces the transform of a node relative to its parent and
+     * marks it dirty.
+     * \param index The index of the node.
+     * \param local The new transform.
+     * \throw std::out_of_range If the node does not exist.
+     */
+    auto set_local(uint32_t index, const Local& local) -> void {
+        this->check_index(index);
+        this->locals[index] = local;
+        this->dirty[index] = 1;
+    }
+
+    /**
+     * \brief Replaces the translation of a node and marks it dirty.
+     * \param index The index of the node.
+     * \param translation The new translation.
+     * \throw std::out_of_range If the node does not exist.
+     */
+    auto set_translation(uint32_t index, const Vector<T, 3>& translation)
+        -> void {
+        this->check_index(index);
+        this->locals[index].translation = translation;
+        this->dirty[index] = 1;
+    }
+
+    /**
+     * \brief Replaces the rotation of a node and marks it dirty.
+     * \param index The index of the node.
+     * \param rotation The new rotation.
+     * \pre The rotation is normalized.
+     * \throw std::out_of_range If the node does not exist.
+     */
+    auto set_rotation(uint32_t index, const Quaternion<T>& rotation) -> void {
+        this->check_index(index);
+        this->locals[index].rotation = rotation;
+        this->dirty[index] = 1;
+    }
+
+    /**
+     * \brief Replaces the scale of a node and marks it dirty.
+     * \param index The index of the node.
+     * \param scale The new scale along each axis.
+     * \throw std::out_of_range If the node does not exist.
+     */
+    auto set_scale(uint32_t index, const Vector<T, 3>& scale) -> void {
+        this->check_index(index);
+        this->locals[index].scale = scale;
+        this->dirty[index] = 1;
+    }
+
+    /**
+     * \brief Marks every node dirty, so the next `update` recomputes the
+     * whole hierarchy.
+     */
+    auto invalidate() -> void {
+        std::ranges::fill(this->dirty, uint8_t{1});
+    }
+
+    /**
+     * \brief Returns the world matrix of a node as of the last `update`.
+     * \param index The index of the node.
+     * \throw std::out_of_range If the node does not exist.
+     */
+    [[nodiscard]] auto world(uint32_t index) const -> const Matrix<T, 4, 4>& {
+        this->check_index(index);
+        return this->worlds[index];
+    }
+
+    /**
+     * \brief Returns the world matrices of every node as of the last
+     * `update`, indexed like the nodes.
+     */
+    [[nodiscard]] auto world_matrices() const
+        -> std::span<const Matrix<T, 4, 4>> {
+        return this->worlds;
+    }
+
+    /**
+     * \brief Recomputes the world matrices of the dirty nodes and of their
+     * descendants, and clears the dirty flags.
+     * \return The number of world matrices recomputed.
+     */
+    auto update() -> size_t {
+        ++this->generation;
+
+        auto count = size_t{0};
+        for (size_t i = 0; i < this->size(); ++i) {
+            count += this->update_node(i) ? 1 : 0;
+        }
+        return count;
+    }
+
+    /**
+     * \brief Recomputes the world matrices of the dirty nodes and of their
+     * descendants, splitting the nodes of each depth into chunks run under the
+     * given policy, and clears the dirty flags.
+     * \param policy The execution policy, see `Execution`.
+     * \return The number of world matrices recomputed.
+     */
+    template <Execution::Policy P>
+    auto update(P&& policy) -> size_t {
+        ++this->generation;
+
+        auto count = std::atomic<size_t>{0};
+        for (const auto& level : this->levels) {
+            Execution::for_each_chunk(
+                policy,
+                level.size(),
+                node_bytes,
+                [&](size_t begin, size_t end) {
+                    auto chunk_count = size_t{0};
+                    for (size_t i = begin; i < end; ++i) {
+                        chunk_count += this->update_node(level[i]) ? 1 : 0;
+                    }
+                    count.fetch_add(chunk_count, std::memory_order_relaxed);
+                }
+            );
+        }
+        return count.load(std::memory_order_relaxed);
+    }
+
+private:
+    /// The bytes read and written to update a node, for the chunk sizes.
+    constexpr static auto node_bytes =
+        sizeof(Local) + sizeof(Matrix<T, 4, 4>) * 2;
+
+    /**
+     * \brief Recomputes the world matrix of a node if it is dirty or its parent
+     * was recomputed by the current update.
+     * \return Whether the world matrix was recomputed.
+     */
+    auto update_node(size_t index) -> bool {
+        const auto parent = this->parents[index];
+        const auto parent_updated = parent != no_parent &&
+                                    this->updated[parent] == this->generation;
+
+        if (this->dirty[index] == 0 && !parent_updated) {
+            return false;
+        }
+
+        const auto& local = this->locals[index];
+        auto world =
+            Transform::trs(local.translation, local.rotation, local.scale);
+        if (parent != no_parent) {
+            world = world * this->worlds[parent];
+        }
+
+        this->worlds[index] = world;
+        this->dirty[index] = 0;
+        this->updated[index] = this->generation;
+        return true;
+    }
+
+    auto check_index(uint32_t index) const -> void {
+        if (index >= this->size()) {
+            throw std::out_of_range("Node index out of range");
+        }
+    }
+
+    std::vector<Local> locals;
+    std::vector<uint32_t> parents;
+    std::vector<size_t> depths;
+    std::vector<Matrix<T, 4, 4>> worlds;
+
+    /// One byte per node rather than `std::vector<bool>`, so nodes updated on
+    /// different threads never share a word.
+    std::vector<uint8_t> dirty;
+
+    /// The generation of the last update that recomputed each node.
+    std::vector<uint64_t> updated;
+    uint64_t generation = 0;
+
+    /// The indices of the nodes at each depth, roots first.
+    std::vector<std::vector<uint32_t>> levels;
+};
+
+}  // namespace Luminol::Maths
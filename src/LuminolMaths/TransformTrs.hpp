@@ -0,0 +1,302 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+
+#include <LuminolMaths/Matrix.hpp>
+#include <LuminolMaths/Precision.hpp>
+#include <LuminolMaths/Quaternion.hpp>
+#include <LuminolMaths/Transform.hpp>
+#include <LuminolMaths/Vector.hpp>
+#include <LuminolMaths/VectorBatch.hpp>
+
+#include <LuminolMaths/Units/Angle.hpp>
+
+/**
+ * Direct composition of translation, rotation and scale into a single 4x4
+ * model matrix.
+ *
+ * In the row vector convention of `Transform`, a model matrix applies the
+ * scale first, then the rotation and then the translation, so `trs` returns
+ * `scale_4x4(s) * rotation * translate_4x4(t)`. Instead of four matrix
+ * products, every element is written once: the rows of the rotation scaled
+ * by the scale, followed by the translation row.
+ */
+namespace Luminol::Maths::Transform {
+
+/**
+ * \brief A rotation by `x` about the x axis, then by `y` about the y axis and
+ * then by `z` about the z axis, i.e.
+ * `rotate_x(x) * rotate_y(y) * rotate_z(z)`.
+ */
+template <std::floating_point T>
+struct EulerAngles {
+    Units::Angle<T, Units::Radian> x = {0.0};
+    Units::Angle<T, Units::Radian> y = {0.0};
+    Units::Angle<T, Units::Radian> z = {0.0};
+};
+
+namespace Detail {
+
+template <typename T>
+using Rotation = std::array<std::array<T, 3>, 3>;
+
+/**
+ * \brief Returns the rows of `rotate_x(x) * rotate_y(y) * rotate_z(z)` from
+ * the sines and cosines of the three angles.
+ */
+template <typename T>
+[[nodiscard]] constexpr auto euler_rotation(
+    const FastMath::SinCos<T>& x,
+    const FastMath::SinCos<T>& y,
+    const FastMath::SinCos<T>& z
+) -> Rotation<T> {
+    const auto sin_x_sin_y = x.sin * y.sin;
+    const auto cos_x_sin_y = x.cos * y.sin;
+
+    return {
+        std::array{y.cos * z.cos, y.cos * z.sin, -y.sin},
+        std::array{
+            sin_x_sin_y * z.cos - x.cos * z.sin,
+            sin_x_sin_y * z.sin + x.cos * z.cos,
+            x.sin * y.cos,
+        },
+        std::array{
+            cos_x_sin_y * z.cos + x.sin * z.sin,
+            cos_x_sin_y * z.sin - x.sin * z.cos,
+            x.cos * y.cos,
+        },
+    };
+}
+
+/**
+ * \brief Returns the rows of the rotation matrix of a normalized quaternion
+ * given by its components.
+ */
+template <typename T>
+[[nodiscard]] constexpr auto quaternion_rotation(T x, T y, T z, T w)
+    -> Rotation<T> {
+    const auto rotation = Quaternion<T>{x, y, z, w}.to_matrix_3x3();
+
+    return {
+        std::array{rotation[0][0], rotation[0][1], rotation[0][2]},
+        std::array{rotation[1][0], rotation[1][1], rotation[1][2]},
+        std::array{rotation[2][0], rotation[2][1], rotation[2][2]},
+    };
+}
+
+/**
+ * \brief Returns `scale_4x4(scale) * rotation * translate_4x4(translation)`.
+ */
+template <typename T>
+[[nodiscard]] constexpr auto compose_trs(
+    const std::array<T, 3>& translation,
+    const Rotation<T>& rotation,
+    const std::array<T, 3>& scale
+) -> Matrix<T, 4, 4> {
+    return Matrix<T, 4, 4>{std::array{
+        std::array{
+            scale[0] * rotation[0][0],
+            scale[0] * rotation[0][1],
+            scale[0] * rotation[0][2],
+            T{0},
+        },
+        std::array{
+            scale[1] * rotation[1][0],
+            scale[1] * rotation[1][1],
+            scale[1] * rotation[1][2],
+            T{0},
+        },
+        std::array{
+            scale[2] * rotation[2][0],
+            scale[2] * rotation[2][1],
+            scale[2] * rotation[2][2],
+            T{0},
+        },
+        std::array{translation[0], translation[1], translation[2], T{1}},
+    }};
+}
+
+template <typename T, size_t N, typename Allocator>
+auto check_batch_size(const VectorBatch<T, N, Allocator>& batch, size_t size)
+    -> void {
+    if (batch.size() != size) {
+        throw std::invalid_argument("Batch sizes do not match");
+    }
+}
+
+}  // namespace Detail
+
+/**
+ * \brief Returns the model matrix that scales, rotates by Euler angles and
+ * then translates.
+ * \tparam P The precision of the sines and cosines of the angles.
+ * \param translation The translation.
+ * \param rotation The Euler angles of the rotation.
+ * \param scale The scale along each axis.
+ * \return `scale_4x4(scale) * rotate_x(rotation.x) * rotate_y(rotation.y) *
+ * rotate_z(rotation.z) * translate_4x4(translation)`.
+ */
+template <Precision P = Precision::Exact, std::floating_point T>
+[[nodiscard]] auto trs(
+    const Vector<T, 3>& translation,
+    const EulerAngles<T>& rotation,
+    const Vector<T, 3>& scale
+) -> Matrix<T, 4, 4> {
+    return Detail::compose_trs(
+        {translation.x(), translation.y(), translation.z()},
+        Detail::euler_rotation(
+            Detail::sin_cos<P>(rotation.x.get_value()),
+            Detail::sin_cos<P>(rotation.y.get_value()),
+            Detail::sin_cos<P>(rotation.z.get_value())
+        ),
+        {scale.x(), scale.y(), scale.z()}
+    );
+}
+
+/**
+ * \brief Returns the model matrix that scales, rotates by a quaternion and
+ * then translates.
+ * \pre The quaternion is normalized.
+ * \param translation The translation.
+ * \param rotation The rotation.
+ * \param scale The scale along each axis.
+ * \return `scale_4x4(scale) * rotation.to_matrix_4x4() *
+ * translate_4x4(translation)`.
+ */
+template <std::floating_point T>
+[[nodiscard]] constexpr auto trs(
+    const Vector<T, 3>& translation,
+    const Quaternion<T>& rotation,
+    const Vector<T, 3>& scale
+) -> Matrix<T, 4, 4> {
+    return Detail::compose_trs(
+        {translation.x(), translation.y(), translation.z()},
+        Detail::quaternion_rotation(
+            rotation.x(), rotation.y(), rotation.z(), rotation.w()
+        ),
+        {scale.x(), scale.y(), scale.z()}
+    );
+}
+
+/**
+ * \brief Composes one model matrix per element from structure-of-arrays
+ * translations, Euler angles in radians and scales.
+ *
+ * The sines and cosines are computed a block at a time into stack buffers,
+ * so that loop vectorizes with `Precision::Fast`, and the matrices are then
+ * written from the buffers without any allocation.
+ *
+ * \tparam P The precision of the sines and cosines of the angles.
+ * \param translations The translations.
+ * \param rotations The Euler angles in radians, x then y then z.
+ * \param scales The scales along each axis.
+ * \param out The model matrices.
+ * \pre The batches and `out` have the same size.
+ * \throw std::invalid_argument If the sizes do not match.
+ */
+template <
+    Precision P = Precision::Exact,
+    std::floating_point T,
+    typename Allocator>
+auto trs(
+    const VectorBatch<T, 3, Allocator>& translations,
+    const VectorBatch<T, 3, Allocator>& rotations,
+    const VectorBatch<T, 3, Allocator>& scales,
+    std::type_identity_t<std::span<Matrix<T, 4, 4>>> out
+) -> void {
+    Detail::check_batch_size(rotations, out.size());
+    Detail::check_batch_size(translations, out.size());
+    Detail::check_batch_size(scales, out.size());
+
+    constexpr auto block_size = size_t{64};
+
+    using Block = std::array<FastMath::SinCos<T>, block_size>;
+
+    const auto translation_lanes =
+        std::array{translations.x(), translations.y(), translations.z()};
+    const auto scale_lanes = std::array{scales.x(), scales.y(), scales.z()};
+
+    auto angles = std::array<Block, 3>{};
+
+    // NOLINTBEGIN(cppcoreguidelines-pro-bounds-constant-array-index)
+    for (size_t begin = 0; begin < out.size(); begin += block_size) {
+        const auto count = std::min(block_size, out.size() - begin);
+
+        for (size_t axis = 0; axis < 3; ++axis) {
+            const auto lane = rotations.lane(axis).subspan(begin, count);
+            for (size_t i = 0; i < count; ++i) {
+                angles[axis][i] = Detail::sin_cos<P>(lane[i]);
+            }
+        }
+
+        for (size_t i = 0; i < count; ++i) {
+            const auto index = begin + i;
+
+            out[index] = Detail::compose_trs(
+                {translation_lanes[0][index],
+                 translation_lanes[1][index],
+                 translation_lanes[2][index]},
+                Detail::euler_rotation(
+                    angles[0][i], angles[1][i], angles[2][i]
+                ),
+                {scale_lanes[0][index],
+                 scale_lanes[1][index],
+                 scale_lanes[2][index]}
+            );
+        }
+    }
+    // NOLINTEND(cppcoreguidelines-pro-bounds-constant-array-index)
+}
+
+/**
+ * \brief Composes one model matrix per element from structure-of-arrays
+ * translations, quaternions and scales.
+ * \pre The quaternions are normalized.
+ * \param translations The translations.
+ * \param rotations The quaternions as x, y, z and w lanes.
+ * \param scales The scales along each axis.
+ * \param out The model matrices.
+ * \pre The batches and `out` have the same size.
+ * \throw std::invalid_argument If the sizes do not match.
+ */
+template <std::floating_point T, typename Allocator>
+auto trs(
+    const VectorBatch<T, 3, Allocator>& translations,
+    const VectorBatch<T, 4, Allocator>& rotations,
+    const VectorBatch<T, 3, Allocator>& scales,
+    std::type_identity_t<std::span<Matrix<T, 4, 4>>> out
+) -> void {
+    Detail::check_batch_size(rotations, out.size());
+    Detail::check_batch_size(translations, out.size());
+    Detail::check_batch_size(scales, out.size());
+
+    const auto translation_lanes =
+        std::array{translations.x(), translations.y(), translations.z()};
+    const auto rotation_lanes =
+        std::array{rotations.x(), rotations.y(), rotations.z(), rotations.w()};
+    const auto scale_lanes = std::array{scales.x(), scales.y(), scales.z()};
+
+    // NOLINTBEGIN(cppcoreguidelines-pro-bounds-constant-array-index)
+    for (size_t i = 0; i < out.size(); ++i) {
+        out[i] = Detail::compose_trs(
+            {translation_lanes[0][i],
+             translation_lanes[1][i],
+             translation_lanes[2][i]},
+            Detail::quaternion_rotation(
+                rotation_lanes[0][i],
+                rotation_lanes[1][i],
+                rotation_lanes[2][i],
+                rotation_lanes[3][i]
+            ),
+            {scale_lanes[0][i], scale_lanes[1][i], scale_lanes[2][i]}
+        );
+    }
+    // NOLINTEND(cppcoreguidelines-pro-bounds-constant-array-index)
+}
+
+}  // namespace Luminol::Maths::Transform
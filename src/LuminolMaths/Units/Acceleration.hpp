@@ -54,30 +54,9 @@ using NanometerPerSecondSquared =
 template <std::floating_point T, typename U>
 class Acceleration : public Unit<T, U> {
 public:
-    template <typename TimeU>
-        requires(TimeU::type == UnitEnum::Time)
-    constexpr auto operator*(const Time<T, TimeU>& time) const
-        -> Velocity<T, typename U::VelocityType> {
-        return Velocity<T, typename U::VelocityType>{
-            this->get_value() * time.get_value() *
-            time.template get_ratio<typename U::VelocityType>()
-        };
-    }
+    using Unit<T, U>::Unit;
 };
 
-template <std::floating_point T, typename VelocityU, typename TimeU>
-    requires(
-        VelocityU::type == UnitEnum::Velocity && TimeU::type == UnitEnum::Time
-    )
-constexpr auto operator/(
-    const Velocity<T, VelocityU>& velocity, const Time<T, TimeU>& time
-) -> Acceleration<T, AccelerationUnitType<VelocityU, TimeU>> {
-    return Acceleration<T, AccelerationUnitType<VelocityU, TimeU>>{
-        velocity.get_value() / time.get_value() *
-        velocity.template get_ratio<TimeU>()
-    };
-}
-
 using KilometersPerHourSquared = Acceleration<double, KilometerPerHourSquared>;
 using KilometersPerHourSquared_f = Acceleration<float, KilometerPerHourSquared>;
 using MetersPerHourSquared = Acceleration<double, MeterPerHourSquared>;
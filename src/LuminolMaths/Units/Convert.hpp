@@ -0,0 +1,175 @@
+#pragma once
+
+#include <algorithm>
+#include <concepts>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+#include <LuminolMaths/Simd.hpp>
+#include <LuminolMaths/Units/Unit.hpp>
+
+/**
+ * Bulk conversion of buffers of values between units of the same dimension.
+ *
+ * `Unit::as` multiplies by the ratio of the source unit and divides by the
+ * ratio of the target unit for every value. Here both ratios are folded into
+ * a single compile-time factor, so converting a buffer is one multiply per
+ * value, run through the SIMD lane kernels when the library is built with
+ * `LUMINOL_MATHS_ENABLE_SIMD`. The folded factor is computed in extended
+ * precision, so results may differ from `as` by an ulp.
+ */
+namespace Luminol::Units {
+
+namespace Detail {
+
+template <typename U>
+constexpr auto ratio_value =
+    static_cast<long double>(U::base_ratio::num) /
+    static_cast<long double>(U::base_ratio::den);
+
+/**
+ * \brief Writes `in[i] * factor` to `out[i]` for every value.
+ */
+template <std::floating_point T>
+constexpr auto scale(std::span<const T> in, std::span<T> out, T factor)
+    -> void {
+    using Kernels = Maths::Simd::LaneKernels<T>;
+
+    if constexpr (Kernels::enabled) {
+        if (!std::is_constant_evaluated()) {
+            Kernels::scale(in.data(), factor, out.data(), in.size());
+            return;
+        }
+    }
+
+    for (size_t i = 0; i < in.size(); ++i) {
+        out[i] = in[i] * factor;
+    }
+}
+
+}  // namespace Detail
+
+/**
+ * \brief The factor converting values in `FromU` to values in `ToU`.
+ */
+template <typename FromU, typename ToU, std::floating_point T>
+    requires(FromU::dimension == ToU::dimension)
+constexpr auto conversion_factor = static_cast<T>(
+    Detail::ratio_value<FromU> / Detail::ratio_value<ToU>
+);
+
+/**
+ * \brief Converts every value from `FromU` to `ToU`.
+ * \tparam FromU The unit of the input values.
+ * \tparam ToU The unit of the output values, of the same dimension as `FromU`.
+ * \param in The values to convert.
+ * \param out The destination of the converted values, may alias `in`.
+ * \pre in.size() == out.size()
+ * \throw std::invalid_argument If the sizes do not match.
+ */
+template <typename FromU, typename ToU, std::floating_point T>
+    requires(FromU::dimension == ToU::dimension)
+constexpr auto convert(
+    std::span<const T> in, std::type_identity_t<std::span<T>> out
+) -> void {
+    if (in.size() != out.size()) {
+        throw std::invalid_argument("Input and output sizes do not match");
+    }
+
+    if constexpr (std::same_as<FromU, ToU>) {
+        if (in.data() != out.data()) {
+            std::ranges::copy(in, out.begin());
+        }
+    } else {
+        constexpr auto factor = conversion_factor<FromU, ToU, T>;
+        static_assert(factor != 0);
+
+        Detail::scale(in, out, factor);
+    }
+}
+
+/**
+ * \brief Converts every value of a vector from `FromU` to `ToU`.
+ * \see convert(std::span<const T>, std::span<T>)
+ */
+template <
+    typename FromU,
+    typename ToU,
+    std::floating_point T,
+    typename Allocator>
+    requires(FromU::dimension == ToU::dimension)
+constexpr auto convert(
+    const std::vector<T, Allocator>& in, std::type_identity_t<std::span<T>> out
+) -> void {
+    convert<FromU, ToU>(std::span<const T>{in}, out);
+}
+
+/**
+ * \brief Converts every value in place from `FromU` to `ToU`.
+ * \tparam FromU The unit of the values before the conversion.
+ * \tparam ToU The unit of the values after the conversion, of the same
+ * dimension as `FromU`.
+ * \param values The values to convert.
+ */
+template <typename FromU, typename ToU, std::floating_point T>
+    requires(FromU::dimension == ToU::dimension)
+constexpr auto convert(std::span<T> values) -> void {
+    convert<FromU, ToU>(std::span<const T>{values}, values);
+}
+
+/**
+ * \brief Converts every value of a vector in place from `FromU` to `ToU`.
+ * \see convert(std::span<T>)
+ */
+template <
+    typename FromU,
+    typename ToU,
+    std::floating_point T,
+    typename Allocator>
+    requires(FromU::dimension == ToU::dimension)
+constexpr auto convert(std::vector<T, Allocator>& values) -> void {
+    convert<FromU, ToU>(std::span<T>{values});
+}
+
+/**
+ * \brief Converts every quantity to `NewU`.
+ * \tparam NewU The unit of the output quantities, of the same dimension as
+ * the input quantities.
+ * \param in The quantities to convert.
+ * \param out The destination of the converted quantities.
+ * \pre in.size() == out.size()
+ * \throw std::invalid_argument If the sizes do not match.
+ */
+template <typename NewU, std::floating_point T, typename U>
+    requires(U::dimension == NewU::dimension)
+auto convert(
+    std::span<const Unit<T, U>> in,
+    std::type_identity_t<std::span<Unit<T, NewU>>> out
+) -> void {
+    static_assert(sizeof(Unit<T, U>) == sizeof(T));
+    static_assert(sizeof(Unit<T, NewU>) == sizeof(T));
+
+    // NOLINTBEGIN(cppcoreguidelines-pro-type-reinterpret-cast)
+    convert<U, NewU>(
+        std::span<const T>{reinterpret_cast<const T*>(in.data()), in.size()},
+        std::span<T>{reinterpret_cast<T*>(out.data()), out.size()}
+    );
+    // NOLINTEND(cppcoreguidelines-pro-type-reinterpret-cast)
+}
+
+/**
+ * \brief Converts every quantity of a vector to `NewU`.
+ * \see convert(std::span<const Unit<T, U>>, std::span<Unit<T, NewU>>)
+ */
+template <typename NewU, std::floating_point T, typename U, typename Allocator>
+    requires(U::dimension == NewU::dimension)
+auto convert(
+    const std::vector<Unit<T, U>, Allocator>& in,
+    std::type_identity_t<std::span<Unit<T, NewU>>> out
+) -> void {
+    convert<NewU>(std::span<const Unit<T, U>>{in}, out);
+}
+
+}  // namespace Luminol::Units
@@ -0,0 +1,127 @@
+#pragma once
+
+#include <concepts>
+#include <cstdint>
+#include <limits>
+#include <ratio>
+#include <type_traits>
+
+namespace Luminol::Units {
+
+/**
+ * \brief The exponents of the base dimensions of a quantity, so that the
+ * dimension of a product or a quotient of quantities is known at compile time.
+ *
+ * For example, a velocity is a length divided by a time, `{.length = 1,
+ * .time = -1}`, and a force is `{.length = 1, .mass = 1, .time = -2}`.
+ */
+struct Dimension {
+    int length = 0;
+    int mass = 0;
+    int time = 0;
+    int angle = 0;
+
+    [[nodiscard]] constexpr auto operator==(const Dimension& other) const
+        -> bool = default;
+
+    [[nodiscard]] constexpr auto operator*(const Dimension& other) const
+        -> Dimension {
+        return Dimension{
+            .length = this->length + other.length,
+            .mass = this->mass + other.mass,
+            .time = this->time + other.time,
+            .angle = this->angle + other.angle,
+        };
+    }
+
+    [[nodiscard]] constexpr auto operator/(const Dimension& other) const
+        -> Dimension {
+        return Dimension{
+            .length = this->length - other.length,
+            .mass = this->mass - other.mass,
+            .time = this->time - other.time,
+            .angle = this->angle - other.angle,
+        };
+    }
+};
+
+/// The dimension of a ratio of two quantities of the same dimension.
+constexpr auto dimensionless = Dimension{};
+
+namespace Detail {
+
+template <typename Ratio>
+concept ExactRatio =
+    std::integral<std::remove_cvref_t<decltype(Ratio::num)>> &&
+    std::integral<std::remove_cvref_t<decltype(Ratio::den)>>;
+
+/**
+ * \brief Whether `lhs * rhs` can be computed without overflowing, for
+ * `std::ratio_multiply`.
+ */
+constexpr auto fits_product(std::intmax_t lhs, std::intmax_t rhs) -> bool {
+    const auto abs_lhs = lhs < 0 ? -lhs : lhs;
+    const auto abs_rhs = rhs < 0 ? -rhs : rhs;
+    return abs_rhs == 0 ||
+           abs_lhs <= std::numeric_limits<std::intmax_t>::max() / abs_rhs;
+}
+
+/**
+ * \brief A ratio with floating point terms, for the products of ratios that
+ * are not `std::ratio` or that would overflow one.
+ */
+template <typename Lhs, typename Rhs, bool Divide>
+struct InexactRatio {
+    constexpr static auto num =
+        static_cast<double>(Lhs::num) *
+        static_cast<double>(Divide ? Rhs::den : Rhs::num);
+    constexpr static auto den =
+        static_cast<double>(Lhs::den) *
+        static_cast<double>(Divide ? Rhs::num : Rhs::den);
+};
+
+template <typename Lhs, typename Rhs>
+struct MultipliedRatio {
+    using type = InexactRatio<Lhs, Rhs, false>;
+};
+
+template <typename Lhs, typename Rhs>
+    requires(
+        ExactRatio<Lhs> && ExactRatio<Rhs> &&
+        fits_product(Lhs::num, Rhs::num) && fits_product(Lhs::den, Rhs::den)
+    )
+struct MultipliedRatio<Lhs, Rhs> {
+    using type = std::ratio_multiply<Lhs, Rhs>;
+};
+
+template <typename Lhs, typename Rhs>
+struct DividedRatio {
+    using type = InexactRatio<Lhs, Rhs, true>;
+};
+
+template <typename Lhs, typename Rhs>
+    requires(
+        ExactRatio<Lhs> && ExactRatio<Rhs> &&
+        fits_product(Lhs::num, Rhs::den) && fits_product(Lhs::den, Rhs::num)
+    )
+struct DividedRatio<Lhs, Rhs> {
+    using type = std::ratio_divide<Lhs, Rhs>;
+};
+
+}  // namespace Detail
+
+/**
+ * \brief The product of two ratios, a `std::ratio` when both are and the
+ * product fits, a ratio with floating point terms otherwise.
+ */
+template <typename Lhs, typename Rhs>
+using RatioProduct = typename Detail::MultipliedRatio<Lhs, Rhs>::type;
+
+/**
+ * \brief The quotient of two ratios, a `std::ratio` when both are and the
+ * quotient fits, a ratio with floating point terms otherwise.
+ */
+template <typename Lhs, typename Rhs>
+using RatioQuotient = typename Detail::DividedRatio<Lhs, Rhs>::type;
+
+}  // namespace Luminol::Units
@@ -33,29 +33,7 @@ public:
     constexpr Energy(
         const Mass<T, MassU>& mass, const Velocity<T, VelocityU>& velocity
     )
-        : Unit<T, U>{energy_from_mass_and_velocity(mass, velocity)} {}
-
-private:
-    template <typename MassU, typename VelocityU>
-        requires(
-            MassU::type == UnitEnum::Mass &&
-            VelocityU::type == UnitEnum::Velocity
-        )
-    constexpr static auto energy_from_mass_and_velocity(
-        const Mass<T, MassU>& mass, const Velocity<T, VelocityU>& velocity
-    ) -> T {
-        const auto mass_in_kg = mass.template as<Kilogram>().get_value();
-        const auto velocity_in_mps =
-            velocity.template as<MeterPerSecond>().get_value();
-
-        constexpr auto half = T{0.5};
-        const auto joules =
-            half * mass_in_kg * velocity_in_mps * velocity_in_mps;
-
-        constexpr auto energy_ratio = U::ratio::num / U::ratio::den;
-
-        return joules * (T{1.0} / energy_ratio);
-    }
+        : Unit<T, U>{mass * velocity * velocity * T{0.5}} {}
 };
 
 using Kilojoules = Energy<double, Kilojoule>;
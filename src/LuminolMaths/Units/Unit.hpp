@@ -1,6 +1,11 @@
 #pragma once
 
+#include <array>
 #include <concepts>
+#include <cstdint>
+#include <ratio>
+
+#include <LuminolMaths/Units/Dimension.hpp>
 
 namespace Luminol::Units {
 
@@ -18,6 +23,58 @@ enum class UnitEnum {
     Impulse,
 };
 
+/**
+ * \brief Returns the dimension of the quantities of a unit family.
+ */
+constexpr auto dimension_of(UnitEnum type) -> Dimension {
+    switch (type) {
+        case UnitEnum::Length:
+            return {.length = 1};
+        case UnitEnum::Time:
+            return {.time = 1};
+        case UnitEnum::Angle:
+            return {.angle = 1};
+        case UnitEnum::Velocity:
+            return {.length = 1, .time = -1};
+        case UnitEnum::Mass:
+            return {.mass = 1};
+        case UnitEnum::Acceleration:
+            return {.length = 1, .time = -2};
+        case UnitEnum::Energy:
+            return {.length = 2, .mass = 1, .time = -2};
+        case UnitEnum::Force:
+            return {.length = 1, .mass = 1, .time = -2};
+        case UnitEnum::Volume:
+            return {.length = 3};
+        case UnitEnum::Density:
+            return {.length = -3, .mass = 1};
+        case UnitEnum::Impulse:
+            return {.length = 1, .mass = 1, .time = -1};
+    }
+    return {};
+}
+
+/**
+ * \brief Returns the size of the unit of ratio one of a unit family in the
+ * base units, the meter, the gram, the second and the degree.
+ *
+ * The families derived from the kilogram, like the newton or the joule, are a
+ * thousand times their base units.
+ */
+constexpr auto reference_scale(UnitEnum type) -> std::intmax_t {
+    constexpr auto kilo = std::intmax_t{1000};
+
+    switch (type) {
+        case UnitEnum::Energy:
+        case UnitEnum::Force:
+        case UnitEnum::Density:
+        case UnitEnum::Impulse:
+            return kilo;
+        default:
+            return 1;
+    }
+}
+
 template <typename T, const T& Num, const T& Den>
 struct RefRatio {
     constexpr static auto num = Num;
@@ -27,9 +84,92 @@ struct RefRatio {
 template <UnitEnum Type, typename Ratio>
 struct UnitType {
     constexpr static auto type = Type;
+    constexpr static auto dimension = dimension_of(Type);
+    using ratio = Ratio;
+    using base_ratio =
+        RatioProduct<Ratio, std::ratio<reference_scale(Type)>>;
+};
+
+/**
+ * \brief A unit of any dimension, the product or the quotient of other units,
+ * without a `UnitEnum` family.
+ * \tparam D The dimension of the quantities.
+ * \tparam Ratio The size of the unit in the base units, the meter, the gram,
+ * the second and the degree.
+ */
+template <Dimension D, typename Ratio>
+struct DerivedUnitType {
+    constexpr static auto dimension = D;
     using ratio = Ratio;
+    using base_ratio = Ratio;
 };
 
+namespace Detail {
+
+constexpr auto unit_families = std::array{
+    UnitEnum::Length,
+    UnitEnum::Time,
+    UnitEnum::Angle,
+    UnitEnum::Velocity,
+    UnitEnum::Mass,
+    UnitEnum::Acceleration,
+    UnitEnum::Energy,
+    UnitEnum::Force,
+    UnitEnum::Volume,
+    UnitEnum::Density,
+    UnitEnum::Impulse,
+};
+
+constexpr auto has_family(Dimension dimension) -> bool {
+    for (const auto family : unit_families) {
+        if (dimension_of(family) == dimension) {
+            return true;
+        }
+    }
+    return false;
+}
+
+constexpr auto family_of(Dimension dimension) -> UnitEnum {
+    for (const auto family : unit_families) {
+        if (dimension_of(family) == dimension) {
+            return family;
+        }
+    }
+    return UnitEnum::Length;
+}
+
+template <Dimension D, typename BaseRatio>
+struct UnitOf {
+    using type = DerivedUnitType<D, BaseRatio>;
+};
+
+template <Dimension D, typename BaseRatio>
+    requires(has_family(D))
+struct UnitOf<D, BaseRatio> {
+    using type = UnitType<
+        family_of(D),
+        RatioQuotient<BaseRatio, std::ratio<reference_scale(family_of(D))>>>;
+};
+
+}  // namespace Detail
+
+/**
+ * \brief The unit of the given dimension and size in the base units, of the
+ * `UnitEnum` family of that dimension if there is one.
+ */
+template <Dimension D, typename BaseRatio>
+using UnitOf = typename Detail::UnitOf<D, BaseRatio>::type;
+
+template <typename LhsU, typename RhsU>
+using UnitProduct = UnitOf<
+    LhsU::dimension * RhsU::dimension,
+    RatioProduct<typename LhsU::base_ratio, typename RhsU::base_ratio>>;
+
+template <typename LhsU, typename RhsU>
+using UnitQuotient = UnitOf<
+    LhsU::dimension / RhsU::dimension,
+    RatioQuotient<typename LhsU::base_ratio, typename RhsU::base_ratio>>;
+
 template <std::floating_point T, typename U>
 class Unit {
 public:
@@ -48,10 +188,23 @@ public:
     [[nodiscard]] constexpr auto get_value() const -> T { return this->value; }
 
     template <typename NewU>
-        requires(U::type == NewU::type)
+        requires(U::dimension == NewU::dimension)
     [[nodiscard]] constexpr auto as() const -> Unit<T, NewU> {
         if constexpr (std::same_as<U, NewU>) {
             return Unit<T, NewU>{this->get_value()};
+        } else if constexpr (!same_family<NewU>) {
+            // Converts through the base units, in a single folded factor.
+            constexpr auto ratio =
+                static_cast<long double>(U::base_ratio::num) /
+                static_cast<long double>(U::base_ratio::den);
+            constexpr auto new_ratio =
+                static_cast<long double>(NewU::base_ratio::num) /
+                static_cast<long double>(NewU::base_ratio::den);
+            constexpr auto factor = static_cast<T>(ratio / new_ratio);
+
+            static_assert(factor != 0);
+
+            return Unit<T, NewU>{this->get_value() * factor};
         } else {
             constexpr auto ratio =
                 static_cast<T>(U::ratio::num) / static_cast<T>(U::ratio::den);
@@ -140,7 +293,38 @@ public:
     }
 
 private:
+    template <typename NewU>
+    constexpr static auto same_family = requires {
+        requires U::type == NewU::type;
+    };
+
     T value = {};
 };
 
+/**
+ * \brief Multiplies two quantities, in the product of their units.
+ *
+ * The scale of the product is folded into its unit at compile time, so no
+ * operand is converted.
+ */
+template <std::floating_point T, typename LhsU, typename RhsU>
+[[nodiscard]] constexpr auto operator*(
+    const Unit<T, LhsU>& lhs, const Unit<T, RhsU>& rhs
+) -> Unit<T, UnitProduct<LhsU, RhsU>> {
+    return Unit<T, UnitProduct<LhsU, RhsU>>{lhs.get_value() * rhs.get_value()};
+}
+
+/**
+ * \brief Divides two quantities, in the quotient of their units.
+ *
+ * The scale of the quotient is folded into its unit at compile time, so no
+ * operand is converted.
+ */
+template <std::floating_point T, typename LhsU, typename RhsU>
+[[nodiscard]] constexpr auto operator/(
+    const Unit<T, LhsU>& lhs, const Unit<T, RhsU>& rhs
+) -> Unit<T, UnitQuotient<LhsU, RhsU>> {
+    return Unit<T, UnitQuotient<LhsU, RhsU>>{lhs.get_value() / rhs.get_value()};
+}
+
 }  // namespace Luminol::Units
@@ -0,0 +1,515 @@
+#pragma once
+
+#include <concepts>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+#include <LuminolMaths/AlignedAllocator.hpp>
+#include <LuminolMaths/Simd.hpp>
+#include <LuminolMaths/Units/Convert.hpp>
+#include <LuminolMaths/Units/Unit.hpp>
+
+namespace Luminol::Units {
+
+template <std::floating_point T, typename U>
+class UnitArrayView;
+
+/**
+ * \brief A growable array of quantities in the unit `U`, storing the raw
+ * values contiguously.
+ *
+ * The values are exposed as a `std::span<T>` without copies, for SIMD kernels
+ * and I/O. Bulk arithmetic with arrays in other units of the same dimension
+ * converts with a single factor per array rather than per element, and
+ * multiplying or dividing arrays yields the product or quotient unit with no
+ * conversion at all.
+ *
+ * When the library is built with `LUMINOL_MATHS_ENABLE_SIMD`, the float
+ * kernels use SSE, or AVX when the compiler targets it.
+ *
+ * \tparam T The type of the values.
+ * \tparam U The unit of the values.
+ * \tparam Allocator The allocator of the values.
+ */
+template <
+    std::floating_point T,
+    typename U,
+    typename Allocator = Maths::AlignedAllocator<T>>
+class UnitArray {
+public:
+    using Quantity = Unit<T, U>;
+    using Values = std::vector<T, Allocator>;
+
+    UnitArray() = default;
+
+    /**
+     * \brief Constructs an empty array using the given allocator.
+     * \param allocator The allocator of the values.
+     */
+    explicit UnitArray(const Allocator& allocator) : storage{allocator} {}
+
+    /**
+     * \brief Constructs an array of `count` zero quantities.
+     * \param count The number of quantities in the array.
+     * \param allocator The allocator of the values.
+     */
+    explicit UnitArray(size_t count, const Allocator& allocator = Allocator{})
+        : storage(count, allocator) {}
+
+    /**
+     * \brief Constructs an array from raw values in the unit `U`.
+     * \param values The values to copy into the array.
+     * \param allocator The allocator of the values.
+     */
+    explicit UnitArray(
+        std::span<const T> values, const Allocator& allocator = Allocator{}
+    )
+        : storage(values.begin(), values.end(), allocator) {}
+
+    /**
+     * \brief Returns the number of quantities in the array.
+     */
+    [[nodiscard]] auto size() const -> size_t { return this->storage.size(); }
+
+    /**
+     * \brief Returns whether the array holds no quantities.
+     */
+    [[nodiscard]] auto empty() const -> bool { return this->storage.empty(); }
+
+    /**
+     * \brief Returns the allocator of the values.
+     * \return A copy of the allocator of the values.
+     */
+    [[nodiscard]] auto get_allocator() const -> Allocator {
+        return this->storage.get_allocator();
+    }
+
+    /**
+     * \brief Reserves storage for the given number of quantities.
+     * \param count The number of quantities to reserve storage for.
+     */
+    auto reserve(size_t count) -> void { this->storage.reserve(count); }
+
+    /**
+     * \brief Resizes the array, appending zero quantities if it grows.
+     * \param count The new number of quantities.
+     */
+    auto resize(size_t count) -> void { this->storage.resize(count); }
+
+    /**
+     * \brief Removes every quantity from the array.
+     */
+    auto clear() -> void { this->storage.clear(); }
+
+    /**
+     * \brief Appends a quantity, converted to `U`, to the end of the array.
+     * \param quantity The quantity to append.
+     */
+    auto push_back(const Quantity& quantity) -> void {
+        this->storage.push_back(quantity.get_value());
+    }
+
+    /**
+     * \brief Returns the quantity at the given index.
+     * \param index The index of the quantity.
+     * \pre index < size()
+     * \throw std::out_of_range If the index is out of range.
+     */
+    [[nodiscard]] auto get(size_t index) const -> Quantity {
+        return Quantity{this->storage.at(index)};
+    }
+
+    /**
+     * \brief Overwrites the quantity at the given index, converted to `U`.
+     * \param index The index of the quantity.
+     * \param quantity The new quantity.
+     * \pre index < size()
+     * \throw std::out_of_range If the index is out of range.
+     */
+    auto set(size_t index, const Quantity& quantity) -> void {
+        this->storage.at(index) = quantity.get_value();
+    }
+
+    /**
+     * \brief Returns the raw values in the unit `U`, without copying them.
+     */
+    [[nodiscard]] auto values() -> std::span<T> { return this->storage; }
+
+    /**
+     * \brief Returns the raw values in the unit `U`, without copying them.
+     */
+    [[nodiscard]] auto values() const -> std::span<const T> {
+        return this->storage;
+    }
+
+    /**
+     * \brief Returns a view of the quantities in the unit `NewU`, scaling each
+     * value only when it is read.
+     * \tparam NewU The unit of the view, of the same dimension as `U`.
+     * \return The view, valid until the array is resized or destroyed.
+     */
+    template <typename NewU>
+        requires(U::dimension == NewU::dimension)
+    [[nodiscard]] auto as() const -> UnitArrayView<T, NewU> {
+        return UnitArrayView<T, U>{this->storage}.template as<NewU>();
+    }
+
+    /**
+     * \brief Adds the quantities of a view to the quantities of this array,
+     * converting them with a single factor.
+     * \param other The view to add to this array.
+     * \pre other.size() == size()
+     * \throw std::invalid_argument If the sizes do not match.
+     * \return A reference to this array after the operation.
+     */
+    template <typename OtherU>
+        requires(U::dimension == OtherU::dimension)
+    auto operator+=(const UnitArrayView<T, OtherU>& other) -> UnitArray& {
+        this->scale_add(other, T{1});
+        return *this;
+    }
+
+    /**
+     * \brief Adds the quantities of another array to the quantities of this
+     * array, converting them with a single factor.
+     * \param other The array to add to this array.
+     * \pre other.size() == size()
+     * \throw std::invalid_argument If the sizes do not match.
+     * \return A reference to this array after the operation.
+     */
+    template <typename OtherU, typename OtherAllocator>
+        requires(U::dimension == OtherU::dimension)
+    auto operator+=(const UnitArray<T, OtherU, OtherAllocator>& other)
+        -> UnitArray& {
+        return *this += UnitArrayView<T, OtherU>{other.values()};
+    }
+
+    /**
+     * \brief Subtracts the quantities of a view from the quantities of this
+     * array, converting them with a single factor.
+     * \param other The view to subtract from this array.
+     * \pre other.size() == size()
+     * \throw std::invalid_argument If the sizes do not match.
+     * \return A reference to this array after the operation.
+     */
+    template <typename OtherU>
+        requires(U::dimension == OtherU::dimension)
+    auto operator-=(const UnitArrayView<T, OtherU>& other) -> UnitArray& {
+        this->scale_add(other, T{-1});
+        return *this;
+    }
+
+    /**
+     * \brief Subtracts the quantities of another array from the quantities of
+     * this array, converting them with a single factor.
+     * \param other The array to subtract from this array.
+     * \pre other.size() == size()
+     * \throw std::invalid_argument If the sizes do not match.
+     * \return A reference to this array after the operation.
+     */
+    template <typename OtherU, typename OtherAllocator>
+        requires(U::dimension == OtherU::dimension)
+    auto operator-=(const UnitArray<T, OtherU, OtherAllocator>& other)
+        -> UnitArray& {
+        return *this -= UnitArrayView<T, OtherU>{other.values()};
+    }
+
+    /**
+     * \brief Multiplies every quantity of this array by a scalar.
+     * \param scalar The scalar to multiply the quantities by.
+     * \return A reference to this array after the operation.
+     */
+    auto operator*=(const T& scalar) -> UnitArray& {
+        Detail::scale<T>(this->storage, this->storage, scalar);
+        return *this;
+    }
+
+    /**
+     * \brief Divides every quantity of this array by a scalar.
+     * \param scalar The scalar to divide the quantities by.
+     * \pre scalar != 0
+     * \throw std::runtime_error If the scalar is 0.
+     * \return A reference to this array after the operation.
+     */
+    auto operator/=(const T& scalar) -> UnitArray& {
+        if (scalar == 0) {
+            throw std::runtime_error("Cannot divide by zero");
+        }
+
+        for (auto& value : this->storage) {
+            value /= scalar;
+        }
+        return *this;
+    }
+
+    /**
+     * \brief Returns the element-wise sum of this array and another array, in
+     * the unit of this array.
+     * \param other The array to add to this array.
+     * \pre other.size() == size()
+     * \throw std::invalid_argument If the sizes do not match.
+     * \return The summed array.
+     */
+    template <typename OtherU, typename OtherAllocator>
+        requires(U::dimension == OtherU::dimension)
+    [[nodiscard]] auto operator+(
+        const UnitArray<T, OtherU, OtherAllocator>& other
+    ) const -> UnitArray {
+        auto result = UnitArray{this->values(), this->get_allocator()};
+        result += other;
+        return result;
+    }
+
+    /**
+     * \brief Returns the element-wise difference of this array and another
+     * array, in the unit of this array.
+     * \param other The array to subtract from this array.
+     * \pre other.size() == size()
+     * \throw std::invalid_argument If the sizes do not match.
+     * \return The subtracted array.
+     */
+    template <typename OtherU, typename OtherAllocator>
+        requires(U::dimension == OtherU::dimension)
+    [[nodiscard]] auto operator-(
+        const UnitArray<T, OtherU, OtherAllocator>& other
+    ) const -> UnitArray {
+        auto result = UnitArray{this->values(), this->get_allocator()};
+        result -= other;
+        return result;
+    }
+
+    /**
+     * \brief Returns this array with every quantity multiplied by a scalar.
+     * \param scalar The scalar to multiply the quantities by.
+     * \return The scaled array.
+     */
+    [[nodiscard]] auto operator*(const T& scalar) const -> UnitArray {
+        auto result = UnitArray{this->values(), this->get_allocator()};
+        result *= scalar;
+        return result;
+    }
+
+    /**
+     * \brief Returns this array with every quantity divided by a scalar.
+     * \param scalar The scalar to divide the quantities by.
+     * \pre scalar != 0
+     * \throw std::runtime_error If the scalar is 0.
+     * \return The divided array.
+     */
+    [[nodiscard]] auto operator/(const T& scalar) const -> UnitArray {
+        auto result = UnitArray{this->values(), this->get_allocator()};
+        result /= scalar;
+        return result;
+    }
+
+private:
+    /**
+     * \brief Adds the quantities of `other`, converted to `U` and multiplied
+     * by `sign`, to the quantities of this array.
+     */
+    template <typename OtherU>
+    auto scale_add(const UnitArrayView<T, OtherU>& other, T sign) -> void {
+        if (other.size() != this->size()) {
+            throw std::invalid_argument("Batch sizes do not match");
+        }
+
+        using Lanes = Maths::Simd::LaneKernels<T>;
+
+        const auto factor =
+            other.factor() * conversion_factor<OtherU, U, T> * sign;
+        const auto source = other.raw_values();
+        auto& values = this->storage;
+
+        if constexpr (Lanes::enabled) {
+            Lanes::scale_add(
+                source.data(),
+                factor,
+                values.data(),
+                values.data(),
+                this->size()
+            );
+        } else {
+            for (size_t i = 0; i < values.size(); ++i) {
+                values[i] += source[i] * factor;
+            }
+        }
+    }
+
+    Values storage;
+};
+
+/**
+ * \brief A read-only view of raw values, scaled by a factor when read, as
+ * quantities in the unit `U`.
+ *
+ * Returned by `UnitArray::as`, so converting an array to another unit costs
+ * nothing until its values are read or materialized.
+ *
+ * \tparam T The type of the values.
+ * \tparam U The unit of the quantities of the view.
+ */
+template <std::floating_point T, typename U>
+class UnitArrayView {
+public:
+    using Quantity = Unit<T, U>;
+
+    /**
+     * \brief Views raw values as quantities in the unit `U`, after scaling
+     * them by `factor`.
+     * \param values The values to view.
+     * \param factor The factor converting the values to the unit `U`.
+     */
+    explicit UnitArrayView(std::span<const T> values, T factor = T{1})
+        : values{values}, scale{factor} {}
+
+    /**
+     * \brief Returns the number of quantities in the view.
+     */
+    [[nodiscard]] auto size() const -> size_t { return this->values.size(); }
+
+    /**
+     * \brief Returns the quantity at the given index.
+     * \param index The index of the quantity.
+     * \pre index < size()
+     * \throw std::out_of_range If the index is out of range.
+     */
+    [[nodiscard]] auto get(size_t index) const -> Quantity {
+        if (index >= this->size()) {
+            throw std::out_of_range("Index out of range");
+        }
+        return Quantity{this->values[index] * this->scale};
+    }
+
+    /**
+     * \brief Returns the viewed values, before scaling.
+     */
+    [[nodiscard]] auto raw_values() const -> std::span<const T> {
+        return this->values;
+    }
+
+    /**
+     * \brief Returns the factor scaling the viewed values to the unit `U`.
+     */
+    [[nodiscard]] auto factor() const -> T { return this->scale; }
+
+    /**
+     * \brief Returns a view of the same values in the unit `NewU`.
+     * \tparam NewU The unit of the view, of the same dimension as `U`.
+     */
+    template <typename NewU>
+        requires(U::dimension == NewU::dimension)
+    [[nodiscard]] auto as() const -> UnitArrayView<T, NewU> {
+        return UnitArrayView<T, NewU>{
+            this->values,
+            this->scale * conversion_factor<U, NewU, T>,
+        };
+    }
+
+    /**
+     * \brief Writes the scaled values to `out`.
+     * \param out The destination of the values, in the unit `U`.
+     * \pre out.size() == size()
+     * \throw std::invalid_argument If the sizes do not match.
+     */
+    auto copy_to(std::span<T> out) const -> void {
+        if (out.size() != this->size()) {
+            throw std::invalid_argument("Input and output sizes do not match");
+        }
+        Detail::scale<T>(this->values, out, this->scale);
+    }
+
+    /**
+     * \brief Returns a new array holding the scaled values.
+     * \param allocator The allocator of the values of the array.
+     */
+    template <typename Allocator = Maths::AlignedAllocator<T>>
+    [[nodiscard]] auto to_array(const Allocator& allocator = Allocator{}) const
+        -> UnitArray<T, U, Allocator> {
+        auto result = UnitArray<T, U, Allocator>(this->size(), allocator);
+        this->copy_to(result.values());
+        return result;
+    }
+
+private:
+    std::span<const T> values;
+    T scale;
+};
+
+/**
+ * \brief Returns the element-wise product of two arrays, in the product of
+ * their units, without converting either array. The result uses the
+ * allocator of `lhs`.
+ * \pre lhs.size() == rhs.size()
+ * \throw std::invalid_argument If the sizes do not match.
+ */
+template <
+    std::floating_point T,
+    typename LhsU,
+    typename RhsU,
+    typename Allocator,
+    typename OtherAllocator>
+[[nodiscard]] auto operator*(
+    const UnitArray<T, LhsU, Allocator>& lhs,
+    const UnitArray<T, RhsU, OtherAllocator>& rhs
+) -> UnitArray<T, UnitProduct<LhsU, RhsU>, Allocator> {
+    if (lhs.size() != rhs.size()) {
+        throw std::invalid_argument("Batch sizes do not match");
+    }
+
+    using Lanes = Maths::Simd::LaneKernels<T>;
+
+    auto result = UnitArray<T, UnitProduct<LhsU, RhsU>, Allocator>(
+        lhs.size(), lhs.get_allocator()
+    );
+    const auto lhs_values = lhs.values();
+    const auto rhs_values = rhs.values();
+    const auto out = result.values();
+
+    if constexpr (Lanes::enabled) {
+        Lanes::multiply(
+            lhs_values.data(), rhs_values.data(), out.data(), out.size()
+        );
+    } else {
+        for (size_t i = 0; i < out.size(); ++i) {
+            out[i] = lhs_values[i] * rhs_values[i];
+        }
+    }
+    return result;
+}
+
+/**
+ * \brief Returns the element-wise quotient of two arrays, in the quotient of
+ * their units, without converting either array. The result uses the
+ * allocator of `lhs`.
+ * \pre lhs.size() == rhs.size()
+ * \throw std::invalid_argument If the sizes do not match.
+ */
+template <
+    std::floating_point T,
+    typename LhsU,
+    typename RhsU,
+    typename Allocator,
+    typename OtherAllocator>
+[[nodiscard]] auto operator/(
+    const UnitArray<T, LhsU, Allocator>& lhs,
+    const UnitArray<T, RhsU, OtherAllocator>& rhs
+) -> UnitArray<T, UnitQuotient<LhsU, RhsU>, Allocator> {
+    if (lhs.size() != rhs.size()) {
+        throw std::invalid_argument("Batch sizes do not match");
+    }
+
+    auto result = UnitArray<T, UnitQuotient<LhsU, RhsU>, Allocator>(
+        lhs.size(), lhs.get_allocator()
+    );
+    const auto lhs_values = lhs.values();
+    const auto rhs_values = rhs.values();
+    const auto out = result.values();
+
+    for (size_t i = 0; i < out.size(); ++i) {
+        out[i] = lhs_values[i] / rhs_values[i];
+    }
+    return result;
+}
+
+}  // namespace Luminol::Units
@@ -0,0 +1,275 @@
+#pragma once
+
+#include <concepts>
+#include <cstddef>
+
+#include <LuminolMaths/Config.hpp>
+#include <LuminolMaths/Precision.hpp>
+#include <LuminolMaths/Units/Convert.hpp>
+#include <LuminolMaths/Units/Unit.hpp>
+#include <LuminolMaths/Vector.hpp>
+
+namespace Luminol::Units {
+
+/**
+ * \brief A vector of N quantities in the unit `U`, e.g. a 3D velocity in
+ * meters per second.
+ *
+ * The storage is a plain `Vector<T, N>`, so vector quantities keep the layout
+ * and the SIMD kernels of `Vector`. Dot and cross products, and products with
+ * scalar quantities, yield the product unit at compile time, and converting
+ * the whole vector to another unit is a single multiplication by a folded
+ * factor.
+ *
+ * \tparam T The type of the components.
+ * \tparam U The unit of the components.
+ * \tparam N The number of components.
+ */
+template <std::floating_point T, typename U, size_t N>
+    requires(N >= 1 && N <= 4)
+class VectorQuantity {
+public:
+    using Quantity = Unit<T, U>;
+    using VectorType = Maths::Vector<T, N>;
+
+    constexpr VectorQuantity() = default;
+
+    /**
+     * \brief Constructs a vector quantity from the components in the unit
+     * `U`.
+     * \param vector The components in the unit `U`.
+     */
+    constexpr explicit VectorQuantity(const VectorType& vector)
+        : vector{vector} {}
+
+    /**
+     * \brief Constructs a vector quantity from another unit of the same
+     * dimension, converting it with a single multiplication.
+     * \param other The vector quantity to convert.
+     */
+    template <typename OtherU>
+        requires(U::dimension == OtherU::dimension)
+    constexpr VectorQuantity(const VectorQuantity<T, OtherU, N>& other)
+        : vector{other.template as<U>().get_vector()} {}
+
+    /**
+     * \brief Returns the components in the unit `U`.
+     */
+    [[nodiscard]] constexpr auto get_vector() const -> const VectorType& {
+        return this->vector;
+    }
+
+    /**
+     * \brief Returns the component at the given index.
+     * \param index The index of the component.
+     * \pre index < N
+     * \throw std::out_of_range If the index is out of range and
+     * `Config::checked_access` is enabled, otherwise the behavior is undefined.
+     */
+    [[nodiscard]] constexpr auto operator[](size_t index) const
+        noexcept(!Maths::Config::checked_access) -> Quantity {
+        return Quantity{this->vector[index]};
+    }
+
+    /**
+     * \brief Returns the vector quantity in the unit `NewU`.
+     * \tparam NewU The new unit, of the same dimension as `U`.
+     */
+    template <typename NewU>
+        requires(U::dimension == NewU::dimension)
+    [[nodiscard]] constexpr auto as() const -> VectorQuantity<T, NewU, N> {
+        if constexpr (std::same_as<U, NewU>) {
+            return VectorQuantity<T, NewU, N>{this->vector};
+        } else {
+            return VectorQuantity<T, NewU, N>{
+                this->vector * conversion_factor<U, NewU, T>
+            };
+        }
+    }
+
+    /**
+     * \brief Returns the length of the vector quantity.
+     */
+    [[nodiscard]] constexpr auto length() const -> Quantity {
+        return Quantity{this->vector.length()};
+    }
+
+    /**
+     * \brief Returns the direction of the vector quantity, a dimensionless
+     * unit vector.
+     * \tparam P See `Vector::normalized`.
+     * \return A zero vector if the length is 0.
+     */
+    template <Maths::Precision P = Maths::Precision::Exact>
+    [[nodiscard]] constexpr auto direction() const -> VectorType {
+        return this->vector.template normalized<P>();
+    }
+
+    /**
+     * \brief Returns the dot product of this vector quantity and another, in
+     * the product of their units.
+     * \param other The other vector quantity.
+     */
+    template <typename OtherU>
+    [[nodiscard]] constexpr auto dot(const VectorQuantity<T, OtherU, N>& other
+    ) const -> Unit<T, UnitProduct<U, OtherU>> {
+        return Unit<T, UnitProduct<U, OtherU>>{
+            this->vector.dot(other.get_vector())
+        };
+    }
+
+    /**
+     * \brief Returns the cross product of this vector quantity and another, in
+     * the product of their units.
+     * \param other The other vector quantity.
+     * \pre N == 3
+     */
+    template <typename OtherU>
+    [[nodiscard]] constexpr auto cross(const VectorQuantity<T, OtherU, N>& other
+    ) const -> VectorQuantity<T, UnitProduct<U, OtherU>, N>
+        requires(N == 3)
+    {
+        return VectorQuantity<T, UnitProduct<U, OtherU>, N>{
+            this->vector.cross(other.get_vector())
+        };
+    }
+
+    /**
+     * \brief Returns the sum of this vector quantity and another of the same
+     * dimension, in the unit of this vector quantity.
+     * \param other The vector quantity to add.
+     */
+    template <typename OtherU>
+        requires(U::dimension == OtherU::dimension)
+    [[nodiscard]] constexpr auto operator+(
+        const VectorQuantity<T, OtherU, N>& other
+    ) const -> VectorQuantity {
+        return VectorQuantity{
+            this->vector + other.template as<U>().get_vector()
+        };
+    }
+
+    /**
+     * \brief Returns the difference of this vector quantity and another of
+     * the same dimension, in the unit of this vector quantity.
+     * \param other The vector quantity to subtract.
+     */
+    template <typename OtherU>
+        requires(U::dimension == OtherU::dimension)
+    [[nodiscard]] constexpr auto operator-(
+        const VectorQuantity<T, OtherU, N>& other
+    ) const -> VectorQuantity {
+        return VectorQuantity{
+            this->vector - other.template as<U>().get_vector()
+        };
+    }
+
+    /**
+     * \brief Adds another vector quantity of the same dimension to this one.
+     * \param other The vector quantity to add.
+     * \return A reference to this vector quantity after the operation.
+     */
+    template <typename OtherU>
+        requires(U::dimension == OtherU::dimension)
+    constexpr auto operator+=(const VectorQuantity<T, OtherU, N>& other)
+        -> VectorQuantity& {
+        this->vector += other.template as<U>().get_vector();
+        return *this;
+    }
+
+    /**
+     * \brief Subtracts another vector quantity of the same dimension from
+     * this one.
+     * \param other The vector quantity to subtract.
+     * \return A reference to this vector quantity after the operation.
+     */
+    template <typename OtherU>
+        requires(U::dimension == OtherU::dimension)
+    constexpr auto operator-=(const VectorQuantity<T, OtherU, N>& other)
+        -> VectorQuantity& {
+        this->vector -= other.template as<U>().get_vector();
+        return *this;
+    }
+
+    /**
+     * \brief Returns this vector quantity multiplied by a scalar quantity, in
+     * the product of their units, e.g. a velocity times a time.
+     * \param scalar The scalar quantity to multiply by.
+     */
+    template <typename OtherU>
+    [[nodiscard]] constexpr auto operator*(const Unit<T, OtherU>& scalar) const
+        -> VectorQuantity<T, UnitProduct<U, OtherU>, N> {
+        return VectorQuantity<T, UnitProduct<U, OtherU>, N>{
+            this->vector * scalar.get_value()
+        };
+    }
+
+    /**
+     * \brief Returns this vector quantity divided by a scalar quantity, in
+     * the quotient of their units, e.g. a displacement over a time.
+     * \param scalar The scalar quantity to divide by.
+     */
+    template <typename OtherU>
+    [[nodiscard]] constexpr auto operator/(const Unit<T, OtherU>& scalar) const
+        -> VectorQuantity<T, UnitQuotient<U, OtherU>, N> {
+        return VectorQuantity<T, UnitQuotient<U, OtherU>, N>{
+            this->vector / scalar.get_value()
+        };
+    }
+
+    /**
+     * \brief Returns this vector quantity multiplied by a scalar.
+     * \param scalar The scalar to multiply by.
+     */
+    [[nodiscard]] constexpr auto operator*(const T& scalar) const
+        -> VectorQuantity {
+        return VectorQuantity{this->vector * scalar};
+    }
+
+    /**
+     * \brief Returns this vector quantity divided by a scalar.
+     * \param scalar The scalar to divide by.
+     */
+    [[nodiscard]] constexpr auto operator/(const T& scalar) const
+        -> VectorQuantity {
+        return VectorQuantity{this->vector / scalar};
+    }
+
+    /**
+     * \brief Returns this vector quantity negated.
+     */
+    [[nodiscard]] constexpr auto operator-() const -> VectorQuantity {
+        return VectorQuantity{-this->vector};
+    }
+
+    /**
+     * \brief Returns whether this vector quantity equals another of the same
+     * dimension, after converting it to the unit of this vector quantity.
+     * \param other The vector quantity to compare with.
+     */
+    template <typename OtherU>
+        requires(U::dimension == OtherU::dimension)
+    [[nodiscard]] constexpr auto operator==(
+        const VectorQuantity<T, OtherU, N>& other
+    ) const -> bool {
+        return this->vector == other.template as<U>().get_vector();
+    }
+
+private:
+    VectorType vector = {};
+};
+
+/**
+ * \brief Returns a vector quantity multiplied by a scalar quantity, in the
+ * product of their units.
+ */
+template <std::floating_point T, typename LhsU, typename RhsU, size_t N>
+[[nodiscard]] constexpr auto operator*(
+    const Unit<T, LhsU>& scalar, const VectorQuantity<T, RhsU, N>& vector
+) -> VectorQuantity<T, UnitProduct<LhsU, RhsU>, N> {
+    return VectorQuantity<T, UnitProduct<LhsU, RhsU>, N>{
+        vector.get_vector() * scalar.get_value()
+    };
+}
+
+}  // namespace Luminol::Units
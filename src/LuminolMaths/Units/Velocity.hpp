@@ -37,26 +37,6 @@ using NanometerPerSecond = VelocityUnitType<Nanometer, Second>;
 template <std::floating_point T, typename U>
 using Velocity = Unit<T, U>;
 
-template <std::floating_point T, typename LengthU, typename TimeU>
-    requires(LengthU::type == UnitEnum::Length && TimeU::type == UnitEnum::Time)
-constexpr auto operator/(
-    const Length<T, LengthU>& length, const Time<T, TimeU>& time
-) -> Velocity<T, VelocityUnitType<LengthU, TimeU>> {
-    constexpr auto length_ratio = static_cast<T>(LengthU::ratio::num) /
-                                  static_cast<T>(LengthU::ratio::den);
-    constexpr auto time_ratio =
-        static_cast<T>(TimeU::ratio::num) / static_cast<T>(TimeU::ratio::den);
-
-    static_assert(length_ratio != 0);
-    static_assert(time_ratio != 0);
-
-    constexpr auto velocity_ratio = length_ratio / time_ratio;
-
-    return Velocity<T, VelocityUnitType<LengthU, TimeU>>{
-        length.get_value() / time.get_value() * velocity_ratio,
-    };
-}
-
 using KilometersPerHour = Velocity<double, KilometerPerHour>;
 using KilometersPerHour_f = Velocity<float, KilometerPerHour>;
 using MetersPerHour = Velocity<double, MeterPerHour>;
@@ -3,6 +3,11 @@
 #include <cmath>
 #include <array>
 #include <stdexcept>
+#include <type_traits>
+
+#include <LuminolMaths/Config.hpp>
+#include <LuminolMaths/Precision.hpp>
+#include <LuminolMaths/Simd.hpp>
 
 namespace Luminol::Maths {
 
@@ -16,6 +21,10 @@ namespace Luminol::Maths {
  * The underlying data is guaranteed that it is contiguous in memory,
  * so it can be submitted to graphics APIs that expect vector types.
  *
+ * When the library is built with `LUMINOL_MATHS_ENABLE_SIMD`,
+ * `Vector<float, 4>` and the dot and cross products of `Vector<float, 3>` use
+ * SSE kernels at runtime. Constant evaluation always uses the scalar loops.
+ *
  * \tparam T The underlying type of the elements in the vector.
  * \tparam N The number of elements in the vector.
  */
@@ -166,6 +175,14 @@ public:
      * \return The length of the vector.
      */
     [[nodiscard]] constexpr auto length() const -> T {
+        if constexpr (requires { Kernels::dot; }) {
+            if (!std::is_constant_evaluated()) {
+                return std::sqrt(
+                    Kernels::dot(this->vector.data(), this->vector.data())
+                );
+            }
+        }
+
         auto result = T{0};
 
         for (size_t i = 0; i < N; ++i) {
@@ -178,18 +195,32 @@ public:
     /**
      * \brief Returns a normalized version of the vector. Note that this does
      * not modify the original vector.
+     * \tparam P `Precision::Fast` scales the vector by `FastMath::rsqrt` of
+     * its squared length instead of dividing it by its length.
      * \return The normalized version of the vector.
      * \return A zero vector if the length of the vector is 0 to avoid division
      * by zero.
      */
+    template <Precision P = Precision::Exact>
     [[nodiscard]] constexpr auto normalized() const -> Vector {
-        const auto length = this->length();
+        if constexpr (P == Precision::Fast) {
+            // A single return keeps the result in one register, and scaling
+            // the zero vector by 0 yields the zero vector anyway.
+            const auto squared_length = this->dot(*this);
+            const auto scale = squared_length == 0
+                                   ? T{0}
+                                   : FastMath::rsqrt(squared_length);
+
+            return *this * scale;
+        } else {
+            const auto length = this->length();
+
+            if (length == 0) {
+                return Vector{};
+            }
 
-        if (length == 0) {
-            return Vector{};
+            return *this / length;
         }
-
-        return *this / length;
     }
 
     /**
@@ -198,6 +229,12 @@ public:
      * \return The dot product of this vector and the other vector.
      */
     [[nodiscard]] constexpr auto dot(const Vector& other) const -> T {
+        if constexpr (requires { Kernels::dot; }) {
+            if (!std::is_constant_evaluated()) {
+                return Kernels::dot(this->vector.data(), other.vector.data());
+            }
+        }
+
         auto result = T{0};
 
         for (size_t i = 0; i < N; ++i) {
@@ -216,6 +253,18 @@ public:
     [[nodiscard]] constexpr auto cross(const Vector& other) const -> Vector
         requires(N == 3)
     {
+        if constexpr (requires { Kernels::cross; }) {
+            if (!std::is_constant_evaluated()) {
+                auto result = Vector{};
+                Kernels::cross(
+                    this->vector.data(),
+                    other.vector.data(),
+                    result.vector.data()
+                );
+                return result;
+            }
+        }
+
         return Vector{
             this->y() * other.z() - this->z() * other.y(),
             this->z() * other.x() - this->x() * other.z(),
@@ -228,11 +277,17 @@ public:
      * returns the x component of the vector.
      * \param index The index of the element to return.
      * \pre index < N
-     * \throw std::out_of_range If the index is out of range.
+     * \throw std::out_of_range If the index is out of range and
+     * `Config::checked_access` is enabled, otherwise the behavior is undefined.
      * \return The vector component at the given index.
      */
-    [[nodiscard]] constexpr auto operator[](size_t index) -> T& {
-        return this->vector.at(index);
+    [[nodiscard]] constexpr auto operator[](size_t index)
+        noexcept(!Config::checked_access) -> T& {
+        if constexpr (Config::checked_access) {
+            return this->vector.at(index);
+        } else {
+            return this->vector[index];
+        }
     }
 
     /**
@@ -240,11 +295,33 @@ public:
      * returns the x component of the vector.
      * \param index The index of the element to return.
      * \pre index < N
-     * \throw std::out_of_range If the index is out of range.
+     * \throw std::out_of_range If the index is out of range and
+     * `Config::checked_access` is enabled, otherwise the behavior is undefined.
      * \return The vector component at the given index.
      */
-    [[nodiscard]] constexpr auto operator[](size_t index) const -> const T& {
-        return this->vector.at(index);
+    [[nodiscard]] constexpr auto operator[](size_t index) const
+        noexcept(!Config::checked_access) -> const T& {
+        if constexpr (Config::checked_access) {
+            return this->vector.at(index);
+        } else {
+            return this->vector[index];
+        }
+    }
+
+    /**
+     * \brief Returns a pointer to the N contiguous components of the vector,
+     * for iterating over them without per-element checks.
+     */
+    [[nodiscard]] constexpr auto data() noexcept -> T* {
+        return this->vector.data();
+    }
+
+    /**
+     * \brief Returns a pointer to the N contiguous components of the vector,
+     * for iterating over them without per-element checks.
+     */
+    [[nodiscard]] constexpr auto data() const noexcept -> const T* {
+        return this->vector.data();
     }
 
     /**
@@ -258,6 +335,18 @@ public:
     [[nodiscard]] constexpr auto operator+(const Vector& other) const
         -> Vector {
         auto result = Vector{};
+
+        if constexpr (requires { Kernels::add; }) {
+            if (!std::is_constant_evaluated()) {
+                Kernels::add(
+                    this->vector.data(),
+                    other.vector.data(),
+                    result.vector.data()
+                );
+                return result;
+            }
+        }
+
         for (size_t i = 0; i < N; ++i) {
             result.vector[i] = this->vector[i] + other.vector[i];
         }
@@ -275,6 +364,18 @@ public:
     [[nodiscard]] constexpr auto operator-(const Vector& other) const
         -> Vector {
         auto result = Vector{};
+
+        if constexpr (requires { Kernels::subtract; }) {
+            if (!std::is_constant_evaluated()) {
+                Kernels::subtract(
+                    this->vector.data(),
+                    other.vector.data(),
+                    result.vector.data()
+                );
+                return result;
+            }
+        }
+
         for (size_t i = 0; i < N; ++i) {
             result.vector[i] = this->vector[i] - other.vector[i];
         }
@@ -284,6 +385,18 @@ public:
     [[nodiscard]] constexpr auto operator*(const Vector& other) const
         -> Vector {
         auto result = Vector{};
+
+        if constexpr (requires { Kernels::multiply; }) {
+            if (!std::is_constant_evaluated()) {
+                Kernels::multiply(
+                    this->vector.data(),
+                    other.vector.data(),
+                    result.vector.data()
+                );
+                return result;
+            }
+        }
+
         for (size_t i = 0; i < N; ++i) {
             result.vector[i] = this->vector[i] * other.vector[i];
         }
@@ -300,6 +413,16 @@ public:
      */
     [[nodiscard]] constexpr auto operator*(const T& scalar) const -> Vector {
         auto result = Vector{};
+
+        if constexpr (requires { Kernels::scale; }) {
+            if (!std::is_constant_evaluated()) {
+                Kernels::scale(
+                    this->vector.data(), scalar, result.vector.data()
+                );
+                return result;
+            }
+        }
+
         for (size_t i = 0; i < N; ++i) {
             result.vector[i] = this->vector[i] * scalar;
         }
@@ -320,6 +443,16 @@ public:
         }
 
         auto result = Vector{};
+
+        if constexpr (requires { Kernels::divide; }) {
+            if (!std::is_constant_evaluated()) {
+                Kernels::divide(
+                    this->vector.data(), scalar, result.vector.data()
+                );
+                return result;
+            }
+        }
+
         for (size_t i = 0; i < N; ++i) {
             result.vector[i] = this->vector[i] / scalar;
         }
@@ -333,6 +466,17 @@ public:
      * \return A reference to this vector after the operation.
      */
     constexpr auto operator+=(const Vector& other) -> Vector& {
+        if constexpr (requires { Kernels::add; }) {
+            if (!std::is_constant_evaluated()) {
+                Kernels::add(
+                    this->vector.data(),
+                    other.vector.data(),
+                    this->vector.data()
+                );
+                return *this;
+            }
+        }
+
         for (size_t i = 0; i < N; ++i) {
             this->vector[i] += other.vector[i];
         }
@@ -346,6 +490,17 @@ public:
      * \return A reference to this vector after the operation.
      */
     constexpr auto operator-=(const Vector& other) -> Vector& {
+        if constexpr (requires { Kernels::subtract; }) {
+            if (!std::is_constant_evaluated()) {
+                Kernels::subtract(
+                    this->vector.data(),
+                    other.vector.data(),
+                    this->vector.data()
+                );
+                return *this;
+            }
+        }
+
         for (size_t i = 0; i < N; ++i) {
             this->vector[i] -= other.vector[i];
         }
@@ -353,6 +508,17 @@ public:
     }
 
     constexpr auto operator*=(const Vector& other) -> Vector& {
+        if constexpr (requires { Kernels::multiply; }) {
+            if (!std::is_constant_evaluated()) {
+                Kernels::multiply(
+                    this->vector.data(),
+                    other.vector.data(),
+                    this->vector.data()
+                );
+                return *this;
+            }
+        }
+
         for (size_t i = 0; i < N; ++i) {
             this->vector[i] *= other.vector[i];
         }
@@ -365,6 +531,15 @@ public:
      * \return A reference to this vector after the operation.
      */
     constexpr auto operator*=(const T& scalar) -> Vector& {
+        if constexpr (requires { Kernels::scale; }) {
+            if (!std::is_constant_evaluated()) {
+                Kernels::scale(
+                    this->vector.data(), scalar, this->vector.data()
+                );
+                return *this;
+            }
+        }
+
         for (size_t i = 0; i < N; ++i) {
             this->vector[i] *= scalar;
         }
@@ -383,6 +558,15 @@ public:
             throw std::runtime_error("Cannot divide by zero");
         }
 
+        if constexpr (requires { Kernels::divide; }) {
+            if (!std::is_constant_evaluated()) {
+                Kernels::divide(
+                    this->vector.data(), scalar, this->vector.data()
+                );
+                return *this;
+            }
+        }
+
         for (size_t i = 0; i < N; ++i) {
             this->vector[i] /= scalar;
         }
@@ -409,6 +593,14 @@ public:
      */
     [[nodiscard]] constexpr auto operator-() const -> Vector {
         auto result = Vector{};
+
+        if constexpr (requires { Kernels::negate; }) {
+            if (!std::is_constant_evaluated()) {
+                Kernels::negate(this->vector.data(), result.vector.data());
+                return result;
+            }
+        }
+
         for (size_t i = 0; i < N; ++i) {
             result.vector[i] = -this->vector[i];
         }
@@ -417,6 +609,9 @@ public:
     // NOLINTEND(cppcoreguidelines-pro-bounds-constant-array-index)
 
 private:
+    /// The SSE kernels for this vector, only specialized for float vectors.
+    using Kernels = Simd::VectorKernels<T, N>;
+
     /// A fixed-size array of N components to represent the vector.
     std::array<T, N> vector;
 };
@@ -0,0 +1,892 @@
+#pragma once
+
+#include <array>
+#include <cmath>
+#include <memory_resource>
+#include <span>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include <LuminolMaths/AlignedAllocator.hpp>
+#include <LuminolMaths/Execution.hpp>
+#include <LuminolMaths/Simd.hpp>
+#include <LuminolMaths/Vector.hpp>
+
+namespace Luminol::Maths {
+
+/**
+ * \brief A growable structure-of-arrays container of `Vector<T, N>`.
+ *
+ * Each component is stored in its own contiguous, aligned lane, e.g. all of
+ * the x components followed by all of the y components, so bulk operations
+ * stream through memory and map directly onto SIMD registers. The bulk
+ * operations mirror the member functions of `Vector`, applied element-wise.
+ *
+ * When the library is built with `LUMINOL_MATHS_ENABLE_SIMD`, the float
+ * kernels use SSE, or AVX when the compiler targets it.
+ *
+ * \tparam T The underlying type of the elements in the vectors.
+ * \tparam N The number of elements in each vector.
+ * \tparam Allocator The allocator used for every lane.
+ */
+template <typename T, size_t N, typename Allocator = AlignedAllocator<T>>
+    requires(N >= 1 && N <= 4)
+class VectorBatch {
+public:
+    using Lane = std::vector<T, Allocator>;
+    using VectorType = Vector<T, N>;
+
+    VectorBatch() = default;
+
+    /**
+     * \brief Constructs an empty batch whose lanes use the given allocator.
+     * \param allocator The allocator to copy into every lane.
+     */
+    explicit VectorBatch(const Allocator& allocator)
+        : lanes{make_lanes(allocator, std::make_index_sequence<N>{})} {}
+
+    /**
+     * \brief Constructs a batch of `count` zero vectors.
+     * \param count The number of vectors in the batch.
+     * \param allocator The allocator to copy into every lane.
+     */
+    explicit VectorBatch(
+        size_t count, const Allocator& allocator = Allocator{}
+    )
+        : VectorBatch{allocator} {
+        this->resize(count);
+    }
+
+    /**
+     * \brief Constructs a batch by transposing an array of vectors.
+     * \param vectors The vectors to copy into the batch.
+     * \param allocator The allocator to copy into every lane.
+     */
+    explicit VectorBatch(
+        std::span<const VectorType> vectors,
+        const Allocator& allocator = Allocator{}
+    )
+        : VectorBatch{allocator} {
+        this->assign(vectors);
+    }
+
+    /**
+     * \brief Returns the number of vectors in the batch.
+     * \return The number of vectors in the batch.
+     */
+    [[nodiscard]] auto size() const -> size_t {
+        return this->lanes.front().size();
+    }
+
+    /**
+     * \brief Returns whether the batch contains no vectors.
+     * \return Whether the batch contains no vectors.
+     */
+    [[nodiscard]] auto empty() const -> bool {
+        return this->lanes.front().empty();
+    }
+
+    /**
+     * \brief Returns the number of vectors the batch can hold without
+     * reallocating.
+     * \return The capacity of the batch.
+     */
+    [[nodiscard]] auto capacity() const -> size_t {
+        return this->lanes.front().capacity();
+    }
+
+    /**
+     * \brief Returns the allocator of the lanes.
+     * \return A copy of the allocator of the lanes.
+     */
+    [[nodiscard]] auto get_allocator() const -> Allocator {
+        return this->lanes.front().get_allocator();
+    }
+
+    /**
+     * \brief Reserves storage for at least `count` vectors in every lane.
+     * \param count The number of vectors to reserve storage for.
+     */
+    auto reserve(size_t count) -> void {
+        for (auto& lane : this->lanes) {
+            lane.reserve(count);
+        }
+    }
+
+    /**
+     * \brief Resizes the batch, new vectors are zero.
+     * \param count The new number of vectors in the batch.
+     */
+    auto resize(size_t count) -> void {
+        for (auto& lane : this->lanes) {
+            lane.resize(count);
+        }
+    }
+
+    /**
+     * \brief Removes every vector from the batch, keeping the capacity.
+     */
+    auto clear() -> void {
+        for (auto& lane : this->lanes) {
+            lane.clear();
+        }
+    }
+
+    /**
+     * \brief Appends a vector to the end of the batch.
+     * \param vector The vector to append.
+     */
+    auto push_back(const VectorType& vector) -> void {
+        this->for_each_component([&]<size_t I>() {
+            this->lanes[I].push_back(component<I>(vector));
+        });
+    }
+
+    /**
+     * \brief Returns a copy of the vector at the given index.
+     * \param index The index of the vector.
+     * \pre index < size()
+     * \throw std::out_of_range If the index is out of range.
+     * \return The vector at the given index.
+     */
+    [[nodiscard]] auto get(size_t index) const -> VectorType {
+        auto result = VectorType{};
+        this->for_each_component([&]<size_t I>() {
+            component<I>(result) = this->lanes[I].at(index);
+        });
+        return result;
+    }
+
+    /**
+     * \brief Overwrites the vector at the given index.
+     * \param index The index of the vector.
+     * \param vector The new value of the vector.
+     * \pre index < size()
+     * \throw std::out_of_range If the index is out of range.
+     */
+    auto set(size_t index, const VectorType& vector) -> void {
+        this->for_each_component([&]<size_t I>() {
+            this->lanes[I].at(index) = component<I>(vector);
+        });
+    }
+
+    /**
+     * \brief Returns the contiguous lane of the given component, e.g.
+     * `lane(0)` holds every x component.
+     * \param index The index of the component.
+     * \pre index < N
+     * \throw std::out_of_range If the index is out of range.
+     * \return A view over the lane.
+     */
+    [[nodiscard]] auto lane(size_t index) -> std::span<T> {
+        return this->lanes.at(index);
+    }
+
+    /**
+     * \brief Returns the contiguous lane of the given component, e.g.
+     * `lane(0)` holds every x component.
+     * \param index The index of the component.
+     * \pre index < N
+     * \throw std::out_of_range If the index is out of range.
+     * \return A view over the lane.
+     */
+    [[nodiscard]] auto lane(size_t index) const -> std::span<const T> {
+        return this->lanes.at(index);
+    }
+
+    // NOLINTBEGIN(readability-identifier-length)
+    /**
+     * \brief Returns the lane of x components.
+     * \pre N >= 1
+     * \return A view over the x components.
+     */
+    [[nodiscard]] auto x() -> std::span<T> { return this->lanes[0]; }
+    [[nodiscard]] auto x() const -> std::span<const T> {
+        return this->lanes[0];
+    }
+
+    /**
+     * \brief Returns the lane of y components.
+     * \pre N >= 2
+     * \return A view over the y components.
+     */
+    [[nodiscard]] auto y() -> std::span<T>
+        requires(N >= 2)
+    {
+        return this->lanes[1];
+    }
+    [[nodiscard]] auto y() const -> std::span<const T>
+        requires(N >= 2)
+    {
+        return this->lanes[1];
+    }
+
+    /**
+     * \brief Returns the lane of z components.
+     * \pre N >= 3
+     * \return A view over the z components.
+     */
+    [[nodiscard]] auto z() -> std::span<T>
+        requires(N >= 3)
+    {
+        return this->lanes[2];
+    }
+    [[nodiscard]] auto z() const -> std::span<const T>
+        requires(N >= 3)
+    {
+        return this->lanes[2];
+    }
+
+    /**
+     * \brief Returns the lane of w components.
+     * \pre N == 4
+     * \return A view over the w components.
+     */
+    [[nodiscard]] auto w() -> std::span<T>
+        requires(N == 4)
+    {
+        return this->lanes[3];
+    }
+    [[nodiscard]] auto w() const -> std::span<const T>
+        requires(N == 4)
+    {
+        return this->lanes[3];
+    }
+    // NOLINTEND(readability-identifier-length)
+
+    /**
+     * \brief Replaces the contents of the batch by transposing an array of
+     * vectors.
+     * \param vectors The vectors to copy into the batch.
+     */
+    auto assign(std::span<const VectorType> vectors) -> void {
+        this->resize(vectors.size());
+
+        this->for_each_component([&]<size_t I>() {
+            auto* lane = this->lanes[I].data();
+            for (size_t i = 0; i < vectors.size(); ++i) {
+                lane[i] = component<I>(vectors[i]);
+            }
+        });
+    }
+
+    /**
+     * \brief Transposes the batch back into an array of vectors.
+     * \param out The destination of the vectors.
+     * \pre out.size() == size()
+     * \throw std::invalid_argument If the sizes do not match.
+     */
+    auto to_vectors(std::span<VectorType> out) const -> void {
+        this->check_size(out.size());
+
+        this->for_each_component([&]<size_t I>() {
+            const auto* lane = this->lanes[I].data();
+            for (size_t i = 0; i < out.size(); ++i) {
+                component<I>(out[i]) = lane[i];
+            }
+        });
+    }
+
+    /**
+     * \brief Transposes the batch back into an array of vectors.
+     * \return A vector containing a copy of every vector in the batch.
+     */
+    [[nodiscard]] auto to_vectors() const -> std::vector<VectorType> {
+        auto result = std::vector<VectorType>(this->size());
+        this->to_vectors(result);
+        return result;
+    }
+
+    /**
+     * \brief Computes the dot product of every pair of vectors.
+     * \param other The batch to calculate the dot products with.
+     * \param out The destination of the dot products.
+     * \pre other.size() == size() && out.size() == size()
+     * \throw std::invalid_argument If the sizes do not match.
+     */
+    auto dot(const VectorBatch& other, std::span<T> out) const -> void {
+        this->check_size(other.size());
+        this->check_size(out.size());
+
+        this->dot_range(other, out.data(), 0, out.size());
+    }
+
+    /**
+     * \brief Computes the dot product of every pair of vectors, splitting the
+     * batch into chunks run under the given policy.
+     * \param policy The execution policy, see `Execution`.
+     * \param other The batch to calculate the dot products with.
+     * \param out The destination of the dot products.
+     * \pre other.size() == size() && out.size() == size()
+     * \throw std::invalid_argument If the sizes do not match.
+     */
+    template <Execution::Policy P>
+    auto dot(P&& policy, const VectorBatch& other, std::span<T> out) const
+        -> void {
+        this->check_size(other.size());
+        this->check_size(out.size());
+
+        Execution::for_each_chunk(
+            std::forward<P>(policy),
+            out.size(),
+            sizeof(T) * (N * 2 + 1),
+            [&](size_t begin, size_t end) {
+                this->dot_range(other, out.data(), begin, end - begin);
+            }
+        );
+    }
+
+    /**
+     * \brief Computes the dot product of every pair of vectors.
+     * \param other The batch to calculate the dot products with.
+     * \pre other.size() == size()
+     * \throw std::invalid_argument If the sizes do not match.
+     * \return The dot products, one per vector.
+     */
+    [[nodiscard]] auto dot(const VectorBatch& other) const -> Lane {
+        auto result = Lane(this->size(), this->lanes[0].get_allocator());
+        this->dot(other, result);
+        return result;
+    }
+
+    /**
+     * \brief Computes the length of every vector.
+     * \param out The destination of the lengths.
+     * \pre out.size() == size()
+     * \throw std::invalid_argument If the sizes do not match.
+     */
+    auto length(std::span<T> out) const -> void {
+        this->dot(*this, out);
+        Kernels::sqrt(out.data(), out.data(), out.size());
+    }
+
+    /**
+     * \brief Computes the length of every vector, splitting the batch into
+     * chunks run under the given policy.
+     * \param policy The execution policy, see `Execution`.
+     * \param out The destination of the lengths.
+     * \pre out.size() == size()
+     * \throw std::invalid_argument If the sizes do not match.
+     */
+    template <Execution::Policy P>
+    auto length(P&& policy, std::span<T> out) const -> void {
+        this->check_size(out.size());
+
+        Execution::for_each_chunk(
+            std::forward<P>(policy),
+            out.size(),
+            sizeof(T) * (N + 1),
+            [&](size_t begin, size_t end) {
+                this->length_range(out.data(), begin, end - begin);
+            }
+        );
+    }
+
+    /**
+     * \brief Computes the length of every vector.
+     * \return The lengths, one per vector.
+     */
+    [[nodiscard]] auto length() const -> Lane {
+        auto result = Lane(this->size(), this->lanes[0].get_allocator());
+        this->length(result);
+        return result;
+    }
+
+    /**
+     * \brief Normalizes every vector in place, vectors with a length of 0
+     * become zero vectors.
+     * \return A reference to this batch after the operation.
+     */
+    auto normalize() -> VectorBatch& {
+        const auto lengths = this->length();
+
+        for (auto& lane : this->lanes) {
+            Kernels::divide_or_zero(
+                lane.data(), lengths.data(), lane.data(), lane.size()
+            );
+        }
+
+        return *this;
+    }
+
+    /**
+     * \brief Normalizes every vector in place, splitting the batch into chunks
+     * run under the given policy. Vectors with a length of 0 become zero
+     * vectors.
+     * \param policy The execution policy, see `Execution`.
+     * \return A reference to this batch after the operation.
+     */
+    template <Execution::Policy P>
+    auto normalize(P&& policy) -> VectorBatch& {
+        auto lengths = Lane(this->size(), this->lanes[0].get_allocator());
+
+        // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        Execution::for_each_chunk(
+            std::forward<P>(policy),
+            this->size(),
+            sizeof(T) * (N * 2 + 1),
+            [&](size_t begin, size_t end) {
+                this->length_range(lengths.data(), begin, end - begin);
+
+                for (auto& lane : this->lanes) {
+                    Kernels::divide_or_zero(
+                        lane.data() + begin,
+                        lengths.data() + begin,
+                        lane.data() + begin,
+                        end - begin
+                    );
+                }
+            }
+        );
+        // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+        return *this;
+    }
+
+    /**
+     * \brief Returns a normalized copy of the batch, vectors with a length of
+     * 0 become zero vectors.
+     * \return The normalized batch.
+     */
+    [[nodiscard]] auto normalized() const -> VectorBatch {
+        auto result = this->copy();
+        result.normalize();
+        return result;
+    }
+
+    /**
+     * \brief Computes the cross product of every pair of vectors.
+     * \param other The batch to calculate the cross products with.
+     * \pre N == 3 && other.size() == size()
+     * \throw std::invalid_argument If the sizes do not match.
+     * \return The cross products, one per vector.
+     */
+    [[nodiscard]] auto cross(const VectorBatch& other) const -> VectorBatch
+        requires(N == 3)
+    {
+        this->check_size(other.size());
+
+        auto result = VectorBatch{this->size(), this->lanes[0].get_allocator()};
+        auto scratch = Lane(this->size(), this->lanes[0].get_allocator());
+
+        // result[i] = lhs[j] * rhs[k] - lhs[k] * rhs[j]
+        constexpr auto axes = std::array<std::array<size_t, 3>, 3>{
+            std::array<size_t, 3>{0, 1, 2},
+            std::array<size_t, 3>{1, 2, 0},
+            std::array<size_t, 3>{2, 0, 1},
+        };
+
+        for (const auto& [i, j, k] : axes) {
+            Kernels::multiply(
+                this->lanes[k].data(),
+                other.lanes[j].data(),
+                scratch.data(),
+                scratch.size()
+            );
+            Kernels::multiply(
+                this->lanes[j].data(),
+                other.lanes[k].data(),
+                result.lanes[i].data(),
+                scratch.size()
+            );
+            Kernels::subtract(
+                result.lanes[i].data(),
+                scratch.data(),
+                result.lanes[i].data(),
+                scratch.size()
+            );
+        }
+
+        return result;
+    }
+
+    /**
+     * \brief Adds the vectors of another batch to the vectors of this batch.
+     * \param other The batch to add to this batch.
+     * \pre other.size() == size()
+     * \throw std::invalid_argument If the sizes do not match.
+     * \return A reference to this batch after the operation.
+     */
+    auto operator+=(const VectorBatch& other) -> VectorBatch& {
+        this->check_size(other.size());
+
+        for (size_t i = 0; i < N; ++i) {
+            Kernels::add(
+                this->lanes[i].data(),
+                other.lanes[i].data(),
+                this->lanes[i].data(),
+                this->size()
+            );
+        }
+
+        return *this;
+    }
+
+    /**
+     * \brief Subtracts the vectors of another batch from the vectors of this
+     * batch.
+     * \param other The batch to subtract from this batch.
+     * \pre other.size() == size()
+     * \throw std::invalid_argument If the sizes do not match.
+     * \return A reference to this batch after the operation.
+     */
+    auto operator-=(const VectorBatch& other) -> VectorBatch& {
+        this->check_size(other.size());
+
+        for (size_t i = 0; i < N; ++i) {
+            Kernels::subtract(
+                this->lanes[i].data(),
+                other.lanes[i].data(),
+                this->lanes[i].data(),
+                this->size()
+            );
+        }
+
+        return *this;
+    }
+
+    /**
+     * \brief Multiplies the vectors of this batch component-wise by the
+     * vectors of another batch.
+     * \param other The batch to multiply this batch by.
+     * \pre other.size() == size()
+     * \throw std::invalid_argument If the sizes do not match.
+     * \return A reference to this batch after the operation.
+     */
+    auto operator*=(const VectorBatch& other) -> VectorBatch& {
+        this->check_size(other.size());
+
+        for (size_t i = 0; i < N; ++i) {
+            Kernels::multiply(
+                this->lanes[i].data(),
+                other.lanes[i].data(),
+                this->lanes[i].data(),
+                this->size()
+            );
+        }
+
+        return *this;
+    }
+
+    /**
+     * \brief Multiplies every vector of this batch by a scalar.
+     * \param scalar The scalar to multiply the vectors by.
+     * \return A reference to this batch after the operation.
+     */
+    auto operator*=(const T& scalar) -> VectorBatch& {
+        for (auto& lane : this->lanes) {
+            Kernels::scale(lane.data(), scalar, lane.data(), lane.size());
+        }
+
+        return *this;
+    }
+
+    /**
+     * \brief Divides every vector of this batch by a scalar.
+     * \param scalar The scalar to divide the vectors by.
+     * \pre scalar != 0
+     * \throw std::runtime_error If the scalar is 0.
+     * \return A reference to this batch after the operation.
+     */
+    auto operator/=(const T& scalar) -> VectorBatch& {
+        if (scalar == 0) {
+            throw std::runtime_error("Cannot divide by zero");
+        }
+
+        for (auto& lane : this->lanes) {
+            for (auto& value : lane) {
+                value /= scalar;
+            }
+        }
+
+        return *this;
+    }
+
+    /**
+     * \brief Returns the element-wise sum of this batch and another batch.
+     * \param other The batch to add to this batch.
+     * \pre other.size() == size()
+     * \throw std::invalid_argument If the sizes do not match.
+     * \return The summed batch.
+     */
+    [[nodiscard]] auto operator+(const VectorBatch& other) const
+        -> VectorBatch {
+        auto result = this->copy();
+        result += other;
+        return result;
+    }
+
+    /**
+     * \brief Returns the element-wise difference of this batch and another
+     * batch.
+     * \param other The batch to subtract from this batch.
+     * \pre other.size() == size()
+     * \throw std::invalid_argument If the sizes do not match.
+     * \return The subtracted batch.
+     */
+    [[nodiscard]] auto operator-(const VectorBatch& other) const
+        -> VectorBatch {
+        auto result = this->copy();
+        result -= other;
+        return result;
+    }
+
+    /**
+     * \brief Returns the component-wise product of this batch and another
+     * batch.
+     * \param other The batch to multiply this batch by.
+     * \pre other.size() == size()
+     * \throw std::invalid_argument If the sizes do not match.
+     * \return The multiplied batch.
+     */
+    [[nodiscard]] auto operator*(const VectorBatch& other) const
+        -> VectorBatch {
+        auto result = this->copy();
+        result *= other;
+        return result;
+    }
+
+    /**
+     * \brief Returns this batch with every vector multiplied by a scalar.
+     * \param scalar The scalar to multiply the vectors by.
+     * \return The scaled batch.
+     */
+    [[nodiscard]] auto operator*(const T& scalar) const -> VectorBatch {
+        auto result = this->copy();
+        result *= scalar;
+        return result;
+    }
+
+    /**
+     * \brief Returns this batch with every vector divided by a scalar.
+     * \param scalar The scalar to divide the vectors by.
+     * \pre scalar != 0
+     * \throw std::runtime_error If the scalar is 0.
+     * \return The divided batch.
+     */
+    [[nodiscard]] auto operator/(const T& scalar) const -> VectorBatch {
+        auto result = this->copy();
+        result /= scalar;
+        return result;
+    }
+
+    /**
+     * \brief Returns this batch with every vector negated.
+     * \return The negated batch.
+     */
+    [[nodiscard]] auto operator-() const -> VectorBatch {
+        return *this * T{-1};
+    }
+
+private:
+    /**
+     * \brief Element-wise lane kernels, forwarding to the SIMD kernels when
+     * they exist for `T` and to plain loops otherwise.
+     */
+    struct Kernels {
+        using Lanes = Simd::LaneKernels<T>;
+
+        // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        static auto add(const T* lhs, const T* rhs, T* out, size_t count)
+            -> void {
+            if constexpr (Lanes::enabled) {
+                Lanes::add(lhs, rhs, out, count);
+            } else {
+                for (size_t i = 0; i < count; ++i) {
+                    out[i] = lhs[i] + rhs[i];
+                }
+            }
+        }
+
+        static auto subtract(const T* lhs, const T* rhs, T* out, size_t count)
+            -> void {
+            if constexpr (Lanes::enabled) {
+                Lanes::subtract(lhs, rhs, out, count);
+            } else {
+                for (size_t i = 0; i < count; ++i) {
+                    out[i] = lhs[i] - rhs[i];
+                }
+            }
+        }
+
+        static auto multiply(const T* lhs, const T* rhs, T* out, size_t count)
+            -> void {
+            if constexpr (Lanes::enabled) {
+                Lanes::multiply(lhs, rhs, out, count);
+            } else {
+                for (size_t i = 0; i < count; ++i) {
+                    out[i] = lhs[i] * rhs[i];
+                }
+            }
+        }
+
+        static auto scale(const T* lhs, T scalar, T* out, size_t count)
+            -> void {
+            if constexpr (Lanes::enabled) {
+                Lanes::scale(lhs, scalar, out, count);
+            } else {
+                for (size_t i = 0; i < count; ++i) {
+                    out[i] = lhs[i] * scalar;
+                }
+            }
+        }
+
+        static auto multiply_add(
+            const T* lhs, const T* rhs, const T* addend, T* out, size_t count
+        ) -> void {
+            if constexpr (Lanes::enabled) {
+                Lanes::multiply_add(lhs, rhs, addend, out, count);
+            } else {
+                for (size_t i = 0; i < count; ++i) {
+                    out[i] = lhs[i] * rhs[i] + addend[i];
+                }
+            }
+        }
+
+        static auto sqrt(const T* value, T* out, size_t count) -> void {
+            if constexpr (Lanes::enabled) {
+                Lanes::sqrt(value, out, count);
+            } else {
+                for (size_t i = 0; i < count; ++i) {
+                    out[i] = std::sqrt(value[i]);
+                }
+            }
+        }
+
+        static auto divide_or_zero(
+            const T* lhs, const T* rhs, T* out, size_t count
+        ) -> void {
+            if constexpr (Lanes::enabled) {
+                Lanes::divide_or_zero(lhs, rhs, out, count);
+            } else {
+                for (size_t i = 0; i < count; ++i) {
+                    out[i] = rhs[i] == T{0} ? T{0} : lhs[i] / rhs[i];
+                }
+            }
+        }
+        // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    };
+
+    /**
+     * \brief Returns a copy of the batch whose lanes use the allocator of this
+     * batch, unlike the copy constructor which follows
+     * `select_on_container_copy_construction` and drops a `pmr` resource.
+     */
+    [[nodiscard]] auto copy() const -> VectorBatch {
+        auto result = VectorBatch{this->get_allocator()};
+        for (size_t i = 0; i < N; ++i) {
+            result.lanes[i].assign(
+                this->lanes[i].begin(), this->lanes[i].end()
+            );
+        }
+        return result;
+    }
+
+    template <size_t... I>
+    [[nodiscard]] static auto make_lanes(
+        const Allocator& allocator, std::index_sequence<I...> /*indices*/
+    ) -> std::array<Lane, N> {
+        return {((void)I, Lane(allocator))...};
+    }
+
+    /**
+     * \brief Returns the component with the given index, without going through
+     * the bounds checked `Vector::operator[]`.
+     */
+    template <size_t I, typename V>
+    [[nodiscard]] static auto component(V& vector) -> decltype(auto) {
+        if constexpr (I == 0) {
+            return vector.x();
+        } else if constexpr (I == 1) {
+            return vector.y();
+        } else if constexpr (I == 2) {
+            return vector.z();
+        } else {
+            return vector.w();
+        }
+    }
+
+    /**
+     * \brief Invokes `function.template operator()<I>()` for every component
+     * index I.
+     */
+    template <typename Function>
+    static auto for_each_component(Function&& function) -> void {
+        [&]<size_t... I>(std::index_sequence<I...>) {
+            (function.template operator()<I>(), ...);
+        }(std::make_index_sequence<N>{});
+    }
+
+    /**
+     * \brief Writes the dot products of the `count` vectors from `begin` to
+     * the same range of `out`.
+     */
+    auto dot_range(
+        const VectorBatch& other, T* out, size_t begin, size_t count
+    ) const -> void {
+        // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        Kernels::multiply(
+            this->lanes[0].data() + begin,
+            other.lanes[0].data() + begin,
+            out + begin,
+            count
+        );
+
+        for (size_t i = 1; i < N; ++i) {
+            Kernels::multiply_add(
+                this->lanes[i].data() + begin,
+                other.lanes[i].data() + begin,
+                out + begin,
+                out + begin,
+                count
+            );
+        }
+        // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    }
+
+    /**
+     * \brief Writes the lengths of the `count` vectors from `begin` to the same
+     * range of `out`.
+     */
+    auto length_range(T* out, size_t begin, size_t count) const -> void {
+        this->dot_range(*this, out, begin, count);
+
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        Kernels::sqrt(out + begin, out + begin, count);
+    }
+
+    auto check_size(size_t size) const -> void {
+        if (size != this->size()) {
+            throw std::invalid_argument("Batch sizes do not match");
+        }
+    }
+
+    /// One contiguous lane per component.
+    std::array<Lane, N> lanes = {};
+};
+
+using VectorBatch2 = VectorBatch<double, 2>;
+using VectorBatch2f = VectorBatch<float, 2>;
+using VectorBatch3 = VectorBatch<double, 3>;
+using VectorBatch3f = VectorBatch<float, 3>;
+using VectorBatch4 = VectorBatch<double, 4>;
+using VectorBatch4f = VectorBatch<float, 4>;
+
+namespace pmr {
+
+/**
+ * \brief A `VectorBatch` whose lanes allocate from a memory resource, e.g. an
+ * `ArenaResource` or a `PoolResource`.
+ *
+ * The batches returned by the operators and methods allocate from the
+ * resource of their left operand. As with the `std::pmr` containers, the copy
+ * constructor uses the default resource.
+ */
+template <typename T, size_t N>
+using VectorBatch =
+    Maths::VectorBatch<T, N, std::pmr::polymorphic_allocator<T>>;
+
+}  // namespace pmr
+
+}  // namespace Luminol::Maths
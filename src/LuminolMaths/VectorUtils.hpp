@@ -1,5 +1,7 @@
 #pragma once
 
+#include <tuple>
+
 #include <LuminolMaths/Vector.hpp>
 
 namespace Luminol::Maths::VectorUtils {
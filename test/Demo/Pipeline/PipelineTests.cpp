@@ -0,0 +1,180 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <functional>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <Demo/Pipeline.hpp>
+
+using namespace Luminol::Demo;
+
+namespace {
+
+/// The number of chunks streamed through the pipeline, many times the number
+/// of buffers so every buffer is reused.
+constexpr auto stream_length = 200;
+
+struct Chunk {
+    int index = -1;
+    int value = 0;
+};
+
+/**
+ * \brief Reads `stream_length` chunks, numbered in order, and throws when
+ * reading the chunk `throw_at`.
+ */
+struct Reader {
+    int next = 0;
+    int throw_at = -1;
+
+    auto operator()(Chunk& chunk) -> bool {
+        if (this->next == this->throw_at) {
+            throw std::runtime_error("read");
+        }
+        if (this->next == stream_length) {
+            return false;
+        }
+
+        chunk.index = this->next;
+        chunk.value = this->next;
+        ++this->next;
+
+        // Lets the other stages run between chunks, varying the interleaving.
+        if (this->next % 7 == 0) {
+            std::this_thread::yield();
+        }
+        return true;
+    }
+};
+
+/// Runs the pipeline over 3 buffers, throwing from the stage named `stage` at
+/// chunk `throw_at`, and returns the message of the exception it rethrows.
+[[nodiscard]] auto run_throwing(const std::string& stage, int throw_at)
+    -> std::string {
+    auto chunks = std::vector<Chunk>(3);
+    auto reader = Reader{};
+    if (stage == "read") {
+        reader.throw_at = throw_at;
+    }
+
+    try {
+        run_pipeline(
+            chunks,
+            std::ref(reader),
+            [&](Chunk& chunk) {
+                if (stage == "compute" && chunk.index == throw_at) {
+                    throw std::runtime_error("compute");
+                }
+            },
+            [&](const Chunk& chunk) {
+                if (stage == "write" && chunk.index == throw_at) {
+                    throw std::runtime_error("write");
+                }
+            }
+        );
+    } catch (const std::runtime_error& error) {
+        return error.what();
+    }
+    return "";
+}
+
+}  // namespace
+
+TEST(PipelineTests, ChunkOrder) {
+    for (const auto buffer_count : {1, 2, 3, 8}) {
+        auto chunks = std::vector<Chunk>(static_cast<size_t>(buffer_count));
+        auto written = std::vector<Chunk>{};
+
+        run_pipeline(
+            chunks,
+            Reader{},
+            [](Chunk& chunk) { chunk.value *= 3; },
+            [&](const Chunk& chunk) { written.push_back(chunk); }
+        );
+
+        ASSERT_EQ(written.size(), size_t{stream_length})
+            << buffer_count << " buffers";
+        for (int i = 0; i < stream_length; ++i) {
+            const auto& chunk = written[static_cast<size_t>(i)];
+            EXPECT_EQ(chunk.index, i) << buffer_count << " buffers";
+            EXPECT_EQ(chunk.value, i * 3) << buffer_count << " buffers";
+        }
+    }
+}
+
+TEST(PipelineTests, EmptyStream) {
+    auto chunks = std::vector<Chunk>(3);
+    auto computed = 0;
+    auto written = 0;
+
+    run_pipeline(
+        chunks,
+        [](Chunk&) { return false; },
+        [&](Chunk&) { ++computed; },
+        [&](const Chunk&) { ++written; }
+    );
+
+    EXPECT_EQ(computed, 0);
+    EXPECT_EQ(written, 0);
+}
+
+TEST(PipelineTests, NoChunks) {
+    auto chunks = std::vector<Chunk>{};
+    EXPECT_THROW(
+        run_pipeline(chunks, Reader{}, [](Chunk&) {}, [](const Chunk&) {}),
+        std::invalid_argument
+    );
+}
+
+TEST(PipelineTests, Exceptions) {
+    // At the first chunk, while the other buffers are still free, and in the
+    // middle of the stream, while every buffer is in flight.
+    for (const auto throw_at : {0, 1, 100}) {
+        for (const auto* stage : {"read", "compute", "write"}) {
+            EXPECT_EQ(run_throwing(stage, throw_at), stage)
+                << "Throwing at chunk " << throw_at;
+        }
+    }
+}
+
+TEST(PipelineTests, StagesStopAfterAnException) {
+    auto chunks = std::vector<Chunk>(3);
+    auto computed = std::atomic<int>{0};
+    auto written = std::atomic<int>{0};
+
+    EXPECT_THROW(
+        run_pipeline(
+            chunks,
+            Reader{.throw_at = 50},
+            [&](Chunk&) { ++computed; },
+            [&](const Chunk&) { ++written; }
+        ),
+        std::runtime_error
+    );
+
+    // Only the chunks read before the exception reach the other stages.
+    EXPECT_LE(computed.load(), 50);
+    EXPECT_LE(written.load(), computed.load());
+
+    // Every stage throwing at once still rethrows one of the exceptions.
+    EXPECT_THROW(
+        run_pipeline(
+            chunks,
+            Reader{.throw_at = 20},
+            [](Chunk& chunk) {
+                if (chunk.index == 10) {
+                    throw std::runtime_error("compute");
+                }
+            },
+            [](const Chunk& chunk) {
+                if (chunk.index == 5) {
+                    throw std::runtime_error("write");
+                }
+            }
+        ),
+        std::runtime_error
+    );
+}
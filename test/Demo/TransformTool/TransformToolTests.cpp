@@ -0,0 +1,252 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <iterator>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <vector>
+
+#include <Demo/TransformTool.hpp>
+#include <LuminolMaths/ArrayFile.hpp>
+#include <LuminolMaths/Transform.hpp>
+
+using namespace Luminol::Maths;
+namespace TransformTool = Luminol::Demo::TransformTool;
+
+namespace {
+
+constexpr auto epsilon = 1e-5F;
+
+/**
+ * \brief A file in the temporary directory, removed when the test ends.
+ */
+class TemporaryFile {
+public:
+    explicit TemporaryFile(const std::string& name)
+        : path{
+              std::filesystem::temp_directory_path() /
+              ("LuminolMaths.TransformTool." + name)
+          } {}
+
+    TemporaryFile(const TemporaryFile&) = delete;
+    TemporaryFile(TemporaryFile&&) = delete;
+
+    ~TemporaryFile() {
+        auto error = std::error_code{};
+        std::filesystem::remove(this->path, error);
+    }
+
+    auto operator=(const TemporaryFile&) -> TemporaryFile& = delete;
+    auto operator=(TemporaryFile&&) -> TemporaryFile& = delete;
+
+    [[nodiscard]] auto get() const -> const std::filesystem::path& {
+        return this->path;
+    }
+
+private:
+    std::filesystem::path path;
+};
+
+[[nodiscard]] auto parse(std::vector<const char*> arguments)
+    -> TransformTool::Options {
+    arguments.insert(arguments.begin(), "luminol-transform");
+    return TransformTool::parse_options(arguments);
+}
+
+[[nodiscard]] auto run(
+    const std::filesystem::path& input,
+    const std::filesystem::path& output,
+    size_t chunk_size
+) -> uint64_t {
+    auto options = TransformTool::Options{};
+    options.input = input;
+    options.output = output;
+    options.chunk_size = chunk_size;
+    return TransformTool::run(options);
+}
+
+auto write_text(const std::filesystem::path& path, const std::string& text)
+    -> void {
+    auto stream = std::ofstream{path, std::ios::binary};
+    stream << text;
+}
+
+[[nodiscard]] auto read_text(const std::filesystem::path& path)
+    -> std::string {
+    auto stream = std::ifstream{path, std::ios::binary};
+    return std::string{
+        std::istreambuf_iterator<char>{stream}, std::istreambuf_iterator<char>{}
+    };
+}
+
+auto expect_near(
+    const Vector3f& actual, const Vector3f& expected, const std::string& message
+) -> void {
+    for (size_t i = 0; i < 3; ++i) {
+        EXPECT_NEAR(actual[i], expected[i], epsilon) << message;
+    }
+}
+
+}  // namespace
+
+TEST(TransformToolTests, ParseOptionsComposesInOrder) {
+    const auto options = parse(
+        {"--translate", "1,0,0", "--scale", "2", "--rotate-z", "90", "in.bin",
+         "out.csv"}
+    );
+
+    EXPECT_EQ(options.input, std::filesystem::path{"in.bin"});
+    EXPECT_EQ(options.output, std::filesystem::path{"out.csv"});
+    EXPECT_EQ(options.chunk_size, TransformTool::default_chunk_size);
+    EXPECT_FALSE(options.help);
+
+    // Translated first, then scaled, then rotated: (1, 1, 1) becomes
+    // (2, 1, 1), then (4, 2, 2), then (-2, 4, 2).
+    const auto point = Vector4f{1, 1, 1, 1} * options.matrix;
+    expect_near(
+        Vector3f{point.x(), point.y(), point.z()}, {-2, 4, 2}, "Chained point"
+    );
+
+    // The same transformations in the other order give a different point.
+    const auto reversed = parse(
+        {"--rotate-z", "90", "--scale", "2", "--translate", "1,0,0", "in.bin",
+         "out.bin"}
+    );
+    const auto other = Vector4f{1, 1, 1, 1} * reversed.matrix;
+    expect_near(
+        Vector3f{other.x(), other.y(), other.z()}, {-1, 2, 2}, "Reversed chain"
+    );
+
+    const auto scaled = parse({"--scale", "1,2,3", "a", "b"});
+    EXPECT_EQ(scaled.matrix, Transform::scale_4x4(Vector3f{1, 2, 3}));
+}
+
+TEST(TransformToolTests, ParseOptionsErrors) {
+    EXPECT_TRUE(parse({"--help"}).help);
+    EXPECT_EQ(parse({"--chunk-size", "16", "a", "b"}).chunk_size, size_t{16});
+
+    EXPECT_THROW((void)parse({"a"}), std::invalid_argument);
+    EXPECT_THROW((void)parse({"a", "b", "c"}), std::invalid_argument);
+    EXPECT_THROW((void)parse({"a", "b", "--scale"}), std::invalid_argument);
+    EXPECT_THROW(
+        (void)parse({"--chunk-size", "0", "a", "b"}), std::invalid_argument
+    );
+    EXPECT_THROW(
+        (void)parse({"--translate", "1,2", "a", "b"}), std::invalid_argument
+    );
+    EXPECT_THROW(
+        (void)parse({"--rotate-x", "ninety", "a", "b"}), std::invalid_argument
+    );
+    EXPECT_THROW((void)parse({"--skew", "1", "a", "b"}), std::invalid_argument);
+}
+
+TEST(TransformToolTests, AffineAndProjectiveChunks) {
+    const auto points = std::vector<Vector3f>{
+        {1, 2, 3}, {-4, 0.5F, 10}, {0, 0, 1}
+    };
+
+    auto chunk = TransformTool::Chunk{};
+    chunk.points = points;
+    chunk.points.resize(8);
+    chunk.homogeneous.resize(8);
+    chunk.size = points.size();
+
+    const auto affine = Transform::translate_4x4(Vector3f{1, -1, 2}) *
+                        Transform::scale_4x4(Vector3f{2, 2, 2});
+    EXPECT_TRUE(TransformTool::is_affine(affine));
+
+    TransformTool::transform_chunk(affine, true, chunk);
+    for (size_t i = 0; i < points.size(); ++i) {
+        const auto expected = Vector4f{
+            points[i].x(), points[i].y(), points[i].z(), 1
+        } * affine;
+        expect_near(
+            chunk.points[i],
+            {expected.x(), expected.y(), expected.z()},
+            std::format("Affine point {}", i)
+        );
+    }
+
+    const auto projective =
+        Transform::left_handed_perspective_projection_matrix(
+            Transform::PerspectiveMatrixParams<float>{
+                .fov = Luminol::Units::Degrees_f{90},
+                .aspect_ratio = 1.5F,
+                .near_plane = 0.5F,
+                .far_plane = 100,
+            }
+        );
+    EXPECT_FALSE(TransformTool::is_affine(projective));
+
+    std::copy(points.begin(), points.end(), chunk.points.begin());
+    TransformTool::transform_chunk(projective, false, chunk);
+    for (size_t i = 0; i < points.size(); ++i) {
+        const auto clip = Vector4f{
+            points[i].x(), points[i].y(), points[i].z(), 1
+        } * projective;
+        expect_near(
+            chunk.points[i],
+            {clip.x() / clip.w(), clip.y() / clip.w(), clip.z() / clip.w()},
+            std::format("Projected point {}", i)
+        );
+    }
+}
+
+TEST(TransformToolTests, CsvArrayFileRoundTrip) {
+    const auto csv = TemporaryFile{"Input.csv"};
+    const auto array_file = TemporaryFile{"Points.bin"};
+    const auto round_trip = TemporaryFile{"Output.csv"};
+
+    // CRLF and LF line endings, a blank line and no final line ending.
+    write_text(csv.get(), "1,2,3\r\n-0.5,4.25,1e3\r\n\r\n0,0,0\n7,-8,9.5");
+    const auto expected = std::vector<Vector3f>{
+        {1, 2, 3}, {-0.5F, 4.25F, 1000}, {0, 0, 0}, {7, -8, 9.5F}
+    };
+
+    // A chunk size below the number of points streams several chunks.
+    EXPECT_EQ(run(csv.get(), array_file.get(), 3), uint64_t{4});
+    {
+        const auto file = MappedArrayFile<Vector3f>{array_file.get()};
+        ASSERT_EQ(file.elements().size(), expected.size());
+        for (size_t i = 0; i < expected.size(); ++i) {
+            EXPECT_EQ(file.elements()[i], expected[i])
+                << std::format("Point {}", i);
+        }
+    }
+
+    EXPECT_EQ(run(array_file.get(), round_trip.get(), 2), uint64_t{4});
+    EXPECT_EQ(
+        read_text(round_trip.get()), "1,2,3\n-0.5,4.25,1000\n0,0,0\n7,-8,9.5\n"
+    );
+}
+
+TEST(TransformToolTests, EmptyInput) {
+    const auto csv = TemporaryFile{"Empty.csv"};
+    const auto array_file = TemporaryFile{"Empty.bin"};
+    const auto round_trip = TemporaryFile{"Empty.Output.csv"};
+
+    write_text(csv.get(), "");
+    EXPECT_EQ(run(csv.get(), array_file.get(), 4), uint64_t{0});
+    EXPECT_TRUE(MappedArrayFile<Vector3f>{array_file.get()}.elements().empty());
+
+    EXPECT_EQ(run(array_file.get(), round_trip.get(), 4), uint64_t{0});
+    EXPECT_EQ(read_text(round_trip.get()), "");
+}
+
+TEST(TransformToolTests, InvalidInput) {
+    const auto csv = TemporaryFile{"Invalid.csv"};
+    const auto output = TemporaryFile{"Invalid.bin"};
+
+    // The error is thrown on the reader thread and rethrown by the pipeline.
+    write_text(csv.get(), "1,2,3\n4,five,6\n");
+    EXPECT_THROW((void)run(csv.get(), output.get(), 1), std::runtime_error);
+
+    const auto missing = TemporaryFile{"Missing.csv"};
+    EXPECT_THROW((void)run(missing.get(), output.get(), 1), std::runtime_error);
+}
@@ -0,0 +1,234 @@
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstdint>
+#include <format>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+#include <TestUtils.hpp>
+#include <LuminolMaths/AABB.hpp>
+#include <LuminolMaths/Transform.hpp>
+#include <LuminolMaths/TransformTrs.hpp>
+
+using namespace Luminol::Maths;
+
+namespace {
+
+template <std::floating_point T>
+struct AABBTests : public ::testing::Test {
+    using Radians = Luminol::Units::Angle<T, Luminol::Units::Radian>;
+
+    /// Not a multiple of 64, so the last word of the mask is partial.
+    constexpr static auto count = size_t{100};
+
+    constexpr static auto epsilon = T{1e-4};
+
+    [[nodiscard]] static auto make_box(size_t index) -> AABB<T> {
+        const auto center = Vector<T, 3>{
+            static_cast<T>(index * 7 % 23) - T{11},
+            static_cast<T>(index * 5 % 17) - T{8},
+            static_cast<T>(index * 3 % 13) - T{6},
+        };
+        const auto extent = Vector<T, 3>{
+            static_cast<T>(index % 3) + T{0.5},
+            static_cast<T>(index % 4) + T{0.25},
+            static_cast<T>(index % 5) + T{1},
+        };
+        return AABB<T>::from_center_extent(center, extent);
+    }
+
+    [[nodiscard]] static auto make_transform() -> Matrix<T, 4, 4> {
+        return Transform::trs<Precision::Exact, T>(
+            {3, -2, 5},
+            {Radians{T{0.4}}, Radians{T{-1.1}}, Radians{T{2.3}}},
+            {2, 0.5, 1.5}
+        );
+    }
+
+    [[nodiscard]] static auto corners(const AABB<T>& box)
+        -> std::array<Vector<T, 3>, 8> {
+        auto result = std::array<Vector<T, 3>, 8>{};
+        for (size_t i = 0; i < result.size(); ++i) {
+            result[i] = {
+                (i & 1) != 0 ? box.max().x() : box.min().x(),
+                (i & 2) != 0 ? box.max().y() : box.min().y(),
+                (i & 4) != 0 ? box.max().z() : box.min().z(),
+            };
+        }
+        return result;
+    }
+
+    static auto expect_vector_near(
+        const Vector<T, 3>& value,
+        const Vector<T, 3>& expected,
+        const std::string& message
+    ) -> void {
+        for (size_t i = 0; i < 3; ++i) {
+            EXPECT_NEAR(value[i], expected[i], epsilon)
+                << std::format("{}, component {}", message, i);
+        }
+    }
+};
+
+using AABBStorageTypes = ::testing::Types<float, double>;
+
+TYPED_TEST_SUITE(AABBTests, AABBStorageTypes);
+
+}  // namespace
+
+TYPED_TEST(AABBTests, Empty) {
+    const auto empty = AABB<TypeParam>{};
+    const auto box = AABB<TypeParam>{{-1, -2, -3}, {1, 2, 3}};
+
+    EXPECT_TRUE(empty.is_empty());
+    EXPECT_FALSE(box.is_empty());
+    EXPECT_FALSE(empty.contains(Vector<TypeParam, 3>{}));
+    EXPECT_FALSE(empty.overlaps(box));
+    EXPECT_FALSE(box.overlaps(empty));
+    EXPECT_TRUE(box.contains(empty));
+    EXPECT_EQ(empty.merged(box), box);
+    EXPECT_EQ(box.merged(empty), box);
+    EXPECT_TRUE(empty.transformed(TestFixture::make_transform()).is_empty());
+    EXPECT_EQ(empty.surface_area(), TypeParam{0});
+}
+
+TYPED_TEST(AABBTests, Properties) {
+    const auto box = AABB<TypeParam>{{-1, 0, 2}, {3, 2, 3}};
+
+    EXPECT_EQ(box.center(), (Vector<TypeParam, 3>{1, 1, 2.5}));
+    EXPECT_EQ(box.extent(), (Vector<TypeParam, 3>{2, 1, 0.5}));
+    EXPECT_EQ(box.surface_area(), TypeParam{2 * (4 * 2 + 2 * 1 + 1 * 4)});
+    EXPECT_EQ(
+        AABB<TypeParam>::from_center_extent(box.center(), box.extent()), box
+    );
+}
+
+TYPED_TEST(AABBTests, ContainsAndOverlaps) {
+    const auto box = AABB<TypeParam>{{0, 0, 0}, {2, 2, 2}};
+
+    EXPECT_TRUE(box.contains(Vector<TypeParam, 3>{1, 1, 1}));
+    EXPECT_TRUE(box.contains(Vector<TypeParam, 3>{2, 0, 2}));
+    EXPECT_FALSE(box.contains(Vector<TypeParam, 3>{1, 2.5, 1}));
+
+    EXPECT_TRUE(box.contains(AABB<TypeParam>{{0.5, 0.5, 0.5}, {2, 1, 1}}));
+    EXPECT_FALSE(box.contains(AABB<TypeParam>{{0.5, 0.5, 0.5}, {3, 1, 1}}));
+
+    EXPECT_TRUE(box.overlaps(AABB<TypeParam>{{1, 1, 1}, {3, 3, 3}}));
+    EXPECT_TRUE(box.overlaps(AABB<TypeParam>{{2, 2, 2}, {3, 3, 3}}));
+    EXPECT_FALSE(box.overlaps(AABB<TypeParam>{{1, 1, 2.5}, {3, 3, 3}}));
+}
+
+TYPED_TEST(AABBTests, FromPointsAndMerge) {
+    const auto points = std::vector<Vector<TypeParam, 3>>{
+        {1, -2, 0}, {-3, 4, 1}, {2, 0, -5}
+    };
+
+    const auto box = AABB<TypeParam>::from_points(points);
+    EXPECT_EQ(box, (AABB<TypeParam>{{-3, -2, -5}, {2, 4, 1}}));
+    EXPECT_TRUE(AABB<TypeParam>::from_points({}).is_empty());
+
+    auto boxes = std::vector<AABB<TypeParam>>{};
+    auto expected = AABB<TypeParam>{};
+    for (size_t i = 0; i < TestFixture::count; ++i) {
+        boxes.push_back(TestFixture::make_box(i));
+        expected = expected.merged(boxes.back());
+    }
+
+    const auto merged = merge(boxes);
+    EXPECT_EQ(merged, expected);
+    for (const auto& other : boxes) {
+        EXPECT_TRUE(merged.contains(other));
+    }
+    const auto none = std::span<const AABB<TypeParam>>{};
+    EXPECT_TRUE(merge(none).is_empty());
+}
+
+TYPED_TEST(AABBTests, Transformed) {
+    const auto matrix = TestFixture::make_transform();
+
+    for (size_t i = 0; i < 10; ++i) {
+        const auto box = TestFixture::make_box(i);
+
+        // The tightest box around the eight transformed corners.
+        auto expected = AABB<TypeParam>{};
+        for (const auto& corner : TestFixture::corners(box)) {
+            const auto point = Vector<TypeParam, 4>{
+                corner.x(), corner.y(), corner.z(), TypeParam{1}
+            } * matrix;
+            expected = expected.merged(
+                Vector<TypeParam, 3>{point.x(), point.y(), point.z()}
+            );
+        }
+
+        const auto transformed = box.transformed(matrix);
+        const auto message = std::format("Box {} transformed", i);
+        TestFixture::expect_vector_near(
+            transformed.min(), expected.min(), message
+        );
+        TestFixture::expect_vector_near(
+            transformed.max(), expected.max(), message
+        );
+    }
+}
+
+TYPED_TEST(AABBTests, Batches) {
+    const auto matrix = TestFixture::make_transform();
+    const auto probe = AABB<TypeParam>{{-4, -3, -2}, {5, 1, 3}};
+
+    auto boxes = std::vector<AABB<TypeParam>>{};
+    auto points = std::vector<Vector<TypeParam, 3>>{};
+    for (size_t i = 0; i < TestFixture::count; ++i) {
+        boxes.push_back(TestFixture::make_box(i));
+        points.push_back(boxes.back().center());
+    }
+
+    auto transformed = std::vector<AABB<TypeParam>>(TestFixture::count);
+    transform<TypeParam>(matrix, boxes, transformed);
+
+    auto inside =
+        std::vector<uint64_t>(BitMask::word_count(TestFixture::count));
+    contains<TypeParam>(probe, points, inside);
+
+    auto overlapping =
+        std::vector<uint64_t>(BitMask::word_count(TestFixture::count));
+    overlaps<TypeParam>(probe, boxes, overlapping);
+
+    auto inside_count = size_t{0};
+    auto overlapping_count = size_t{0};
+    for (size_t i = 0; i < TestFixture::count; ++i) {
+        EXPECT_EQ(transformed[i], boxes[i].transformed(matrix));
+        EXPECT_EQ(BitMask::test(inside, i), probe.contains(points[i]))
+            << std::format("Point {} is misclassified", i);
+        EXPECT_EQ(BitMask::test(overlapping, i), probe.overlaps(boxes[i]))
+            << std::format("Box {} is misclassified", i);
+
+        inside_count += probe.contains(points[i]) ? 1 : 0;
+        overlapping_count += probe.overlaps(boxes[i]) ? 1 : 0;
+    }
+
+    EXPECT_GT(inside_count, size_t{0});
+    EXPECT_LT(inside_count, TestFixture::count);
+    EXPECT_GT(overlapping_count, inside_count);
+    EXPECT_LT(overlapping_count, TestFixture::count);
+}
+
+TYPED_TEST(AABBTests, SizeMismatch) {
+    const auto matrix = TestFixture::make_transform();
+    const auto boxes = std::vector<AABB<TypeParam>>(65);
+    const auto points = std::vector<Vector<TypeParam, 3>>(65);
+
+    auto out = std::vector<AABB<TypeParam>>(64);
+    auto mask = std::vector<uint64_t>(1);
+
+    EXPECT_THROW(
+        transform<TypeParam>(matrix, boxes, out), std::invalid_argument
+    );
+    EXPECT_THROW(
+        contains<TypeParam>(boxes[0], points, mask), std::invalid_argument
+    );
+    EXPECT_THROW(
+        overlaps<TypeParam>(boxes[0], boxes, mask), std::invalid_argument
+    );
+}
@@ -0,0 +1,196 @@
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <LuminolMaths/ArrayFile.hpp>
+
+using namespace Luminol::Maths;
+
+namespace {
+
+static_assert(ArrayFileElement<Vector3f>);
+static_assert(ArrayFileElement<Vector<double, 4>>);
+static_assert(ArrayFileElement<Matrix4x4f>);
+static_assert(!ArrayFileElement<Vector<int32_t, 3>>);
+
+/**
+ * \brief A file in the temporary directory, removed when the test ends.
+ */
+class TemporaryFile {
+public:
+    explicit TemporaryFile(const std::string& name)
+        : path{
+              std::filesystem::temp_directory_path() /
+              ("LuminolMaths." + name + ".bin")
+          } {}
+
+    TemporaryFile(const TemporaryFile&) = delete;
+    TemporaryFile(TemporaryFile&&) = delete;
+
+    ~TemporaryFile() {
+        auto error = std::error_code{};
+        std::filesystem::remove(this->path, error);
+    }
+
+    auto operator=(const TemporaryFile&) -> TemporaryFile& = delete;
+    auto operator=(TemporaryFile&&) -> TemporaryFile& = delete;
+
+    [[nodiscard]] auto get() const -> const std::filesystem::path& {
+        return this->path;
+    }
+
+private:
+    std::filesystem::path path;
+};
+
+[[nodiscard]] auto make_vectors(size_t count) -> std::vector<Vector3f> {
+    auto vectors = std::vector<Vector3f>{};
+    for (size_t i = 0; i < count; ++i) {
+        const auto value = static_cast<float>(i);
+        vectors.emplace_back(value, -value, value * 0.5F);
+    }
+    return vectors;
+}
+
+/**
+ * \brief Overwrites the header of the array file at `path` with the one
+ * returned by `change`.
+ */
+template <typename F>
+auto patch_header(const std::filesystem::path& path, F change) -> void {
+    auto file = std::fstream{
+        path, std::ios::binary | std::ios::in | std::ios::out
+    };
+    auto header = ArrayFileHeader{};
+    file.read(reinterpret_cast<char*>(&header), sizeof(header));
+
+    header = change(header);
+    file.seekp(0);
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+}
+
+}  // namespace
+
+TEST(ArrayFile, RoundTrip) {
+    const auto file = TemporaryFile{"RoundTrip"};
+    const auto vectors = make_vectors(1000);
+
+    write_array_file(file.get(), std::span<const Vector3f>{vectors});
+    EXPECT_EQ(
+        std::filesystem::file_size(file.get()),
+        sizeof(ArrayFileHeader) + vectors.size() * sizeof(Vector3f)
+    );
+
+    auto mapped = MappedArrayFile<Vector3f>{file.get()};
+    ASSERT_EQ(mapped.size(), vectors.size());
+    EXPECT_EQ(mapped.get_header().version, ArrayFileHeader::current_version);
+    EXPECT_EQ(mapped.get_header().rows, 3U);
+
+    // The elements are used in place, at the aligned data offset.
+    const auto elements = mapped.elements();
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(elements.data()) % 64, 0U);
+    for (size_t i = 0; i < vectors.size(); ++i) {
+        EXPECT_EQ(elements[i], vectors[i]);
+    }
+
+    // Moving the mapping keeps the elements where they are.
+    const auto moved = MappedArrayFile<Vector3f>{std::move(mapped)};
+    EXPECT_EQ(moved.elements().data(), elements.data());
+}
+
+TEST(ArrayFile, StreamingWriter) {
+    const auto file = TemporaryFile{"StreamingWriter"};
+    const auto matrix = Matrix4x4f{std::array{
+        std::array{1.0f, 2.0f, 3.0f, 4.0f},
+        std::array{5.0f, 6.0f, 7.0f, 8.0f},
+        std::array{9.0f, 10.0f, 11.0f, 12.0f},
+        std::array{13.0f, 14.0f, 15.0f, 16.0f},
+    }};
+
+    {
+        auto writer = ArrayFileWriter<Matrix4x4f>{file.get()};
+        for (size_t i = 0; i < 10; ++i) {
+            writer.write(matrix * static_cast<float>(i));
+        }
+        const auto more = std::vector<Matrix4x4f>(5, matrix);
+        writer.write(std::span<const Matrix4x4f>{more});
+        EXPECT_EQ(writer.size(), 15U);
+
+        // The destructor writes the count without an explicit close.
+    }
+
+    const auto mapped = MappedArrayFile<Matrix4x4f>{file.get()};
+    ASSERT_EQ(mapped.size(), 15U);
+    EXPECT_EQ(mapped.elements()[3], matrix * 3.0F);
+    EXPECT_EQ(mapped.elements()[14], matrix);
+
+    auto writer = ArrayFileWriter<Matrix4x4f>{file.get()};
+    writer.close();
+    EXPECT_THROW(writer.write(matrix), std::runtime_error);
+    EXPECT_TRUE(MappedArrayFile<Matrix4x4f>{file.get()}.empty());
+}
+
+TEST(ArrayFile, Validation) {
+    const auto file = TemporaryFile{"Validation"};
+    const auto vectors = make_vectors(10);
+    const auto write = [&] {
+        write_array_file(file.get(), std::span<const Vector3f>{vectors});
+    };
+
+    EXPECT_THROW(MappedArrayFile<Vector3f>{file.get()}, std::runtime_error);
+
+    // Not an array file at all.
+    {
+        auto stream = std::ofstream{file.get(), std::ios::binary};
+        stream << std::string(100, 'x');
+    }
+    EXPECT_THROW(MappedArrayFile<Vector3f>{file.get()}, std::runtime_error);
+
+    // Another element type.
+    write();
+    EXPECT_THROW(MappedArrayFile<Vector4f>{file.get()}, std::runtime_error);
+    EXPECT_THROW(
+        (MappedArrayFile<Vector<double, 3>>{file.get()}), std::runtime_error
+    );
+    EXPECT_THROW(
+        (MappedArrayFile<Matrix<float, 3, 1>>{file.get()}), std::runtime_error
+    );
+
+    // Written on a machine of the other byte order.
+    patch_header(file.get(), [](ArrayFileHeader header) {
+        header.byte_order = 0x04030201;
+        return header;
+    });
+    EXPECT_THROW(MappedArrayFile<Vector3f>{file.get()}, std::runtime_error);
+
+    // Written by a later version.
+    write();
+    patch_header(file.get(), [](ArrayFileHeader header) {
+        ++header.version;
+        return header;
+    });
+    EXPECT_THROW(MappedArrayFile<Vector3f>{file.get()}, std::runtime_error);
+
+    // Announcing more elements than the file holds.
+    write();
+    std::filesystem::resize_file(
+        file.get(), std::filesystem::file_size(file.get()) - 1
+    );
+    EXPECT_THROW(MappedArrayFile<Vector3f>{file.get()}, std::runtime_error);
+
+    write();
+    patch_header(file.get(), [](ArrayFileHeader header) {
+        header.count = ~uint64_t{0};
+        return header;
+    });
+    EXPECT_THROW(MappedArrayFile<Vector3f>{file.get()}, std::runtime_error);
+
+    write();
+    EXPECT_EQ(MappedArrayFile<Vector3f>{file.get()}.size(), vectors.size());
+}
@@ -0,0 +1,346 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <format>
+#include <random>
+#include <span>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include <TestUtils.hpp>
+#include <LuminolMaths/BVH.hpp>
+
+using namespace Luminol::Maths;
+
+namespace {
+
+template <std::floating_point T>
+struct BVHTests : public ::testing::Test {
+    constexpr static auto count = size_t{2000};
+
+    /// Above the size from which subtrees are built on separate threads.
+    constexpr static auto parallel_count = size_t{40000};
+
+    [[nodiscard]] static auto random_boxes(size_t size, uint32_t seed)
+        -> std::vector<AABB<T>> {
+        auto generator = std::mt19937{seed};
+        auto position = std::uniform_real_distribution<T>{-50, 50};
+        auto extent = std::uniform_real_distribution<T>{0, 2};
+
+        auto boxes = std::vector<AABB<T>>{};
+        for (size_t i = 0; i < size; ++i) {
+            const auto center = Vector<T, 3>{
+                position(generator), position(generator), position(generator)
+            };
+            boxes.push_back(AABB<T>::from_center_extent(
+                center,
+                {extent(generator), extent(generator), extent(generator)}
+            ));
+        }
+        return boxes;
+    }
+
+    [[nodiscard]] static auto probe_boxes() -> std::vector<AABB<T>> {
+        return {
+            AABB<T>{{-10, -10, -10}, {10, 10, 10}},
+            AABB<T>{{20, -50, -5}, {25, 50, 5}},
+            AABB<T>{{-60, -60, -60}, {60, 60, 60}},
+            AABB<T>{{100, 100, 100}, {101, 101, 101}},
+            AABB<T>{{0, 0, 0}, {0, 0, 0}},
+        };
+    }
+
+    [[nodiscard]] static auto sorted(std::vector<uint32_t> indices)
+        -> std::vector<uint32_t> {
+        std::ranges::sort(indices);
+        return indices;
+    }
+
+    [[nodiscard]] static auto overlapping(
+        const std::vector<AABB<T>>& boxes, const AABB<T>& probe
+    ) -> std::vector<uint32_t> {
+        auto result = std::vector<uint32_t>{};
+        for (size_t i = 0; i < boxes.size(); ++i) {
+            if (boxes[i].overlaps(probe)) {
+                result.push_back(static_cast<uint32_t>(i));
+            }
+        }
+        return result;
+    }
+
+    /// The slab test, computed the same way as the tree does.
+    [[nodiscard]] static auto crossed(
+        const std::vector<AABB<T>>& boxes,
+        const Vector<T, 3>& origin,
+        const Vector<T, 3>& direction,
+        T max_distance
+    ) -> std::vector<uint32_t> {
+        const auto lane_min = [](T lhs, T rhs) {
+            return lhs < rhs ? lhs : rhs;
+        };
+        const auto lane_max = [](T lhs, T rhs) {
+            return lhs > rhs ? lhs : rhs;
+        };
+
+        auto result = std::vector<uint32_t>{};
+        for (size_t i = 0; i < boxes.size(); ++i) {
+            auto near = T{0};
+            auto far = max_distance;
+            for (size_t axis = 0; axis < 3; ++axis) {
+                const auto inverse = T{1} / direction[axis];
+                const auto lower =
+                    (boxes[i].min()[axis] - origin[axis]) * inverse;
+                const auto upper =
+                    (boxes[i].max()[axis] - origin[axis]) * inverse;
+                if (std::isnan(lower) || std::isnan(upper)) {
+                    continue;
+                }
+                near = lane_max(lane_min(lower, upper), near);
+                far = lane_min(lane_max(lower, upper), far);
+            }
+            if (near <= far) {
+                result.push_back(static_cast<uint32_t>(i));
+            }
+        }
+        return result;
+    }
+
+    [[nodiscard]] static auto squared_distance(
+        const AABB<T>& box, const Vector<T, 3>& point
+    ) -> T {
+        auto result = T{0};
+        for (size_t axis = 0; axis < 3; ++axis) {
+            const auto closest =
+                std::clamp(point[axis], box.min()[axis], box.max()[axis]);
+            result += (point[axis] - closest) * (point[axis] - closest);
+        }
+        return result;
+    }
+
+    static auto expect_queries(
+        const BVH<T>& bvh, const std::vector<AABB<T>>& boxes
+    ) -> void {
+        for (const auto& probe : BVHTests::probe_boxes()) {
+            auto hits = std::vector<uint32_t>{};
+            bvh.query(probe, hits);
+            EXPECT_EQ(
+                BVHTests::sorted(hits), BVHTests::overlapping(boxes, probe)
+            );
+        }
+    }
+};
+
+using BVHStorageTypes = ::testing::Types<float, double>;
+
+TYPED_TEST_SUITE(BVHTests, BVHStorageTypes);
+
+}  // namespace
+
+TYPED_TEST(BVHTests, Empty) {
+    const auto bvh = BVH<TypeParam>{};
+    const auto built = BVH<TypeParam>{std::span<const AABB<TypeParam>>{}};
+
+    for (const auto* tree : {&bvh, &built}) {
+        auto hits = std::vector<uint32_t>{};
+        tree->query(AABB<TypeParam>{{-1, -1, -1}, {1, 1, 1}}, hits);
+        tree->query_ray({0, 0, 0}, {1, 0, 0}, TypeParam{10}, hits);
+
+        EXPECT_EQ(tree->size(), size_t{0});
+        EXPECT_TRUE(hits.empty());
+        EXPECT_TRUE(tree->bounds().is_empty());
+        EXPECT_FALSE(tree->nearest({0, 0, 0}).has_value());
+    }
+}
+
+TYPED_TEST(BVHTests, QueryBoxes) {
+    const auto boxes = TestFixture::random_boxes(TestFixture::count, 1);
+
+    for (const auto leaf_size : {size_t{1}, size_t{4}, size_t{64}}) {
+        const auto bvh =
+            BVH<TypeParam>{boxes, BVHOptions{.leaf_size = leaf_size}};
+
+        EXPECT_EQ(bvh.size(), TestFixture::count);
+        EXPECT_EQ(bvh.bounds(), merge(boxes));
+        TestFixture::expect_queries(bvh, boxes);
+    }
+}
+
+TYPED_TEST(BVHTests, ParallelBuild) {
+    const auto boxes =
+        TestFixture::random_boxes(TestFixture::parallel_count, 2);
+
+    const auto serial = BVH<TypeParam>{boxes, BVHOptions{.thread_count = 1}};
+    const auto parallel =
+        BVH<TypeParam>{boxes, BVHOptions{.thread_count = 4}};
+
+    EXPECT_EQ(parallel.size(), TestFixture::parallel_count);
+    EXPECT_EQ(parallel.bounds(), serial.bounds());
+    TestFixture::expect_queries(serial, boxes);
+    TestFixture::expect_queries(parallel, boxes);
+}
+
+TYPED_TEST(BVHTests, QueryRay) {
+    const auto boxes = TestFixture::random_boxes(TestFixture::count, 3);
+    const auto bvh = BVH<TypeParam>{boxes};
+
+    using Ray = std::pair<Vector<TypeParam, 3>, Vector<TypeParam, 3>>;
+
+    const auto rays = std::vector<Ray>{
+        {{-60, 0, 0}, {1, 0, 0}},
+        {{0, 0, 0}, {0.3, -0.5, 0.8}},
+        {{10, 20, -60}, {0, 0, 1}},
+        {{-60, -60, -60}, {1, 1, 1}},
+        {{100, 100, 100}, {1, 0, 0}},
+    };
+
+    for (size_t i = 0; i < rays.size(); ++i) {
+        const auto& [origin, direction] = rays[i];
+        for (const auto max_distance : {TypeParam{30}, TypeParam{200}}) {
+            auto hits = std::vector<uint32_t>{};
+            bvh.query_ray(origin, direction, max_distance, hits);
+            EXPECT_EQ(
+                TestFixture::sorted(hits),
+                TestFixture::crossed(boxes, origin, direction, max_distance)
+            ) << std::format("Ray {} of length {}", i, max_distance);
+        }
+    }
+}
+
+TYPED_TEST(BVHTests, QueryRayOnFace) {
+    const auto boxes = std::vector<AABB<TypeParam>>{
+        AABB<TypeParam>{{0, 0, 0}, {1, 1, 1}},
+    };
+    const auto bvh = BVH<TypeParam>{boxes};
+
+    using Ray = std::pair<Vector<TypeParam, 3>, Vector<TypeParam, 3>>;
+
+    // Rays parallel to the faces they start on, which are all hits as the
+    // boxes are closed.
+    const auto on_faces = std::vector<Ray>{
+        {{0, 0.5, -1}, {0, 0, 1}},
+        {{1, 0.5, -1}, {0, 0, 1}},
+        {{0.5, 0, -1}, {-0.0, 0, 1}},
+        {{0.5, 1, -1}, {0, -0.0, 1}},
+        {{0, 0, -1}, {0, 0, 1}},
+        {{-1, 0, 1}, {1, 0, 0}},
+    };
+    for (size_t i = 0; i < on_faces.size(); ++i) {
+        const auto& [origin, direction] = on_faces[i];
+        auto hits = std::vector<uint32_t>{};
+        bvh.query_ray(origin, direction, TypeParam{10}, hits);
+        EXPECT_EQ(hits, std::vector<uint32_t>{0})
+            << std::format("Ray {} misses", i);
+    }
+
+    auto hits = std::vector<uint32_t>{};
+    bvh.query_ray({-0.001, 0.5, -1}, {0, 0, 1}, TypeParam{10}, hits);
+    bvh.query_ray({1.001, 0.5, -1}, {0, 0, 1}, TypeParam{10}, hits);
+    EXPECT_TRUE(hits.empty());
+}
+
+TYPED_TEST(BVHTests, Nearest) {
+    const auto boxes = TestFixture::random_boxes(TestFixture::count, 4);
+    const auto bvh = BVH<TypeParam>{boxes};
+
+    auto generator = std::mt19937{5};
+    auto position = std::uniform_real_distribution<TypeParam>{-80, 80};
+
+    for (size_t i = 0; i < 50; ++i) {
+        const auto point = Vector<TypeParam, 3>{
+            position(generator), position(generator), position(generator)
+        };
+
+        auto expected = std::numeric_limits<TypeParam>::infinity();
+        for (const auto& box : boxes) {
+            expected = std::min(
+                expected, TestFixture::squared_distance(box, point)
+            );
+        }
+
+        const auto nearest = bvh.nearest(point);
+        ASSERT_TRUE(nearest.has_value());
+        EXPECT_NEAR(nearest->squared_distance, expected, TypeParam{1e-3})
+            << std::format("Point {}", i);
+        EXPECT_NEAR(
+            TestFixture::squared_distance(boxes[nearest->index], point),
+            expected,
+            TypeParam{1e-3}
+        ) << std::format("Point {}", i);
+    }
+
+    EXPECT_FALSE(bvh.nearest({500, 500, 500}, TypeParam{10}).has_value());
+}
+
+TYPED_TEST(BVHTests, NearestPoint) {
+    auto points = std::vector<Vector<TypeParam, 3>>{};
+    for (const auto& box : TestFixture::random_boxes(TestFixture::count, 6)) {
+        points.push_back(box.center());
+    }
+    const auto bvh = BVH<TypeParam>::from_points(points);
+
+    for (size_t i = 0; i < points.size(); i += 97) {
+        const auto nearest = bvh.nearest(points[i]);
+        ASSERT_TRUE(nearest.has_value());
+        EXPECT_EQ(nearest->index, i);
+        EXPECT_EQ(nearest->squared_distance, TypeParam{0});
+    }
+}
+
+TYPED_TEST(BVHTests, Coincident) {
+    const auto boxes = std::vector<AABB<TypeParam>>(
+        100, AABB<TypeParam>{{1, 2, 3}, {1, 2, 3}}
+    );
+    const auto bvh = BVH<TypeParam>{boxes};
+
+    auto hits = std::vector<uint32_t>{};
+    bvh.query(AABB<TypeParam>{{0, 0, 0}, {2, 2, 3}}, hits);
+    EXPECT_EQ(hits.size(), boxes.size());
+}
+
+TYPED_TEST(BVHTests, Refit) {
+    auto boxes = TestFixture::random_boxes(TestFixture::count, 7);
+    auto bvh = BVH<TypeParam>{boxes};
+
+    // Moves one primitive in ten far from where the tree was built.
+    auto moved = std::vector<uint32_t>{};
+    for (size_t i = 0; i < boxes.size(); i += 10) {
+        const auto offset = Vector<TypeParam, 3>{
+            static_cast<TypeParam>(i % 7) * 10 - 30, 15, -20
+        };
+        boxes[i] = AABB<TypeParam>{
+            boxes[i].min() + offset, boxes[i].max() + offset
+        };
+        moved.push_back(static_cast<uint32_t>(i));
+    }
+
+    bvh.refit(boxes, moved);
+    EXPECT_EQ(bvh.bounds(), merge(boxes));
+    TestFixture::expect_queries(bvh, boxes);
+
+    auto rebuilt = BVH<TypeParam>{TestFixture::random_boxes(boxes.size(), 8)};
+    rebuilt.refit(boxes);
+    EXPECT_EQ(rebuilt.bounds(), merge(boxes));
+    TestFixture::expect_queries(rebuilt, boxes);
+}
+
+TYPED_TEST(BVHTests, InvalidArguments) {
+    const auto boxes = TestFixture::random_boxes(10, 9);
+    auto bvh = BVH<TypeParam>{boxes};
+
+    EXPECT_THROW(
+        (void)BVH<TypeParam>(boxes, BVHOptions{.leaf_size = 0}),
+        std::invalid_argument
+    );
+    EXPECT_THROW(
+        (void)BVH<TypeParam>(boxes, BVHOptions{.leaf_size = 65536}),
+        std::invalid_argument
+    );
+
+    const auto fewer = std::span{boxes}.first(9);
+    const auto moved = std::vector<uint32_t>{10};
+    EXPECT_THROW(bvh.refit(fewer), std::invalid_argument);
+    EXPECT_THROW(bvh.refit(boxes, moved), std::out_of_range);
+}
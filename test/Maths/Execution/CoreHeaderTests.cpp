@@ -0,0 +1,56 @@
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include <LuminolMaths/Transform.hpp>
+#include <LuminolMaths/TransformBatch.hpp>
+#include <LuminolMaths/TransformHierarchy.hpp>
+#include <LuminolMaths/VectorBatch.hpp>
+
+// The core headers must not include <execution>, which libstdc++ implements
+// on top of TBB when it is installed. This target links neither TBB nor
+// LuminolMaths.ExecutionStd, so it fails to link if one of them does.
+#ifdef _PSTL_EXECUTION_POLICIES_DEFINED
+#error "A core header includes <execution>, include ExecutionStd.hpp instead"
+#endif
+
+using namespace Luminol::Maths;
+
+namespace {
+
+/// A policy type the core headers know nothing about.
+struct UnknownPolicy {};
+
+static_assert(Execution::Policy<Execution::Sequential>);
+static_assert(Execution::Policy<Execution::ThreadPool&>);
+static_assert(!Execution::Policy<UnknownPolicy>);
+
+}  // namespace
+
+TEST(CoreHeaderTests, BatchesWithoutStandardPolicies) {
+    constexpr auto count = size_t{20'000};
+
+    auto vectors = std::vector<Vector<float, 3>>(count);
+    for (size_t i = 0; i < count; ++i) {
+        vectors[i] = {
+            static_cast<float>(i % 7) + 1.0F,
+            static_cast<float>(i % 5),
+            static_cast<float>(i % 3),
+        };
+    }
+
+    const auto matrix = Transform::translate_4x4(Vector<float, 3>{1, 2, 3});
+    const auto points = VectorBatch<float, 3>{std::span{vectors}};
+
+    auto expected = VectorBatch<float, 3>{};
+    Transform::transform_points(matrix, points, expected);
+
+    auto pool = Execution::ThreadPool{2};
+    auto out = VectorBatch<float, 3>{};
+    Transform::transform_points(pool, matrix, points, out);
+    EXPECT_EQ(out.to_vectors(), expected.to_vectors());
+
+    auto normalized = points;
+    normalized.normalize(Execution::sequential);
+    EXPECT_EQ(normalized.to_vectors(), points.normalized().to_vectors());
+}
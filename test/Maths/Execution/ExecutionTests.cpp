@@ -0,0 +1,263 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <format>
+#include <functional>
+#include <stdexcept>
+#include <vector>
+
+#include <LuminolMaths/Execution.hpp>
+#include <LuminolMaths/ExecutionStd.hpp>
+#include <LuminolMaths/Transform.hpp>
+#include <LuminolMaths/TransformBatch.hpp>
+#include <LuminolMaths/VectorBatch.hpp>
+
+using namespace Luminol::Maths;
+
+namespace {
+
+/// Runs every task on the calling thread, counting the calls to `run`.
+struct CountingPool {
+    size_t runs = 0;
+
+    [[nodiscard]] auto concurrency() const -> size_t { return 4; }
+
+    auto run(size_t count, const std::function<void(size_t)>& task) -> void {
+        ++this->runs;
+        for (size_t i = 0; i < count; ++i) {
+            task(i);
+        }
+    }
+};
+
+static_assert(Execution::TaskPool<CountingPool>);
+static_assert(Execution::TaskPool<Execution::ThreadPool>);
+static_assert(Execution::Policy<const Execution::Sequential&>);
+static_assert(Execution::Policy<decltype(std::execution::par_unseq)>);
+static_assert(Execution::Policy<decltype(std::execution::seq)>);
+static_assert(Execution::PolicyTraits<std::execution::parallel_policy>::
+                  is_parallel);
+static_assert(!Execution::PolicyTraits<std::execution::sequenced_policy>::
+                  is_parallel);
+static_assert(!Execution::Policy<Matrix<float, 4, 4>>);
+
+template <std::floating_point T>
+struct ExecutionTests : public ::testing::Test {
+    /// Spans several chunks, and is not a multiple of the chunk alignment.
+    constexpr static auto count = size_t{50'003};
+
+    [[nodiscard]] static auto make_matrix() -> Matrix<T, 4, 4> {
+        return Transform::scale_4x4(Vector<T, 3>{2, 3, 4}) *
+               Transform::rotate_x<T, 4>(Luminol::Units::Angle<
+                                         T,
+                                         Luminol::Units::Radian>{T{0.5}}) *
+               Transform::translate_4x4(Vector<T, 3>{-1, 5, 7});
+    }
+
+    template <size_t N>
+    [[nodiscard]] static auto make_vectors() -> std::vector<Vector<T, N>> {
+        auto vectors = std::vector<Vector<T, N>>(count);
+        for (size_t i = 0; i < count; ++i) {
+            for (size_t j = 0; j < N; ++j) {
+                vectors[i][j] = static_cast<T>((i * (j + 3)) % 101) - T{50};
+            }
+        }
+        return vectors;
+    }
+};
+
+using ExecutionStorageTypes = ::testing::Types<float, double>;
+
+TYPED_TEST_SUITE(ExecutionTests, ExecutionStorageTypes);
+
+}  // namespace
+
+TEST(ExecutionTests, ChunkSize) {
+    EXPECT_EQ(Execution::chunk_size(1), Execution::chunk_bytes);
+    EXPECT_EQ(Execution::chunk_size(24), size_t{2736});
+    EXPECT_EQ(Execution::chunk_size(1 << 20), Execution::chunk_alignment);
+    EXPECT_EQ(Execution::chunk_size(0), Execution::chunk_bytes);
+}
+
+TEST(ExecutionTests, ForEachChunk) {
+    constexpr auto count = size_t{100'003};
+    constexpr auto element_bytes = size_t{12};
+    const auto size = Execution::chunk_size(element_bytes);
+
+    auto pool = Execution::ThreadPool{4};
+    EXPECT_EQ(pool.concurrency(), size_t{4});
+
+    auto visits = std::vector<int>(count);
+    Execution::for_each_chunk(
+        pool,
+        count,
+        element_bytes,
+        [&](size_t begin, size_t end) {
+            EXPECT_EQ(begin % size, size_t{0});
+            EXPECT_LE(end - begin, size);
+            for (size_t i = begin; i < end; ++i) {
+                ++visits[i];
+            }
+        }
+    );
+
+    for (size_t i = 0; i < count; ++i) {
+        ASSERT_EQ(visits[i], 1) << std::format("Element {}", i);
+    }
+
+    auto calls = 0;
+    Execution::for_each_chunk(
+        Execution::sequential,
+        count,
+        element_bytes,
+        [&](size_t begin, size_t end) {
+            EXPECT_EQ(begin, size_t{0});
+            EXPECT_EQ(end, count);
+            ++calls;
+        }
+    );
+    EXPECT_EQ(calls, 1);
+
+    Execution::for_each_chunk(
+        std::execution::par_unseq, 0, element_bytes, [&](size_t, size_t) {
+            ++calls;
+        }
+    );
+    EXPECT_EQ(calls, 1);
+}
+
+TEST(ExecutionTests, ThreadPool) {
+    auto pool = Execution::ThreadPool{3};
+
+    // Throws from one task, the pool is still usable afterwards.
+    EXPECT_THROW(
+        pool.run(
+            100,
+            [](size_t i) {
+                if (i == 37) {
+                    throw std::runtime_error("Task failed");
+                }
+            }
+        ),
+        std::runtime_error
+    );
+
+    // Nested runs execute inline instead of waiting for the busy threads.
+    auto total = std::atomic<size_t>{0};
+    pool.run(8, [&](size_t) {
+        pool.run(8, [&](size_t j) { total += j; });
+    });
+    EXPECT_EQ(total.load(), size_t{8 * 28});
+
+    auto single = Execution::ThreadPool{1};
+    auto sum = size_t{0};
+    single.run(10, [&](size_t i) { sum += i; });
+    EXPECT_EQ(single.concurrency(), size_t{1});
+    EXPECT_EQ(sum, size_t{45});
+}
+
+TYPED_TEST(ExecutionTests, Transforms) {
+    const auto matrix = TestFixture::make_matrix();
+    const auto points = TestFixture::template make_vectors<3>();
+    const auto vectors = TestFixture::template make_vectors<4>();
+
+    auto expected_points = std::vector<Vector<TypeParam, 3>>(points.size());
+    auto expected_directions = expected_points;
+    auto expected_vectors = std::vector<Vector<TypeParam, 4>>(vectors.size());
+    Transform::transform_points(matrix, points, expected_points);
+    Transform::transform_directions(matrix, points, expected_directions);
+    Transform::transform_vectors(matrix, vectors, expected_vectors);
+
+    auto pool = Execution::ThreadPool{4};
+    auto counting = CountingPool{};
+
+    const auto run = [&](auto& policy) {
+        auto out_points = std::vector<Vector<TypeParam, 3>>(points.size());
+        auto out_directions = out_points;
+        auto out_vectors = std::vector<Vector<TypeParam, 4>>(vectors.size());
+        Transform::transform_points(policy, matrix, points, out_points);
+        Transform::transform_directions(policy, matrix, points, out_directions);
+        Transform::transform_vectors(policy, matrix, vectors, out_vectors);
+
+        EXPECT_EQ(out_points, expected_points);
+        EXPECT_EQ(out_directions, expected_directions);
+        EXPECT_EQ(out_vectors, expected_vectors);
+
+        auto in_place = points;
+        Transform::transform_points(policy, matrix, in_place);
+        EXPECT_EQ(in_place, expected_points);
+    };
+
+    run(Execution::sequential);
+    run(std::execution::par_unseq);
+    run(pool);
+    run(counting);
+
+    // One run per kernel call, each covering every chunk.
+    EXPECT_EQ(counting.runs, size_t{4});
+}
+
+TYPED_TEST(ExecutionTests, Batches) {
+    const auto matrix = TestFixture::make_matrix();
+    const auto vectors = TestFixture::template make_vectors<3>();
+    const auto points = VectorBatch<TypeParam, 3>{std::span{vectors}};
+
+    auto expected = VectorBatch<TypeParam, 3>{};
+    Transform::transform_points(matrix, points, expected);
+    auto expected_directions = points;
+    Transform::transform_directions(matrix, expected_directions);
+
+    auto pool = Execution::ThreadPool{4};
+
+    auto out = VectorBatch<TypeParam, 3>{};
+    Transform::transform_points(pool, matrix, points, out);
+    EXPECT_EQ(out.to_vectors(), expected.to_vectors());
+
+    auto directions = points;
+    Transform::transform_directions(pool, matrix, directions);
+    EXPECT_EQ(directions.to_vectors(), expected_directions.to_vectors());
+
+    auto dots = std::vector<TypeParam>(points.size());
+    auto lengths = std::vector<TypeParam>(points.size());
+    points.dot(pool, out, dots);
+    points.length(pool, lengths);
+
+    const auto expected_dots = points.dot(out);
+    const auto expected_lengths = points.length();
+    EXPECT_EQ(
+        dots, std::vector<TypeParam>(expected_dots.begin(), expected_dots.end())
+    );
+    EXPECT_EQ(
+        lengths,
+        std::vector<TypeParam>(
+            expected_lengths.begin(), expected_lengths.end()
+        )
+    );
+
+    auto normalized = points;
+    normalized.normalize(std::execution::par);
+    EXPECT_EQ(normalized.to_vectors(), points.normalized().to_vectors());
+}
+
+TYPED_TEST(ExecutionTests, SizeMismatch) {
+    const auto matrix = TestFixture::make_matrix();
+    const auto points = TestFixture::template make_vectors<3>();
+    const auto vectors = TestFixture::template make_vectors<4>();
+    const auto batch = VectorBatch<TypeParam, 3>{std::span{points}};
+
+    auto pool = Execution::ThreadPool{2};
+    auto out_points = std::vector<Vector<TypeParam, 3>>(points.size() - 1);
+    auto out_vectors = std::vector<Vector<TypeParam, 4>>(vectors.size() + 1);
+    auto out_scalars = std::vector<TypeParam>(points.size() - 1);
+
+    EXPECT_THROW(
+        Transform::transform_points(pool, matrix, points, out_points),
+        std::invalid_argument
+    );
+    EXPECT_THROW(
+        Transform::transform_vectors(pool, matrix, vectors, out_vectors),
+        std::invalid_argument
+    );
+    EXPECT_THROW(batch.dot(pool, batch, out_scalars), std::invalid_argument);
+    EXPECT_THROW(batch.length(pool, out_scalars), std::invalid_argument);
+}
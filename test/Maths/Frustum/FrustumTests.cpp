@@ -0,0 +1,214 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstdint>
+#include <format>
+#include <stdexcept>
+#include <vector>
+
+#include <TestUtils.hpp>
+#include <LuminolMaths/BitMask.hpp>
+#include <LuminolMaths/Frustum.hpp>
+#include <LuminolMaths/Transform.hpp>
+
+using namespace Luminol::Maths;
+
+namespace {
+
+template <std::floating_point T>
+struct FrustumTests : public ::testing::Test {
+    using Side = typename Frustum<T>::Side;
+
+    /// Not a multiple of 64, so the last word of the mask is partial.
+    constexpr static auto count = size_t{150};
+
+    constexpr static auto epsilon = T{1e-5};
+
+    /// A camera at z = -10 looking at the origin with a 90 degree field of
+    /// view, so the sides of the frustum are at 45 degrees, from z = -9 to
+    /// z = 90.
+    [[nodiscard]] static auto make_frustum() -> Frustum<T> {
+        using Degrees = Luminol::Units::Angle<T, Luminol::Units::Degree>;
+
+        const auto view = Transform::left_handed_look_at_matrix<T>({
+            .eye = {0, 0, -10},
+            .target = {0, 0, 0},
+            .up_vector = {0, 1, 0},
+        });
+        const auto projection =
+            Transform::left_handed_perspective_projection_matrix<T>({
+                .fov = Degrees{90},
+                .aspect_ratio = T{1},
+                .near_plane = T{1},
+                .far_plane = T{100},
+            });
+
+        return Frustum<T>{view * projection};
+    }
+
+    /// Spreads the objects around and through the frustum.
+    [[nodiscard]] static auto make_position(size_t index) -> Vector<T, 3> {
+        return {
+            static_cast<T>(index * 37 % 121) - T{60},
+            static_cast<T>(index * 53 % 97) - T{48},
+            static_cast<T>(index * 29 % 131) - T{20},
+        };
+    }
+
+    [[nodiscard]] static auto make_size(size_t index) -> T {
+        return static_cast<T>(index % 9) * T{0.75};
+    }
+};
+
+using FrustumStorageTypes = ::testing::Types<float, double>;
+
+TYPED_TEST_SUITE(FrustumTests, FrustumStorageTypes);
+
+}  // namespace
+
+TYPED_TEST(FrustumTests, Planes) {
+    const auto frustum = TestFixture::make_frustum();
+    const auto diagonal = std::sqrt(TypeParam{0.5});
+
+    const auto expect_plane = [&](auto side, Vector<TypeParam, 4> expected) {
+        const auto& plane = frustum.plane(side);
+        for (size_t i = 0; i < 4; ++i) {
+            EXPECT_NEAR(
+                plane[i],
+                expected[i],
+                TestFixture::epsilon * (std::fabs(expected[i]) + TypeParam{1})
+            ) << std::format("Coefficient {} of side {}", i, int(side));
+        }
+    };
+
+    using Side = typename TestFixture::Side;
+
+    expect_plane(Side::Left, {diagonal, 0, diagonal, 10 * diagonal});
+    expect_plane(Side::Right, {-diagonal, 0, diagonal, 10 * diagonal});
+    expect_plane(Side::Bottom, {0, diagonal, diagonal, 10 * diagonal});
+    expect_plane(Side::Top, {0, -diagonal, diagonal, 10 * diagonal});
+    expect_plane(Side::Near, {0, 0, 1, 9});
+    expect_plane(Side::Far, {0, 0, -1, 90});
+}
+
+TYPED_TEST(FrustumTests, ContainsPoint) {
+    const auto frustum = TestFixture::make_frustum();
+
+    EXPECT_TRUE(frustum.contains({0, 0, 0}));
+    EXPECT_TRUE(frustum.contains({15, -15, 10}));
+    EXPECT_FALSE(frustum.contains({0, 0, -9.5}));
+    EXPECT_FALSE(frustum.contains({0, 0, 95}));
+    EXPECT_FALSE(frustum.contains({25, 0, 10}));
+    EXPECT_FALSE(frustum.contains({0, -25, 10}));
+}
+
+TYPED_TEST(FrustumTests, IntersectsSphere) {
+    const auto frustum = TestFixture::make_frustum();
+
+    // 5 / sqrt(2) away from the right plane.
+    EXPECT_FALSE(frustum.intersects({25, 0, 10}, TypeParam{3}));
+    EXPECT_TRUE(frustum.intersects({25, 0, 10}, TypeParam{4}));
+    EXPECT_FALSE(frustum.intersects({0, 0, -12}, TypeParam{2.5}));
+    EXPECT_TRUE(frustum.intersects({0, 0, -12}, TypeParam{3.5}));
+}
+
+TYPED_TEST(FrustumTests, IntersectsBox) {
+    const auto frustum = TestFixture::make_frustum();
+
+    EXPECT_TRUE(frustum.intersects({-1, -1, -1}, {1, 1, 1}));
+    EXPECT_TRUE(frustum.intersects({-100, -100, 50}, {100, 100, 60}));
+    EXPECT_FALSE(frustum.intersects({22, -1, 9}, {24, 1, 11}));
+    EXPECT_TRUE(frustum.intersects({18, -1, 9}, {24, 1, 11}));
+    EXPECT_FALSE(frustum.intersects({-1, -1, 91}, {1, 1, 95}));
+}
+
+TYPED_TEST(FrustumTests, IntersectsBoundingVolumes) {
+    const auto frustum = TestFixture::make_frustum();
+
+    EXPECT_TRUE(frustum.intersects(Sphere<TypeParam>{{25, 0, 10}, 4}));
+    EXPECT_FALSE(frustum.intersects(Sphere<TypeParam>{{25, 0, 10}, 3}));
+    EXPECT_FALSE(frustum.intersects(Sphere<TypeParam>{}));
+
+    EXPECT_TRUE(frustum.intersects(AABB<TypeParam>{{18, -1, 9}, {24, 1, 11}}));
+    EXPECT_FALSE(frustum.intersects(AABB<TypeParam>{{22, -1, 9}, {24, 1, 11}})
+    );
+    EXPECT_FALSE(frustum.intersects(AABB<TypeParam>{}));
+}
+
+TYPED_TEST(FrustumTests, CullSpheres) {
+    const auto frustum = TestFixture::make_frustum();
+
+    auto centers = VectorBatch<TypeParam, 3>{};
+    auto radii = std::vector<TypeParam>{};
+    for (size_t i = 0; i < TestFixture::count; ++i) {
+        centers.push_back(TestFixture::make_position(i));
+        radii.push_back(TestFixture::make_size(i));
+    }
+
+    auto visible = std::vector<uint64_t>(
+        BitMask::word_count(TestFixture::count), ~uint64_t{0}
+    );
+    frustum.cull_spheres(centers, radii, visible);
+
+    auto visible_count = size_t{0};
+    for (size_t i = 0; i < TestFixture::count; ++i) {
+        const auto expected = frustum.intersects(centers.get(i), radii[i]);
+        EXPECT_EQ(BitMask::test(visible, i), expected)
+            << std::format("Sphere {} is misclassified", i);
+        visible_count += expected ? 1 : 0;
+    }
+
+    EXPECT_GT(visible_count, size_t{0});
+    EXPECT_LT(visible_count, TestFixture::count);
+    EXPECT_EQ(visible.back() >> (TestFixture::count % 64), uint64_t{0});
+}
+
+TYPED_TEST(FrustumTests, CullBoxes) {
+    const auto frustum = TestFixture::make_frustum();
+
+    auto mins = VectorBatch<TypeParam, 3>{};
+    auto maxs = VectorBatch<TypeParam, 3>{};
+    for (size_t i = 0; i < TestFixture::count; ++i) {
+        const auto center = TestFixture::make_position(i);
+        const auto extent = Vector<TypeParam, 3>{
+            TestFixture::make_size(i),
+            TestFixture::make_size(i + 3),
+            TestFixture::make_size(i + 5),
+        };
+        mins.push_back(center - extent);
+        maxs.push_back(center + extent);
+    }
+
+    auto visible = std::vector<uint64_t>(
+        BitMask::word_count(TestFixture::count), ~uint64_t{0}
+    );
+    frustum.cull_boxes(mins, maxs, visible);
+
+    auto visible_count = size_t{0};
+    for (size_t i = 0; i < TestFixture::count; ++i) {
+        const auto expected = frustum.intersects(mins.get(i), maxs.get(i));
+        EXPECT_EQ(BitMask::test(visible, i), expected)
+            << std::format("Box {} is misclassified", i);
+        visible_count += expected ? 1 : 0;
+    }
+
+    EXPECT_GT(visible_count, size_t{0});
+    EXPECT_LT(visible_count, TestFixture::count);
+    EXPECT_EQ(visible.back() >> (TestFixture::count % 64), uint64_t{0});
+}
+
+TYPED_TEST(FrustumTests, SizeMismatch) {
+    const auto frustum = TestFixture::make_frustum();
+
+    const auto centers = VectorBatch<TypeParam, 3>{size_t{65}};
+    const auto radii = std::vector<TypeParam>(65);
+    auto visible = std::vector<uint64_t>(1);
+
+    EXPECT_THROW(
+        frustum.cull_spheres(centers, radii, visible), std::invalid_argument
+    );
+    EXPECT_THROW(
+        frustum.cull_boxes(centers, VectorBatch<TypeParam, 3>{}, visible),
+        std::invalid_argument
+    );
+}
@@ -0,0 +1,112 @@
+#include <gtest/gtest.h>
+
+#include <format>
+
+#include <TestUtils.hpp>
+#include <LuminolMaths/Lazy.hpp>
+
+using namespace Luminol::Maths;
+
+namespace {
+
+template <std::floating_point T>
+struct LazyTests : public ::testing::Test {
+    constexpr static auto epsilon = T{1e-6};
+
+    [[nodiscard]] static auto make_matrix(T offset) -> Matrix<T, 3, 4> {
+        auto matrix = Matrix<T, 3, 4>::zero();
+        for (size_t i = 0; i < 3; ++i) {
+            for (size_t j = 0; j < 4; ++j) {
+                matrix[i][j] = static_cast<T>(i * 4 + j) * offset - T{2};
+            }
+        }
+        return matrix;
+    }
+
+    static auto expect_equal(
+        const Vector<T, 4>& value, const Vector<T, 4>& expected
+    ) -> void {
+        for (size_t i = 0; i < 4; ++i) {
+            Luminol::TestUtils::expect_floating_equal(
+                value[i],
+                expected[i],
+                std::format("Component {} differs", i)
+            );
+        }
+    }
+};
+
+using LazyStorageTypes = ::testing::Types<float, double>;
+
+TYPED_TEST_SUITE(LazyTests, LazyStorageTypes);
+
+}  // namespace
+
+TYPED_TEST(LazyTests, VectorChain) {
+    const auto a = Vector<TypeParam, 4>{1, 2, 3, 4};
+    const auto b = Vector<TypeParam, 4>{-2, 0.5, 8, 1};
+    const auto c = Vector<TypeParam, 4>{0.25, -1, 6, 3};
+    const auto s = TypeParam{1.5};
+
+    const auto value =
+        Vector<TypeParam, 4>{Lazy::lazy(a) + Lazy::lazy(b) * s - c};
+
+    TestFixture::expect_equal(value, a + b * s - c);
+}
+
+TYPED_TEST(LazyTests, VectorOperators) {
+    const auto a = Vector<TypeParam, 4>{1, 2, 3, 4};
+    const auto b = Vector<TypeParam, 4>{-2, 0.5, 8, 1};
+
+    const auto lhs_plain = Vector<TypeParam, 4>{b - Lazy::lazy(a)};
+    const auto product = Vector<TypeParam, 4>{Lazy::lazy(a) * b};
+    const auto scaled = Vector<TypeParam, 4>{TypeParam{2} * Lazy::lazy(b) / 4};
+    const auto negated = (-Lazy::lazy(a)).eval();
+
+    TestFixture::expect_equal(lhs_plain, b - a);
+    TestFixture::expect_equal(product, a * b);
+    TestFixture::expect_equal(scaled, b * TypeParam{2} / TypeParam{4});
+    TestFixture::expect_equal(negated, -a);
+}
+
+TYPED_TEST(LazyTests, Assignment) {
+    auto a = Vector<TypeParam, 4>{1, 2, 3, 4};
+    const auto b = Vector<TypeParam, 4>{-2, 0.5, 8, 1};
+    const auto expected = a + b * TypeParam{0.5};
+
+    a = Lazy::lazy(a) + Lazy::lazy(b) * TypeParam{0.5};
+
+    TestFixture::expect_equal(a, expected);
+}
+
+TYPED_TEST(LazyTests, MatrixChain) {
+    const auto a = TestFixture::make_matrix(TypeParam{0.5});
+    const auto b = TestFixture::make_matrix(TypeParam{-1.25});
+    const auto c = TestFixture::make_matrix(TypeParam{3});
+    const auto s = TypeParam{-0.75};
+
+    const auto value =
+        Matrix<TypeParam, 3, 4>{Lazy::lazy(a) - Lazy::lazy(b) * s + c / 2};
+    const auto expected = a - b * s + c / TypeParam{2};
+
+    Luminol::TestUtils::expect_matrix_nearly_equal(
+        value, expected, TestFixture::epsilon, "Lazy matrix chain differs"
+    );
+}
+
+TYPED_TEST(LazyTests, ConstantEvaluation) {
+    constexpr auto a = Vector<TypeParam, 3>{1, 2, 3};
+    constexpr auto b = Vector<TypeParam, 3>{4, 5, 6};
+    constexpr auto value =
+        Vector<TypeParam, 3>{Lazy::lazy(a) * TypeParam{2} - b};
+
+    static_assert(value == Vector<TypeParam, 3>{-2, -1, 0});
+}
+
+TYPED_TEST(LazyTests, DivideByZero) {
+    const auto a = Vector<TypeParam, 4>{1, 2, 3, 4};
+
+    EXPECT_THROW(
+        static_cast<void>(Lazy::lazy(a) / TypeParam{0}), std::runtime_error
+    );
+}
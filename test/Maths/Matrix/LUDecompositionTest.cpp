@@ -0,0 +1,147 @@
+#include "MatrixTestHelper.hpp"
+
+#include <gtest/gtest.h>
+#include <format>
+
+#include <TestUtils.hpp>
+#include <LuminolMaths/LUDecomposition.hpp>
+
+namespace {
+
+using namespace Luminol::Maths;
+
+// Needs a row swap on the first column, so the permutation sign is exercised
+constexpr auto matrix = Matrix4x4{std::array{
+    std::array{1.0, 2.0, 0.0, -1.0},
+    std::array{4.0, 0.0, 6.0, -3.0},
+    std::array{3.0, 0.0, 2.0, -1.0},
+    std::array{5.0, 1.0, 2.0, 0.0},
+}};
+
+}  // namespace
+
+TEST(LUDecomposition, Factors) {
+    const auto lu = LUDecomposition{matrix};
+
+    auto permuted = Matrix4x4::zero();
+    for (size_t i = 0; i < 4; ++i) {
+        permuted[i] = matrix[lu.pivots().at(i)];
+    }
+
+    Luminol::TestUtils::expect_matrix_nearly_equal(
+        lu.lower() * lu.upper(),
+        permuted,
+        1e-12,
+        std::format(
+            "L * U does not match P * A.\nL * U: {}\nVS\nP * A: {}",
+            MatrixTestHelper::convert_matrix_to_string<double, 4, 4>(
+                lu.lower() * lu.upper()
+            ),
+            MatrixTestHelper::convert_matrix_to_string<double, 4, 4>(permuted)
+        )
+    );
+}
+
+TEST(LUDecomposition, Determinant) {
+    constexpr auto lu = LUDecomposition{matrix};
+
+    static_assert(!lu.is_singular());
+
+    Luminol::TestUtils::expect_floating_equal(
+        lu.determinant(),
+        matrix.determinant(),
+        "LU determinant differs from the closed form determinant"
+    );
+}
+
+TEST(LUDecomposition, Inverse) {
+    const auto inverse = LUDecomposition{matrix}.inverse();
+
+    Luminol::TestUtils::expect_matrix_nearly_equal(
+        inverse,
+        matrix.inverse(),
+        1e-12,
+        "LU inverse differs from the closed form inverse"
+    );
+}
+
+TEST(LUDecomposition, SolveVector) {
+    constexpr auto expected = Vector4{1.0, -2.0, 0.5, 3.0};
+
+    auto rhs = Vector4{};
+    for (size_t j = 0; j < 4; ++j) {
+        for (size_t i = 0; i < 4; ++i) {
+            rhs[j] += matrix[j].at(i) * expected[i];
+        }
+    }
+
+    const auto solution = LUDecomposition{matrix}.solve(rhs);
+
+    for (size_t i = 0; i < 4; ++i) {
+        EXPECT_NEAR(solution[i], expected[i], 1e-12)
+            << std::format("Component {} of the solution differs", i);
+    }
+}
+
+TEST(LUDecomposition, SolveMatrix) {
+    constexpr auto rhs = Matrix<double, 4, 2>{std::array{
+        std::array{1.0, 0.0},
+        std::array{2.0, -1.0},
+        std::array{0.0, 3.0},
+        std::array{-4.0, 1.0},
+    }};
+
+    const auto solution = LUDecomposition{matrix}.solve(rhs);
+
+    for (size_t column = 0; column < 2; ++column) {
+        for (size_t i = 0; i < 4; ++i) {
+            auto value = 0.0;
+            for (size_t k = 0; k < 4; ++k) {
+                value += matrix[i].at(k) * solution[k].at(column);
+            }
+
+            EXPECT_NEAR(value, rhs[i].at(column), 1e-12) << std::format(
+                "Row {} of right-hand side {} is not reproduced", i, column
+            );
+        }
+    }
+}
+
+TEST(LUDecomposition, LargeMatrix) {
+    constexpr auto large = Matrix<double, 6, 6>{std::array{
+        std::array{4.0, 1.0, 0.0, 0.0, 0.0, 2.0},
+        std::array{1.0, 5.0, 1.0, 0.0, 0.0, 0.0},
+        std::array{0.0, 1.0, 6.0, 1.0, 0.0, 0.0},
+        std::array{0.0, 0.0, 1.0, 7.0, 1.0, 0.0},
+        std::array{0.0, 0.0, 0.0, 1.0, 8.0, 1.0},
+        std::array{2.0, 0.0, 0.0, 0.0, 1.0, 9.0},
+    }};
+
+    constexpr auto lu = LUDecomposition{large};
+
+    static_assert(lu.determinant() > 0.0);
+
+    Luminol::TestUtils::expect_matrix_nearly_equal(
+        lu.inverse() * large,
+        Matrix<double, 6, 6>::identity(),
+        1e-12,
+        "LU inverse times the matrix is not the identity"
+    );
+
+    EXPECT_NEAR(lu.determinant(), large.determinant(), 1e-9);
+}
+
+TEST(LUDecomposition, Singular) {
+    constexpr auto singular = Matrix3x3f{std::array{
+        std::array{1.0f, 2.0f, 3.0f},
+        std::array{2.0f, 4.0f, 6.0f},
+        std::array{5.0f, 6.0f, 0.0f},
+    }};
+
+    constexpr auto lu = LUDecomposition{singular};
+
+    static_assert(lu.is_singular());
+    EXPECT_EQ(lu.determinant(), 0.0f);
+    EXPECT_TRUE(lu.inverse() == Matrix3x3f::zero());
+    EXPECT_EQ(lu.solve(Vector3f{1.0f, 2.0f, 3.0f}), (Vector3f{0, 0, 0}));
+}
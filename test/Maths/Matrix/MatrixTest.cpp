@@ -3,7 +3,9 @@
 #include <gtest/gtest.h>
 #include <format>
 
+#include <TestUtils.hpp>
 #include <LuminolMaths/Matrix.hpp>
+#include <LuminolMaths/Transform.hpp>
 
 // Test on a 1x1 matrix that the identity test works
 TEST(Matrix1x1, Identity) {
@@ -151,3 +153,351 @@ TEST(Matrix4x4, Inverse) {
         );
     }
 }
+
+TEST(Matrix4x4, Multiply) {
+    using namespace Luminol::Maths;
+
+    constexpr auto matrix_a = Matrix4x4f{std::array{
+        std::array{3.0f, 0.0f, 2.0f, -1.0f},
+        std::array{1.0f, 2.0f, 0.0f, -2.0f},
+        std::array{4.0f, 0.0f, 6.0f, -3.0f},
+        std::array{5.0f, 0.0f, 2.0f, 0.0f},
+    }};
+
+    constexpr auto matrix_b = Matrix4x4f{std::array{
+        std::array{1.0f, 2.0f, 3.0f, 4.0f},
+        std::array{-1.0f, 0.0f, 1.0f, 2.0f},
+        std::array{2.0f, 2.0f, -2.0f, 0.0f},
+        std::array{0.0f, 1.0f, 0.0f, -1.0f},
+    }};
+
+    {
+        const auto product = matrix_a * matrix_b;
+
+        constexpr auto expected = Matrix4x4f{std::array{
+            std::array{7.0f, 9.0f, 5.0f, 13.0f},
+            std::array{-1.0f, 0.0f, 5.0f, 10.0f},
+            std::array{16.0f, 17.0f, 0.0f, 19.0f},
+            std::array{9.0f, 14.0f, 11.0f, 20.0f},
+        }};
+
+        EXPECT_TRUE(product == expected) << std::format(
+            "Matrix4x4 multiply failed to produce the expected result.\n"
+            "Product: {}\nVS\nExpected: {}",
+            MatrixTestHelper::convert_matrix_to_string<float, 4, 4>(product),
+            MatrixTestHelper::convert_matrix_to_string<float, 4, 4>(expected)
+        );
+    }
+
+    {
+        // The runtime result may go through the SIMD kernels, the constant
+        // evaluated result always goes through the scalar loops.
+        const auto sum = matrix_a + matrix_b;
+        constexpr auto expected_sum = matrix_a + matrix_b;
+
+        EXPECT_TRUE(sum == expected_sum) << std::format(
+            "Matrix4x4 add failed to produce the expected result.\n"
+            "Sum: {}\nVS\nExpected: {}",
+            MatrixTestHelper::convert_matrix_to_string<float, 4, 4>(sum),
+            MatrixTestHelper::convert_matrix_to_string<float, 4, 4>(
+                expected_sum
+            )
+        );
+
+        const auto difference = matrix_a - matrix_b;
+        constexpr auto expected_difference = matrix_a - matrix_b;
+
+        EXPECT_TRUE(difference == expected_difference);
+
+        const auto scaled = matrix_a * 2.5f;
+        constexpr auto expected_scaled = matrix_a * 2.5f;
+
+        EXPECT_TRUE(scaled == expected_scaled);
+    }
+}
+
+TEST(Matrix4x4, Transpose) {
+    using namespace Luminol::Maths;
+
+    constexpr auto matrix = Matrix4x4f{std::array{
+        std::array{1.0f, 2.0f, 3.0f, 4.0f},
+        std::array{5.0f, 6.0f, 7.0f, 8.0f},
+        std::array{9.0f, 10.0f, 11.0f, 12.0f},
+        std::array{13.0f, 14.0f, 15.0f, 16.0f},
+    }};
+
+    {
+        const auto transpose = matrix.transpose();
+
+        constexpr auto expected = Matrix4x4f{std::array{
+            std::array{1.0f, 5.0f, 9.0f, 13.0f},
+            std::array{2.0f, 6.0f, 10.0f, 14.0f},
+            std::array{3.0f, 7.0f, 11.0f, 15.0f},
+            std::array{4.0f, 8.0f, 12.0f, 16.0f},
+        }};
+
+        EXPECT_TRUE(transpose == expected) << std::format(
+            "Matrix4x4 transpose failed to produce the expected result.\n"
+            "Transpose: {}\nVS\nExpected: {}",
+            MatrixTestHelper::convert_matrix_to_string<float, 4, 4>(transpose),
+            MatrixTestHelper::convert_matrix_to_string<float, 4, 4>(expected)
+        );
+    }
+}
+
+TEST(Matrix3x3, Inverse) {
+    using namespace Luminol::Maths;
+
+    constexpr auto matrix = Matrix3x3f{std::array{
+        std::array{1.0f, 2.0f, 3.0f},
+        std::array{0.0f, 1.0f, 4.0f},
+        std::array{5.0f, 6.0f, 0.0f},
+    }};
+
+    {
+        constexpr auto inverse = matrix.inverse();
+
+        constexpr auto expected = Matrix3x3f{std::array{
+            std::array{-24.0f, 18.0f, 5.0f},
+            std::array{20.0f, -15.0f, -4.0f},
+            std::array{-5.0f, 4.0f, 1.0f},
+        }};
+
+        EXPECT_TRUE(inverse == expected) << std::format(
+            "Matrix3x3 inverse failed to produce the expected result.\n"
+            "Inverse: {}\nVS\nExpected: {}",
+            MatrixTestHelper::convert_matrix_to_string<float, 3, 3>(inverse),
+            MatrixTestHelper::convert_matrix_to_string<float, 3, 3>(expected)
+        );
+    }
+
+    {
+        constexpr auto singular = Matrix3x3f{std::array{
+            std::array{1.0f, 2.0f, 3.0f},
+            std::array{2.0f, 4.0f, 6.0f},
+            std::array{5.0f, 6.0f, 0.0f},
+        }};
+
+        EXPECT_TRUE(singular.inverse() == Matrix3x3f::zero());
+    }
+}
+
+TEST(Matrix4x4, InverseMatchesAdjugate) {
+    using namespace Luminol::Maths;
+
+    constexpr auto matrix = Matrix4x4{std::array{
+        std::array{2.0, -1.0, 0.5, 3.0},
+        std::array{1.0, 4.0, -2.0, 0.25},
+        std::array{-3.0, 0.5, 1.0, 2.0},
+        std::array{0.75, 2.0, 5.0, -1.0},
+    }};
+
+    const auto cofactor = matrix.cofactor();
+
+    auto expansion = 0.0;
+    for (size_t i = 0; i < 4; ++i) {
+        expansion += matrix[0].at(i) * cofactor[0].at(i);
+    }
+
+    Luminol::TestUtils::expect_floating_equal(
+        matrix.determinant(),
+        expansion,
+        "Matrix4x4 determinant differs from the cofactor expansion"
+    );
+
+    Luminol::TestUtils::expect_matrix_nearly_equal(
+        matrix.inverse(),
+        cofactor.transpose() / expansion,
+        1e-12,
+        "Matrix4x4 inverse differs from the adjugate divided by determinant"
+    );
+
+    Luminol::TestUtils::expect_matrix_nearly_equal(
+        matrix.inverse() * matrix,
+        Matrix4x4::identity(),
+        1e-12,
+        "Matrix4x4 inverse times the matrix is not the identity"
+    );
+}
+
+TEST(Matrix4x4, AffineInverse) {
+    using namespace Luminol::Maths;
+
+    const auto matrix =
+        Transform::scale_4x4(Vector3{2.0, 0.5, 4.0}) *
+        Transform::rotate_y<double, 4>(
+            Luminol::Units::Angle<double, Luminol::Units::Radian>{0.75}
+        ) *
+        Transform::translate_4x4(Vector3{-3.0, 1.5, 8.0});
+
+    Luminol::TestUtils::expect_matrix_nearly_equal(
+        matrix.affine_inverse(),
+        matrix.inverse(),
+        1e-12,
+        "Matrix4x4 affine inverse differs from the general inverse"
+    );
+
+    Luminol::TestUtils::expect_matrix_nearly_equal(
+        matrix * matrix.affine_inverse(),
+        Matrix4x4::identity(),
+        1e-12,
+        "Matrix4x4 affine inverse times the matrix is not the identity"
+    );
+}
+
+TEST(Matrix5x5, Determinant) {
+    using namespace Luminol::Maths;
+
+    constexpr auto matrix = Matrix<double, 5, 5>{std::array{
+        std::array{2.0, 0.0, 0.0, 0.0, 1.0},
+        std::array{0.0, 3.0, 0.0, 0.0, 0.0},
+        std::array{0.0, 0.0, 1.0, 2.0, 0.0},
+        std::array{0.0, 0.0, 0.0, 4.0, 0.0},
+        std::array{1.0, 0.0, 0.0, 0.0, 1.0},
+    }};
+
+    // 3 * 1 * 4 times the determinant of the corner block [2 1; 1 1]
+    static_assert(matrix.determinant() == 12.0);
+    EXPECT_EQ(matrix.determinant(), 12.0);
+}
+
+TEST(Matrix3x4, RectangularMultiply) {
+    using namespace Luminol::Maths;
+
+    constexpr auto matrix_a = Matrix3x4f{std::array{
+        std::array{1.0f, 2.0f, 0.0f, -1.0f},
+        std::array{3.0f, -1.0f, 2.0f, 0.0f},
+        std::array{0.0f, 1.0f, 1.0f, 2.0f},
+    }};
+
+    {
+        constexpr auto matrix_b = Matrix4x2f{std::array{
+            std::array{2.0f, 1.0f},
+            std::array{0.0f, -1.0f},
+            std::array{3.0f, 2.0f},
+            std::array{1.0f, 4.0f},
+        }};
+
+        const auto product = matrix_a * matrix_b;
+
+        constexpr auto expected = Matrix3x2f{std::array{
+            std::array{1.0f, -5.0f},
+            std::array{12.0f, 8.0f},
+            std::array{5.0f, 9.0f},
+        }};
+
+        EXPECT_TRUE(product == expected) << std::format(
+            "Matrix3x4 * Matrix4x2 failed to produce the expected result.\n"
+            "Product: {}\nVS\nExpected: {}",
+            MatrixTestHelper::convert_matrix_to_string<float, 3, 2>(product),
+            MatrixTestHelper::convert_matrix_to_string<float, 3, 2>(expected)
+        );
+    }
+
+    {
+        constexpr auto matrix_b = Matrix4x4f{std::array{
+            std::array{1.0f, 2.0f, 3.0f, 4.0f},
+            std::array{-1.0f, 0.0f, 1.0f, 2.0f},
+            std::array{2.0f, 2.0f, -2.0f, 0.0f},
+            std::array{0.0f, 1.0f, 0.0f, -1.0f},
+        }};
+
+        const auto product = matrix_a * matrix_b;
+        constexpr auto expected_product = matrix_a * matrix_b;
+
+        constexpr auto expected = Matrix3x4f{std::array{
+            std::array{-1.0f, 1.0f, 5.0f, 9.0f},
+            std::array{8.0f, 10.0f, 4.0f, 10.0f},
+            std::array{1.0f, 4.0f, -1.0f, 0.0f},
+        }};
+
+        EXPECT_TRUE(product == expected);
+        EXPECT_TRUE(expected_product == expected);
+
+        // The 4x3 kernel, through the transpose of the same product
+        const auto transposed = matrix_b.transpose() * matrix_a.transpose();
+        EXPECT_TRUE(transposed == expected.transpose());
+    }
+}
+
+TEST(Matrix4x4, CompoundMultiply) {
+    using namespace Luminol::Maths;
+
+    constexpr auto matrix_b = Matrix4x4f{std::array{
+        std::array{1.0f, 2.0f, 3.0f, 4.0f},
+        std::array{-1.0f, 0.0f, 1.0f, 2.0f},
+        std::array{2.0f, 2.0f, -2.0f, 0.0f},
+        std::array{0.0f, 1.0f, 0.0f, -1.0f},
+    }};
+
+    auto matrix_a = Matrix4x4f{std::array{
+        std::array{3.0f, 0.0f, 2.0f, -1.0f},
+        std::array{1.0f, 2.0f, 0.0f, -2.0f},
+        std::array{4.0f, 0.0f, 6.0f, -3.0f},
+        std::array{5.0f, 0.0f, 2.0f, 0.0f},
+    }};
+
+    const auto expected = matrix_a * matrix_b;
+    matrix_a *= matrix_b;
+
+    EXPECT_TRUE(matrix_a == expected) << std::format(
+        "Matrix4x4 *= failed to produce the expected result.\n"
+        "Product: {}\nVS\nExpected: {}",
+        MatrixTestHelper::convert_matrix_to_string<float, 4, 4>(matrix_a),
+        MatrixTestHelper::convert_matrix_to_string<float, 4, 4>(expected)
+    );
+}
+
+TEST(Matrix3x4, VectorMultiply) {
+    using namespace Luminol::Maths;
+
+    constexpr auto matrix = Matrix3x4f{std::array{
+        std::array{1.0f, 2.0f, 0.0f, -1.0f},
+        std::array{3.0f, -1.0f, 2.0f, 0.0f},
+        std::array{0.0f, 1.0f, 1.0f, 2.0f},
+    }};
+
+    constexpr auto row_product = Vector3f{1.0f, -2.0f, 3.0f} * matrix;
+    static_assert(row_product == Vector4f{-5.0f, 7.0f, -1.0f, 5.0f});
+
+    const auto column_product = matrix * Vector4f{2.0f, 0.0f, -1.0f, 1.0f};
+    EXPECT_EQ(column_product, (Vector3f{1.0f, 4.0f, 1.0f}));
+
+    // The SIMD path of the 4x4 row vector product
+    constexpr auto square = Matrix4x4f{std::array{
+        std::array{1.0f, 2.0f, 3.0f, 4.0f},
+        std::array{-1.0f, 0.0f, 1.0f, 2.0f},
+        std::array{2.0f, 2.0f, -2.0f, 0.0f},
+        std::array{0.0f, 1.0f, 0.0f, -1.0f},
+    }};
+    constexpr auto vector = Vector4f{1.0f, -1.0f, 2.0f, 3.0f};
+    constexpr auto expected = vector * square;
+
+    EXPECT_EQ(vector * square, expected);
+}
+
+TEST(Matrix3x4, Data) {
+    using namespace Luminol::Maths;
+
+    auto matrix = Matrix3x4f{std::array{
+        std::array{1.0f, 2.0f, 3.0f, 4.0f},
+        std::array{5.0f, 6.0f, 7.0f, 8.0f},
+        std::array{9.0f, 10.0f, 11.0f, 12.0f},
+    }};
+
+    // The elements are contiguous and row-major
+    auto* data = matrix.data();
+    for (size_t i = 0; i < 12; ++i) {
+        EXPECT_EQ(data[i], static_cast<float>(i + 1))
+            << std::format("Element {} differs", i);
+        data[i] = -data[i];
+    }
+
+    EXPECT_EQ(matrix[2][3], -12.0f);
+
+    static_assert(noexcept(matrix[0]) == !Config::checked_access);
+
+    if constexpr (Config::checked_access) {
+        EXPECT_THROW(static_cast<void>(matrix[3]), std::out_of_range);
+    }
+}
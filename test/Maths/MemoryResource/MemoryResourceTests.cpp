@@ -0,0 +1,231 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <memory_resource>
+#include <stdexcept>
+#include <tuple>
+#include <vector>
+
+#include <LuminolMaths/FrameScratch.hpp>
+#include <LuminolMaths/MemoryResource.hpp>
+#include <LuminolMaths/Transform.hpp>
+#include <LuminolMaths/TransformBatch.hpp>
+#include <LuminolMaths/VectorBatch.hpp>
+
+using namespace Luminol::Maths;
+
+namespace {
+
+/**
+ * \brief Forwards to the default resource, counting the allocations still
+ * outstanding.
+ */
+class CountingResource : public std::pmr::memory_resource {
+public:
+    size_t allocations = 0;
+    size_t outstanding = 0;
+
+protected:
+    auto do_allocate(size_t bytes, size_t alignment) -> void* override {
+        ++this->allocations;
+        ++this->outstanding;
+        return std::pmr::get_default_resource()->allocate(bytes, alignment);
+    }
+
+    auto do_deallocate(void* pointer, size_t bytes, size_t alignment)
+        -> void override {
+        --this->outstanding;
+        std::pmr::get_default_resource()->deallocate(pointer, bytes, alignment);
+    }
+
+    [[nodiscard]] auto do_is_equal(const std::pmr::memory_resource& other
+    ) const noexcept -> bool override {
+        return this == &other;
+    }
+};
+
+[[nodiscard]] auto is_aligned(const void* pointer, size_t alignment) -> bool {
+    return reinterpret_cast<uintptr_t>(pointer) % alignment == 0;
+}
+
+}  // namespace
+
+TEST(MemoryResource, Arena) {
+    auto upstream = CountingResource{};
+
+    {
+        auto arena = ArenaResource{256, 64, &upstream};
+        EXPECT_EQ(arena.capacity(), 0U);
+
+        // Every allocation is cache line aligned, larger alignments are kept.
+        for (size_t i = 0; i < 10; ++i) {
+            EXPECT_TRUE(is_aligned(arena.allocate(i * 7 + 1, 1), 64));
+        }
+        EXPECT_TRUE(is_aligned(arena.allocate(8, 256), 256));
+
+        // Larger than the block size.
+        EXPECT_TRUE(is_aligned(arena.allocate(10'000, 4), 64));
+
+        const auto allocations = upstream.allocations;
+        const auto capacity = arena.capacity();
+        EXPECT_GE(capacity, 10'000U);
+
+        // Once grown, the arena serves the same allocations from its blocks.
+        for (size_t frame = 0; frame < 5; ++frame) {
+            arena.reset();
+            EXPECT_EQ(arena.used(), 0U);
+            for (size_t i = 0; i < 10; ++i) {
+                std::ignore = arena.allocate(i * 7 + 1, 1);
+            }
+            std::ignore = arena.allocate(8, 256);
+            std::ignore = arena.allocate(10'000, 4);
+        }
+        EXPECT_EQ(upstream.allocations, allocations);
+        EXPECT_EQ(arena.capacity(), capacity);
+
+        // Rewinding to a marker hands out the same memory again.
+        arena.reset();
+        std::ignore = arena.allocate(100, 1);
+        const auto marker = arena.mark();
+        const auto used = arena.used();
+        auto* first = arena.allocate(100, 1);
+        arena.rewind(marker);
+        EXPECT_EQ(arena.used(), used);
+        EXPECT_EQ(arena.allocate(100, 1), first);
+
+        arena.release();
+        EXPECT_EQ(upstream.outstanding, 0U);
+        EXPECT_EQ(arena.capacity(), 0U);
+
+        std::ignore = arena.allocate(100, 1);
+    }
+
+    EXPECT_EQ(upstream.outstanding, 0U);
+
+    EXPECT_THROW(ArenaResource(0), std::invalid_argument);
+    EXPECT_THROW(ArenaResource(256, 48), std::invalid_argument);
+}
+
+TEST(MemoryResource, Pool) {
+    auto upstream = CountingResource{};
+
+    {
+        auto pool = PoolResource{40, 4, 32, &upstream};
+        EXPECT_EQ(pool.get_block_size(), 64U);
+
+        auto blocks = std::vector<void*>{};
+        for (size_t i = 0; i < 6; ++i) {
+            blocks.push_back(pool.allocate(40, 16));
+            EXPECT_TRUE(is_aligned(blocks.back(), 32));
+        }
+        EXPECT_EQ(pool.capacity(), 8U);
+        EXPECT_EQ(upstream.allocations, 2U);
+
+        // Freed blocks are reused before any new chunk.
+        for (auto* block : blocks) {
+            pool.deallocate(block, 40, 16);
+        }
+        for (size_t i = 0; i < 8; ++i) {
+            std::ignore = pool.allocate(64, 32);
+        }
+        EXPECT_EQ(upstream.allocations, 2U);
+
+        // Larger or more aligned allocations go to the upstream resource.
+        auto* large = pool.allocate(65, 8);
+        EXPECT_TRUE(is_aligned(large, 32));
+        EXPECT_EQ(upstream.allocations, 3U);
+        pool.deallocate(large, 65, 8);
+
+        auto* aligned = pool.allocate(8, 64);
+        EXPECT_TRUE(is_aligned(aligned, 64));
+        pool.deallocate(aligned, 8, 64);
+        EXPECT_EQ(upstream.outstanding, 2U);
+    }
+
+    EXPECT_EQ(upstream.outstanding, 0U);
+
+    EXPECT_THROW(PoolResource(0), std::invalid_argument);
+    EXPECT_THROW(PoolResource(64, 0), std::invalid_argument);
+    EXPECT_THROW(PoolResource(64, 4, 3), std::invalid_argument);
+}
+
+TEST(MemoryResource, Containers) {
+    auto upstream = CountingResource{};
+    auto arena = ArenaResource{1024, 64, &upstream};
+
+    auto values = std::pmr::vector<float>{&arena};
+    values.assign(100, 1.0F);
+    EXPECT_TRUE(is_aligned(values.data(), 64));
+
+    const auto points = std::vector<Vector3f>{{1, 2, 3}, {4, 5, 6}, {7, 8, 9}};
+
+    auto batch = pmr::VectorBatch<float, 3>{
+        std::span<const Vector3f>{points},
+        std::pmr::polymorphic_allocator<float>{&arena}
+    };
+    EXPECT_EQ(batch.get_allocator().resource(), &arena);
+    EXPECT_TRUE(is_aligned(batch.x().data(), 64));
+    EXPECT_TRUE(is_aligned(batch.z().data(), 64));
+    EXPECT_EQ(batch.get(2), points[2]);
+
+    // The kernels work the same on pool allocated lanes.
+    auto pool = PoolResource{256, 16, 64, &upstream};
+    auto pooled = pmr::VectorBatch<float, 3>{
+        std::span<const Vector3f>{points},
+        std::pmr::polymorphic_allocator<float>{&pool}
+    };
+    const auto dots = pooled.dot(batch);
+    EXPECT_EQ(dots[1], 4.0F * 4.0F + 5.0F * 5.0F + 6.0F * 6.0F);
+
+    // Results come from the resource of the left operand, not the default one.
+    const auto sum = batch + pooled;
+    EXPECT_EQ(sum.get_allocator().resource(), &arena);
+    EXPECT_EQ(sum.get(2), points[2] * 2.0F);
+    EXPECT_EQ(batch.normalized().get_allocator().resource(), &arena);
+    EXPECT_EQ((pooled - batch).get_allocator().resource(), &pool);
+    EXPECT_EQ((pooled * 2.0F).get_allocator().resource(), &pool);
+    EXPECT_EQ((-pooled).get_allocator().resource(), &pool);
+}
+
+TEST(MemoryResource, FrameScratch) {
+    auto upstream = CountingResource{};
+    auto scratch = FrameScratch{4096, &upstream};
+
+    const auto points = std::vector<Vector3f>(1000, Vector3f{1, 2, 3});
+    const auto matrix = Transform::translate_4x4(Vector3f{1, 1, 1});
+
+    auto allocations = size_t{0};
+    for (size_t frame = 0; frame < 4; ++frame) {
+        scratch.begin_frame();
+        EXPECT_EQ(scratch.used(), 0U);
+
+        const auto transformed = scratch.allocate<Vector3f>(points.size());
+        EXPECT_TRUE(is_aligned(transformed.data(), 64));
+        Transform::transform_points(
+            matrix, std::span<const Vector3f>{points}, transformed
+        );
+        EXPECT_EQ(transformed[999], (Vector3f{2, 3, 4}));
+
+        {
+            // Temporaries of a kernel are freed when its scope ends.
+            const auto scope = scratch.scope();
+            const auto used = scratch.used();
+
+            auto mask = scratch.make_vector<uint8_t>();
+            mask.resize(points.size());
+            auto batch = scratch.make_batch<float, 3>(points.size());
+            EXPECT_EQ(batch.size(), points.size());
+            EXPECT_GT(scratch.used(), used);
+        }
+
+        const auto after_scope = scratch.used();
+        std::ignore = scratch.allocate<float>(1);
+        EXPECT_GT(scratch.used(), after_scope);
+
+        // Only the first frame grows the scratch.
+        if (frame == 0) {
+            allocations = upstream.allocations;
+        }
+        EXPECT_EQ(upstream.allocations, allocations);
+    }
+}
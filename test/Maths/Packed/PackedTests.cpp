@@ -0,0 +1,214 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstdint>
+#include <format>
+#include <limits>
+#include <random>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+#include <LuminolMaths/Packed.hpp>
+
+using namespace Luminol::Maths;
+
+namespace {
+
+static_assert(sizeof(Vector<Half, 3>) == 6);
+static_assert(sizeof(Vector<Snorm16, 3>) == 6);
+static_assert(sizeof(Vector<Snorm8, 4>) == 4);
+static_assert(sizeof(OctahedralNormal) == 4);
+
+// Half precision conversions round to nearest even at compile time too.
+static_assert(Half{1.0F}.get_bits() == 0x3C00);
+static_assert(Half{-2.0F}.get_bits() == 0xC000);
+static_assert(Half{65504.0F}.get_bits() == 0x7BFF);
+static_assert(Half{65519.0F}.get_bits() == 0x7BFF);
+static_assert(Half{65520.0F}.get_bits() == 0x7C00);
+static_assert(Half{0x1P-24F}.get_bits() == 0x0001);
+static_assert(Half{0x1P-25F}.get_bits() == 0x0000);
+static_assert(Half{0x1.8P-25F}.get_bits() == 0x0001);
+static_assert(Half{1.0F + 0x1P-11F}.get_bits() == 0x3C00);
+static_assert(Half{1.0F + 0x1.8P-11F}.get_bits() == 0x3C01);
+static_assert(Half{1.0F + 0x1.8P-10F}.get_bits() == 0x3C02);
+static_assert(static_cast<float>(Half::from_bits(0x3555)) == 0x1.554P-2F);
+static_assert(static_cast<float>(Half::from_bits(0x8001)) == -0x1P-24F);
+
+/// Not a multiple of the SIMD width, so the kernels run their tail.
+constexpr auto count = size_t{1003};
+
+[[nodiscard]] auto make_vectors(float scale) -> std::vector<Vector3f> {
+    auto generator = std::mt19937{7};
+    auto distribution = std::uniform_real_distribution<float>{-scale, scale};
+
+    auto vectors = std::vector<Vector3f>{};
+    for (size_t i = 0; i < count; ++i) {
+        vectors.emplace_back(
+            distribution(generator),
+            distribution(generator),
+            distribution(generator)
+        );
+    }
+    return vectors;
+}
+
+/**
+ * \brief Checks that the span and batch overloads agree with the scalar
+ * conversions of every component.
+ */
+template <PackedComponent P>
+auto expect_batches_match_scalar(const std::vector<Vector3f>& vectors)
+    -> void {
+    const auto in = std::span<const Vector3f>{vectors};
+
+    auto packed = std::vector<Vector<P, 3>>(vectors.size());
+    encode(vectors, std::span{packed});
+
+    auto packed_from_batch = std::vector<Vector<P, 3>>(vectors.size());
+    encode(VectorBatch<float, 3>{in}, std::span{packed_from_batch});
+
+    auto decoded = std::vector<Vector3f>(vectors.size());
+    decode(packed, std::span{decoded});
+
+    auto decoded_batch = VectorBatch<float, 3>{};
+    decode(packed, decoded_batch);
+    ASSERT_EQ(decoded_batch.size(), vectors.size());
+
+    for (size_t i = 0; i < vectors.size(); ++i) {
+        const auto expected = encode<P>(vectors[i]);
+        EXPECT_EQ(packed[i], expected) << std::format("Vector {}", i);
+        EXPECT_EQ(packed_from_batch[i], expected) << std::format("Batch {}", i);
+        EXPECT_EQ(decoded[i], decode(expected)) << std::format("Decoded {}", i);
+        EXPECT_EQ(decoded_batch.get(i), decoded[i]);
+    }
+}
+
+}  // namespace
+
+TEST(Packed, HalfRoundTrip) {
+    // Every half precision float converts to a float and back exactly.
+    for (uint32_t bits = 0; bits <= 0xFFFF; ++bits) {
+        const auto half = Half::from_bits(static_cast<uint16_t>(bits));
+        const auto value = static_cast<float>(half);
+
+        if (std::isnan(value)) {
+            EXPECT_TRUE(std::isnan(static_cast<float>(Half{value})));
+        } else {
+            EXPECT_EQ(Half{value}, half) << std::format("Bits {:#06x}", bits);
+        }
+    }
+
+    // Halfway between consecutive halves, the hardware and software
+    // conversions must break ties the same way.
+    auto midpoints = std::vector<Vector<float, 1>>{};
+    for (uint16_t bits = 0; bits < 0x7C00; ++bits) {
+        const auto next = static_cast<uint16_t>(bits + 1);
+        const auto lower = static_cast<float>(Half::from_bits(bits));
+        const auto upper = static_cast<float>(Half::from_bits(next));
+        midpoints.emplace_back((lower + upper) * 0.5F);
+        midpoints.emplace_back(-(lower + upper) * 0.5F);
+    }
+
+    auto packed = std::vector<Vector<Half, 1>>(midpoints.size());
+    encode(midpoints, std::span{packed});
+    for (size_t i = 0; i < midpoints.size(); ++i) {
+        EXPECT_EQ(packed[i].x(), Half{midpoints[i].x()})
+            << std::format("Midpoint {}", midpoints[i].x());
+    }
+
+    EXPECT_EQ(Half{std::numeric_limits<float>::infinity()}.get_bits(), 0x7C00);
+    EXPECT_TRUE(std::isnan(
+        static_cast<float>(Half{std::numeric_limits<float>::quiet_NaN()})
+    ));
+
+    // Within the normal range, the relative error is at most 2^-11.
+    for (const auto& vector : make_vectors(60'000.0F)) {
+        for (size_t i = 0; i < 3; ++i) {
+            const auto value = vector[i];
+            const auto decoded = static_cast<float>(Half{value});
+            EXPECT_LE(std::abs(decoded - value), std::abs(value) * 0x1P-11F)
+                << value;
+        }
+    }
+}
+
+TEST(Packed, Snorm) {
+    EXPECT_EQ(Snorm16{1.0F}.get_bits(), 32767);
+    EXPECT_EQ(Snorm16{-1.0F}.get_bits(), -32767);
+    EXPECT_EQ(Snorm16{0.0F}.get_bits(), 0);
+    EXPECT_EQ(Snorm8{2.0F}.get_bits(), 127);
+    EXPECT_EQ(Snorm8{-0.5F}.get_bits(), -64);
+    EXPECT_EQ(Snorm8{std::numeric_limits<float>::quiet_NaN()}.get_bits(), -127);
+
+    EXPECT_EQ(static_cast<float>(Snorm16::from_bits(-32768)), -1.0F);
+    EXPECT_EQ(static_cast<float>(Snorm8::from_bits(127)), 1.0F);
+    EXPECT_EQ(static_cast<float>(Snorm8::from_bits(0)), 0.0F);
+
+    // Quantizing to a step of 1 / 32767 loses at most half a step.
+    for (const auto& vector : make_vectors(1.0F)) {
+        const auto decoded = decode(encode<Snorm16>(vector));
+        for (size_t i = 0; i < 3; ++i) {
+            EXPECT_NEAR(decoded[i], vector[i], 0.5F / 32767.0F + 1e-7F);
+        }
+    }
+}
+
+TEST(Packed, OctahedralNormal) {
+    const auto axes = std::vector<Vector3f>{
+        {1, 0, 0}, {-1, 0, 0}, {0, 1, 0}, {0, -1, 0}, {0, 0, 1}, {0, 0, -1}
+    };
+    for (const auto& axis : axes) {
+        EXPECT_EQ(OctahedralNormal{axis}.to_vector(), axis);
+    }
+
+    const auto zero = Vector3f{0, 0, 0};
+    EXPECT_EQ(OctahedralNormal{zero}.to_vector(), axes[4]);
+    EXPECT_EQ(OctahedralNormal::from_bits(0).to_vector(), axes[4]);
+
+    // The direction survives, the length does not.
+    for (const auto& vector : make_vectors(10.0F)) {
+        const auto expected = vector.normalized();
+        const auto decoded = OctahedralNormal{vector}.to_vector();
+
+        EXPECT_NEAR(decoded.length(), 1.0F, 1e-6F);
+        for (size_t i = 0; i < 3; ++i) {
+            EXPECT_NEAR(decoded[i], expected[i], 1e-4F);
+        }
+    }
+}
+
+TEST(Packed, Batches) {
+    expect_batches_match_scalar<Half>(make_vectors(100.0F));
+    expect_batches_match_scalar<Snorm8>(make_vectors(1.5F));
+    expect_batches_match_scalar<Snorm16>(make_vectors(1.5F));
+
+    const auto vectors = make_vectors(1.0F);
+    const auto in = std::span<const Vector3f>{vectors};
+
+    auto normals = std::vector<OctahedralNormal>(vectors.size());
+    encode(vectors, std::span{normals});
+
+    auto normals_from_batch = std::vector<OctahedralNormal>(vectors.size());
+    encode(VectorBatch<float, 3>{in}, std::span{normals_from_batch});
+
+    auto decoded = std::vector<Vector3f>(vectors.size());
+    decode(normals, std::span{decoded});
+
+    auto decoded_batch = VectorBatch<float, 3>{};
+    decode(normals, decoded_batch);
+
+    for (size_t i = 0; i < vectors.size(); ++i) {
+        const auto expected = OctahedralNormal{vectors[i]};
+        EXPECT_EQ(normals[i], expected);
+        EXPECT_EQ(normals_from_batch[i], expected);
+        EXPECT_EQ(decoded[i], expected.to_vector());
+        EXPECT_EQ(decoded_batch.get(i), decoded[i]);
+    }
+
+    auto short_out = std::vector<Vector<Half, 3>>(vectors.size() - 1);
+    EXPECT_THROW(encode(in, std::span{short_out}), std::invalid_argument);
+    EXPECT_THROW(
+        decode(normals, std::span{decoded}.subspan(1)), std::invalid_argument
+    );
+}
@@ -0,0 +1,143 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <format>
+#include <limits>
+
+#include <TestUtils.hpp>
+#include <LuminolMaths/Precision.hpp>
+#include <LuminolMaths/Transform.hpp>
+#include <LuminolMaths/Vector.hpp>
+
+using namespace Luminol::Maths;
+
+namespace {
+
+template <std::floating_point T>
+struct PrecisionTests : public ::testing::Test {
+    using Radians = Luminol::Units::Angle<T, Luminol::Units::Radian>;
+
+    /// Returns the distance between the value and the reference in ULP of
+    /// the reference, or of 1 when the reference is close to zero.
+    [[nodiscard]] static auto ulp_error(T value, long double reference)
+        -> long double {
+        const auto magnitude = std::max(std::fabs(reference), 1.0L);
+        const auto rounded = static_cast<T>(magnitude);
+        const auto ulp = static_cast<long double>(
+            std::nextafter(rounded, std::numeric_limits<T>::infinity()) -
+            rounded
+        );
+        return std::fabs(static_cast<long double>(value) - reference) / ulp;
+    }
+
+    /// Returns the distance between the value and the reference in ULP of
+    /// the reference.
+    [[nodiscard]] static auto relative_ulp_error(T value, long double reference)
+        -> long double {
+        const auto rounded = static_cast<T>(reference);
+        const auto ulp = static_cast<long double>(
+            std::nextafter(rounded, std::numeric_limits<T>::infinity()) -
+            rounded
+        );
+        return std::fabs(static_cast<long double>(value) - reference) / ulp;
+    }
+};
+
+using PrecisionStorageTypes = ::testing::Types<float, double>;
+
+TYPED_TEST_SUITE(PrecisionTests, PrecisionStorageTypes);
+
+}  // namespace
+
+TYPED_TEST(PrecisionTests, ReciprocalSquareRoot) {
+    for (auto value = TypeParam{1e-6}; value < TypeParam{1e6};
+         value *= TypeParam{1.37}) {
+        const auto reference =
+            1.0L / std::sqrt(static_cast<long double>(value));
+
+        EXPECT_LE(
+            TestFixture::relative_ulp_error(FastMath::rsqrt(value), reference),
+            4.0L
+        ) << std::format("rsqrt({}) is out of bounds", value);
+    }
+
+    constexpr auto constant = FastMath::rsqrt(TypeParam{16});
+    static_assert(constant > TypeParam{0.2499} && constant < TypeParam{0.2501});
+}
+
+TYPED_TEST(PrecisionTests, SinCos) {
+    for (auto angle = TypeParam{-10000}; angle < TypeParam{10000};
+         angle += TypeParam{0.917}) {
+        const auto [sin, cos] = FastMath::sin_cos(angle);
+        const auto precise = static_cast<long double>(angle);
+
+        EXPECT_LE(TestFixture::ulp_error(sin, std::sin(precise)), 1.0L)
+            << std::format("sin({}) is out of bounds", angle);
+        EXPECT_LE(TestFixture::ulp_error(cos, std::cos(precise)), 1.0L)
+            << std::format("cos({}) is out of bounds", angle);
+    }
+
+    constexpr auto constant = FastMath::sin_cos(TypeParam{0});
+    static_assert(constant.sin == TypeParam{0} && constant.cos == TypeParam{1});
+}
+
+TYPED_TEST(PrecisionTests, FastNormalized) {
+    const auto vectors = std::array{
+        Vector<TypeParam, 3>{3, 4, 12},
+        Vector<TypeParam, 3>{-1e-3, 2e-3, 5e-4},
+        Vector<TypeParam, 3>{250, -10, 75},
+    };
+
+    for (const auto& vector : vectors) {
+        const auto exact = vector.normalized();
+        const auto fast = vector.template normalized<Precision::Fast>();
+
+        for (size_t i = 0; i < 3; ++i) {
+            EXPECT_NEAR(fast[i], exact[i], TypeParam{1e-6}) << std::format(
+                "Component {} of ({}, {}, {}) normalized differs",
+                i,
+                vector.x(),
+                vector.y(),
+                vector.z()
+            );
+        }
+    }
+
+    const auto zero = Vector<TypeParam, 4>{};
+    EXPECT_EQ(zero.template normalized<Precision::Fast>(), zero);
+}
+
+TYPED_TEST(PrecisionTests, FastRotations) {
+    using Radians = typename TestFixture::Radians;
+
+    for (const auto value : {TypeParam{-3}, TypeParam{0.25}, TypeParam{2.5}}) {
+        const auto angle = Radians{value};
+        const auto message = std::format("Rotation by {} differs", value);
+
+        Luminol::TestUtils::expect_matrix_nearly_equal(
+            Transform::rotate_2x2<TypeParam, Precision::Fast>(angle),
+            Transform::rotate_2x2<TypeParam>(angle),
+            TypeParam{1e-6},
+            message
+        );
+        Luminol::TestUtils::expect_matrix_nearly_equal(
+            Transform::rotate_x<TypeParam, 4, Precision::Fast>(angle),
+            Transform::rotate_x<TypeParam, 4>(angle),
+            TypeParam{1e-6},
+            message
+        );
+        Luminol::TestUtils::expect_matrix_nearly_equal(
+            Transform::rotate_y<TypeParam, 3, Precision::Fast>(angle),
+            Transform::rotate_y<TypeParam, 3>(angle),
+            TypeParam{1e-6},
+            message
+        );
+        Luminol::TestUtils::expect_matrix_nearly_equal(
+            Transform::rotate_z<TypeParam, 4, Precision::Fast>(angle),
+            Transform::rotate_z<TypeParam, 4>(angle),
+            TypeParam{1e-6},
+            message
+        );
+    }
+}
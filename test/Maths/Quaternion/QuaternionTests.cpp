@@ -0,0 +1,233 @@
+#include <gtest/gtest.h>
+
+#include <array>
+#include <format>
+#include <vector>
+
+#include <TestUtils.hpp>
+#include <LuminolMaths/Quaternion.hpp>
+#include <LuminolMaths/Transform.hpp>
+
+using namespace Luminol::Maths;
+
+namespace {
+
+template <std::floating_point T>
+struct QuaternionTests : public ::testing::Test {
+    using Radians = Luminol::Units::Angle<T, Luminol::Units::Radian>;
+
+    constexpr static auto epsilon = T{1e-5};
+
+    [[nodiscard]] static auto make_rotation(T angle) -> Quaternion<T> {
+        const auto axis = Vector<T, 3>{1, -2, 3}.normalized();
+        return Quaternion<T>::from_axis_angle(axis, Radians{angle});
+    }
+
+    /// Multiplies the row vector by the matrix.
+    [[nodiscard]] static auto multiply(
+        const Vector<T, 3>& vector, const Matrix<T, 3, 3>& matrix
+    ) -> Vector<T, 3> {
+        auto result = Vector<T, 3>{};
+        for (size_t j = 0; j < 3; ++j) {
+            for (size_t k = 0; k < 3; ++k) {
+                result[j] += vector[k] * matrix[k].at(j);
+            }
+        }
+        return result;
+    }
+
+    static auto expect_near(
+        const Vector<T, 3>& value,
+        const Vector<T, 3>& expected,
+        const std::string& message
+    ) -> void {
+        for (size_t i = 0; i < 3; ++i) {
+            EXPECT_NEAR(value[i], expected[i], epsilon) << message;
+        }
+    }
+
+    /// Quaternions q and -q are the same rotation.
+    static auto expect_same_rotation(
+        const Quaternion<T>& value,
+        const Quaternion<T>& expected,
+        const std::string& message
+    ) -> void {
+        EXPECT_NEAR(std::abs(value.dot(expected)), T{1}, epsilon) << message;
+    }
+};
+
+using QuaternionStorageTypes = ::testing::Types<float, double>;
+
+TYPED_TEST_SUITE(QuaternionTests, QuaternionStorageTypes);
+
+}  // namespace
+
+TYPED_TEST(QuaternionTests, MatchesAxisRotations) {
+    using T = TypeParam;
+    using Radians = typename TestFixture::Radians;
+
+    const auto angle = Radians{T{0.8}};
+
+    const auto cases = std::array{
+        std::pair{Vector<T, 3>{1, 0, 0}, Transform::rotate_x<T, 3>(angle)},
+        std::pair{Vector<T, 3>{0, 1, 0}, Transform::rotate_y<T, 3>(angle)},
+        std::pair{Vector<T, 3>{0, 0, 1}, Transform::rotate_z<T, 3>(angle)},
+    };
+
+    for (size_t i = 0; i < cases.size(); ++i) {
+        const auto& [axis, expected] = cases.at(i);
+
+        Luminol::TestUtils::expect_matrix_nearly_equal(
+            Quaternion<T>::from_axis_angle(axis, angle).to_matrix_3x3(),
+            expected,
+            TestFixture::epsilon,
+            std::format("Rotation around axis {} differs", i)
+        );
+    }
+}
+
+TYPED_TEST(QuaternionTests, MatrixRoundTrip) {
+    // Covers the trace branch and each of the diagonal branches
+    for (const auto angle : {0.3, 2.5, 3.1, -2.9}) {
+        const auto rotation =
+            TestFixture::make_rotation(static_cast<TypeParam>(angle));
+
+        TestFixture::expect_same_rotation(
+            Quaternion<TypeParam>::from_matrix(rotation.to_matrix_3x3()),
+            rotation,
+            std::format("3x3 round trip of angle {} differs", angle)
+        );
+        TestFixture::expect_same_rotation(
+            Quaternion<TypeParam>::from_matrix(rotation.to_matrix_4x4()),
+            rotation,
+            std::format("4x4 round trip of angle {} differs", angle)
+        );
+    }
+}
+
+TYPED_TEST(QuaternionTests, AxisAngleRoundTrip) {
+    const auto axis = Vector<TypeParam, 3>{1, -2, 3}.normalized();
+    const auto [result_axis, result_angle] =
+        TestFixture::make_rotation(TypeParam{1.2}).to_axis_angle();
+
+    TestFixture::expect_near(result_axis, axis, "Axis differs");
+    EXPECT_NEAR(result_angle.get_value(), TypeParam{1.2}, TestFixture::epsilon);
+
+    const auto [identity_axis, identity_angle] =
+        Quaternion<TypeParam>::identity().to_axis_angle();
+    EXPECT_EQ(identity_angle.get_value(), TypeParam{0});
+    EXPECT_EQ(identity_axis, (Vector<TypeParam, 3>{1, 0, 0}));
+}
+
+TYPED_TEST(QuaternionTests, RotateAndCompose) {
+    const auto first = TestFixture::make_rotation(TypeParam{0.7});
+    const auto second = Quaternion<TypeParam>::from_axis_angle(
+        Vector<TypeParam, 3>{0, 1, 0}, typename TestFixture::Radians{-1.9}
+    );
+
+    const auto vector = Vector<TypeParam, 3>{0.5, -4, 2};
+
+    TestFixture::expect_near(
+        first.rotate(vector),
+        TestFixture::multiply(vector, first.to_matrix_3x3()),
+        "Rotated vector differs from the matrix product"
+    );
+
+    TestFixture::expect_near(
+        (first * second).rotate(vector),
+        second.rotate(first.rotate(vector)),
+        "Composition does not apply the left rotation first"
+    );
+
+    Luminol::TestUtils::expect_matrix_nearly_equal(
+        (first * second).to_matrix_3x3(),
+        first.to_matrix_3x3() * second.to_matrix_3x3(),
+        TestFixture::epsilon,
+        "Composition differs from the matrix product"
+    );
+
+    TestFixture::expect_near(
+        (first * first.inverse()).rotate(vector),
+        vector,
+        "Rotation times its inverse is not the identity"
+    );
+}
+
+TYPED_TEST(QuaternionTests, Interpolation) {
+    using T = TypeParam;
+
+    const auto axis = Vector<T, 3>{0, 0, 1};
+    const auto from = Quaternion<T>::from_axis_angle(
+        axis, typename TestFixture::Radians{0.2}
+    );
+    const auto to = Quaternion<T>::from_axis_angle(
+        axis, typename TestFixture::Radians{1.4}
+    );
+
+    TestFixture::expect_same_rotation(slerp(from, to, T{0}), from, "t = 0");
+    TestFixture::expect_same_rotation(slerp(from, to, T{1}), to, "t = 1");
+
+    // Slerp moves at constant angular speed around the shared axis
+    const auto quarter = slerp(from, to, T{0.25}).to_axis_angle();
+    EXPECT_NEAR(quarter.angle.get_value(), T{0.5}, TestFixture::epsilon);
+
+    // Both interpolations take the shortest path when the signs differ
+    TestFixture::expect_same_rotation(
+        slerp(from, -to, T{0.5}), slerp(from, to, T{0.5}), "Slerp sign"
+    );
+    TestFixture::expect_same_rotation(
+        nlerp(from, -to, T{0.5}), slerp(from, to, T{0.5}), "Nlerp midpoint"
+    );
+}
+
+TYPED_TEST(QuaternionTests, Batches) {
+    using T = TypeParam;
+
+    constexpr auto count = size_t{9};
+
+    auto from = std::vector<Quaternion<T>>{};
+    auto to = std::vector<Quaternion<T>>{};
+    auto factors = std::vector<T>{};
+    auto vectors = std::vector<Vector<T, 3>>{};
+
+    for (size_t i = 0; i < count; ++i) {
+        const auto value = static_cast<T>(i);
+        from.push_back(TestFixture::make_rotation(value * T{0.3}));
+        to.push_back(TestFixture::make_rotation(T{2} - value * T{0.4}));
+        factors.push_back(value / static_cast<T>(count));
+        vectors.emplace_back(value, T{1} - value, T{2});
+    }
+
+    auto shared = std::vector<Quaternion<T>>(count, Quaternion<T>::identity());
+    slerp(from, to, T{0.3}, shared);
+
+    auto individual =
+        std::vector<Quaternion<T>>(count, Quaternion<T>::identity());
+    slerp(from, to, factors, individual);
+
+    auto rotated = std::vector<Vector<T, 3>>(count);
+    rotate(from[1], vectors, rotated);
+
+    auto rotated_each = std::vector<Vector<T, 3>>(count);
+    rotate<T>(from, vectors, rotated_each);
+
+    for (size_t i = 0; i < count; ++i) {
+        const auto message = std::format("Batch element {} differs", i);
+
+        EXPECT_EQ(shared[i], slerp(from[i], to[i], T{0.3})) << message;
+        EXPECT_EQ(individual[i], slerp(from[i], to[i], factors[i]))
+            << message;
+
+        TestFixture::expect_near(
+            rotated[i], from[1].rotate(vectors[i]), message
+        );
+        TestFixture::expect_near(
+            rotated_each[i], from[i].rotate(vectors[i]), message
+        );
+    }
+
+    auto too_short = std::vector<Quaternion<T>>(count - 1, from[0]);
+    EXPECT_THROW(
+        slerp(from, to, T{0.5}, too_short), std::invalid_argument
+    );
+}
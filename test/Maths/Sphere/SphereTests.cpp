@@ -0,0 +1,257 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstdint>
+#include <format>
+#include <numbers>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+#include <TestUtils.hpp>
+#include <LuminolMaths/Sphere.hpp>
+#include <LuminolMaths/TransformTrs.hpp>
+
+using namespace Luminol::Maths;
+
+namespace {
+
+template <std::floating_point T>
+struct SphereTests : public ::testing::Test {
+    using Radians = Luminol::Units::Angle<T, Luminol::Units::Radian>;
+
+    /// Not a multiple of 64, so the last word of the mask is partial.
+    constexpr static auto count = size_t{100};
+
+    constexpr static auto epsilon = T{1e-4};
+
+    [[nodiscard]] static auto make_sphere(size_t index) -> Sphere<T> {
+        return Sphere<T>{
+            {
+                static_cast<T>(index * 7 % 23) - T{11},
+                static_cast<T>(index * 5 % 17) - T{8},
+                static_cast<T>(index * 3 % 13) - T{6},
+            },
+            static_cast<T>(index % 4) + T{0.5},
+        };
+    }
+
+    [[nodiscard]] static auto make_transform() -> Matrix<T, 4, 4> {
+        return Transform::trs<Precision::Exact, T>(
+            {3, -2, 5},
+            {Radians{T{0.4}}, Radians{T{-1.1}}, Radians{T{2.3}}},
+            {2, 0.5, 1.5}
+        );
+    }
+
+    /// Whether `outer` contains `inner` up to the rounding of the merges.
+    [[nodiscard]] static auto nearly_contains(
+        const Sphere<T>& outer, const Sphere<T>& inner
+    ) -> bool {
+        return Sphere<T>{outer.center(), outer.radius() + epsilon}.contains(
+            inner
+        );
+    }
+};
+
+using SphereStorageTypes = ::testing::Types<float, double>;
+
+TYPED_TEST_SUITE(SphereTests, SphereStorageTypes);
+
+}  // namespace
+
+TYPED_TEST(SphereTests, Empty) {
+    const auto empty = Sphere<TypeParam>{};
+    const auto sphere = Sphere<TypeParam>{{1, 2, 3}, 2};
+
+    EXPECT_TRUE(empty.is_empty());
+    EXPECT_FALSE(sphere.is_empty());
+    EXPECT_FALSE(empty.contains(Vector<TypeParam, 3>{}));
+    EXPECT_FALSE(empty.overlaps(sphere));
+    EXPECT_FALSE(sphere.overlaps(empty));
+    EXPECT_TRUE(sphere.contains(empty));
+    EXPECT_EQ(empty.merged(sphere), sphere);
+    EXPECT_EQ(sphere.merged(empty), sphere);
+    EXPECT_TRUE(empty.bounds().is_empty());
+    EXPECT_TRUE(empty.transformed(TestFixture::make_transform()).is_empty());
+}
+
+TYPED_TEST(SphereTests, ContainsAndOverlaps) {
+    const auto sphere = Sphere<TypeParam>{{0, 0, 0}, 2};
+
+    EXPECT_TRUE(sphere.contains(Vector<TypeParam, 3>{1, 1, 1}));
+    EXPECT_TRUE(sphere.contains(Vector<TypeParam, 3>{0, 2, 0}));
+    EXPECT_FALSE(sphere.contains(Vector<TypeParam, 3>{1.5, 1.5, 0}));
+
+    EXPECT_TRUE(sphere.contains(Sphere<TypeParam>{{1, 0, 0}, 1}));
+    EXPECT_FALSE(sphere.contains(Sphere<TypeParam>{{1, 0, 0}, 1.5}));
+
+    EXPECT_TRUE(sphere.overlaps(Sphere<TypeParam>{{3, 0, 0}, 1}));
+    EXPECT_FALSE(sphere.overlaps(Sphere<TypeParam>{{3, 0, 0}, 0.5}));
+
+    EXPECT_TRUE(sphere.overlaps(AABB<TypeParam>{{1, 1, -1}, {3, 3, 1}}));
+    EXPECT_FALSE(sphere.overlaps(AABB<TypeParam>{{1.5, 1.5, -1}, {3, 3, 1}}));
+    EXPECT_TRUE(sphere.overlaps(AABB<TypeParam>{{-5, -5, -5}, {5, 5, 5}}));
+}
+
+TYPED_TEST(SphereTests, Bounds) {
+    const auto sphere = Sphere<TypeParam>{{1, -2, 3}, 2};
+    EXPECT_EQ(sphere.bounds(), (AABB<TypeParam>{{-1, -4, 1}, {3, 0, 5}}));
+
+    const auto box = AABB<TypeParam>{{-1, -2, -2}, {1, 2, 2}};
+    const auto circumscribed = Sphere<TypeParam>::from_box(box);
+    EXPECT_EQ(circumscribed.center(), (Vector<TypeParam, 3>{}));
+    EXPECT_NEAR(circumscribed.radius(), TypeParam{3}, TestFixture::epsilon);
+}
+
+TYPED_TEST(SphereTests, FromPoints) {
+    const auto points = std::vector<Vector<TypeParam, 3>>{
+        {1, -2, 0}, {-3, 4, 1}, {2, 0, -5}, {0, 0, 0}
+    };
+
+    const auto sphere = Sphere<TypeParam>::from_points(points);
+    const auto padded = Sphere<TypeParam>{
+        sphere.center(), sphere.radius() + TestFixture::epsilon
+    };
+    for (const auto& point : points) {
+        EXPECT_TRUE(padded.contains(point));
+    }
+    EXPECT_TRUE(Sphere<TypeParam>::from_points({}).is_empty());
+}
+
+TYPED_TEST(SphereTests, Merge) {
+    const auto lhs = Sphere<TypeParam>{{0, 0, 0}, 1};
+    const auto rhs = Sphere<TypeParam>{{4, 0, 0}, 2};
+
+    const auto merged = lhs.merged(rhs);
+    EXPECT_NEAR(merged.radius(), TypeParam{3.5}, TestFixture::epsilon);
+    EXPECT_NEAR(merged.center().x(), TypeParam{2.5}, TestFixture::epsilon);
+    EXPECT_EQ(lhs.merged(Sphere<TypeParam>{{0.5, 0, 0}, 0.25}), lhs);
+
+    auto spheres = std::vector<Sphere<TypeParam>>{};
+    for (size_t i = 0; i < TestFixture::count; ++i) {
+        spheres.push_back(TestFixture::make_sphere(i));
+    }
+
+    const auto all = merge(spheres);
+    for (size_t i = 0; i < spheres.size(); ++i) {
+        EXPECT_TRUE(TestFixture::nearly_contains(all, spheres[i]))
+            << std::format("Sphere {} is not contained", i);
+    }
+    const auto none = std::span<const Sphere<TypeParam>>{};
+    EXPECT_TRUE(merge(none).is_empty());
+}
+
+TYPED_TEST(SphereTests, Transformed) {
+    const auto matrix = TestFixture::make_transform();
+    const auto sphere = Sphere<TypeParam>{{1, -2, 3}, 1.5};
+
+    const auto transformed = sphere.transformed(matrix);
+    const auto center = Vector<TypeParam, 4>{1, -2, 3, 1} * matrix;
+
+    for (size_t i = 0; i < 3; ++i) {
+        EXPECT_NEAR(transformed.center()[i], center[i], TestFixture::epsilon);
+    }
+    // The largest scale factor of the matrix is 2.
+    EXPECT_NEAR(transformed.radius(), TypeParam{3}, TestFixture::epsilon);
+}
+
+TYPED_TEST(SphereTests, TransformedRotateThenScale) {
+    using T = TypeParam;
+    using Radians = typename TestFixture::Radians;
+
+    // A rotation followed by a non-uniform scale, as in the world matrix of
+    // a scaled child under a rotated parent. No row of the matrix is longer
+    // than sqrt(2.5), yet the point (c, -c, 0) is stretched to a length of 2.
+    const auto matrix =
+        Transform::rotate_z<T, 4>(Radians{std::numbers::pi_v<T> / T{4}}) *
+        Transform::scale_4x4<T>({2, 1, 1});
+    const auto sphere = Sphere<T>{{0, 0, 0}, 1};
+
+    const auto transformed = sphere.transformed(matrix);
+    EXPECT_NEAR(transformed.radius(), T{2}, TestFixture::epsilon);
+
+    constexpr auto steps = size_t{16};
+    for (size_t i = 0; i < steps; ++i) {
+        for (size_t j = 0; j <= steps; ++j) {
+            const auto azimuth = T{2} * std::numbers::pi_v<T> *
+                                 static_cast<T>(i) / static_cast<T>(steps);
+            const auto polar = std::numbers::pi_v<T> * static_cast<T>(j) /
+                               static_cast<T>(steps);
+            const auto point = Vector<T, 4>{
+                std::sin(polar) * std::cos(azimuth),
+                std::sin(polar) * std::sin(azimuth),
+                std::cos(polar),
+                1,
+            } * matrix;
+
+            const auto grown = Sphere<T>{
+                transformed.center(),
+                transformed.radius() + TestFixture::epsilon,
+            };
+            EXPECT_TRUE(
+                grown.contains(Vector<T, 3>{point.x(), point.y(), point.z()})
+            ) << std::format("Surface point {}, {} is outside", i, j);
+        }
+    }
+}
+
+TYPED_TEST(SphereTests, Batches) {
+    const auto matrix = TestFixture::make_transform();
+    const auto probe = Sphere<TypeParam>{{-1, 1, 0}, 6};
+
+    auto spheres = std::vector<Sphere<TypeParam>>{};
+    auto points = std::vector<Vector<TypeParam, 3>>{};
+    for (size_t i = 0; i < TestFixture::count; ++i) {
+        spheres.push_back(TestFixture::make_sphere(i));
+        points.push_back(spheres.back().center());
+    }
+
+    auto transformed = std::vector<Sphere<TypeParam>>(TestFixture::count);
+    transform<TypeParam>(matrix, spheres, transformed);
+
+    auto inside =
+        std::vector<uint64_t>(BitMask::word_count(TestFixture::count));
+    contains<TypeParam>(probe, points, inside);
+
+    auto overlapping =
+        std::vector<uint64_t>(BitMask::word_count(TestFixture::count));
+    overlaps<TypeParam>(probe, spheres, overlapping);
+
+    auto inside_count = size_t{0};
+    auto overlapping_count = size_t{0};
+    for (size_t i = 0; i < TestFixture::count; ++i) {
+        EXPECT_EQ(transformed[i], spheres[i].transformed(matrix));
+        EXPECT_EQ(BitMask::test(inside, i), probe.contains(points[i]))
+            << std::format("Point {} is misclassified", i);
+        EXPECT_EQ(BitMask::test(overlapping, i), probe.overlaps(spheres[i]))
+            << std::format("Sphere {} is misclassified", i);
+
+        inside_count += probe.contains(points[i]) ? 1 : 0;
+        overlapping_count += probe.overlaps(spheres[i]) ? 1 : 0;
+    }
+
+    EXPECT_GT(inside_count, size_t{0});
+    EXPECT_LT(inside_count, TestFixture::count);
+    EXPECT_GT(overlapping_count, inside_count);
+    EXPECT_LT(overlapping_count, TestFixture::count);
+}
+
+TYPED_TEST(SphereTests, SizeMismatch) {
+    const auto matrix = TestFixture::make_transform();
+    const auto spheres = std::vector<Sphere<TypeParam>>(65);
+    const auto points = std::vector<Vector<TypeParam, 3>>(65);
+
+    auto out = std::vector<Sphere<TypeParam>>(64);
+    auto mask = std::vector<uint64_t>(1);
+
+    EXPECT_THROW(
+        transform<TypeParam>(matrix, spheres, out), std::invalid_argument
+    );
+    EXPECT_THROW(
+        contains<TypeParam>(spheres[0], points, mask), std::invalid_argument
+    );
+    EXPECT_THROW(
+        overlaps<TypeParam>(spheres[0], spheres, mask), std::invalid_argument
+    );
+}
@@ -0,0 +1,181 @@
+#include <gtest/gtest.h>
+
+#include <array>
+#include <format>
+#include <vector>
+
+#include <LuminolMaths/Transform.hpp>
+#include <LuminolMaths/TransformBatch.hpp>
+
+using namespace Luminol::Maths;
+
+namespace {
+
+template <std::floating_point T>
+struct TransformBatchTests : public ::testing::Test {
+    /// Not a multiple of the SIMD width, so the kernels also run their tails.
+    constexpr static auto count = size_t{11};
+
+    constexpr static auto epsilon = T{1e-4};
+
+    [[nodiscard]] static auto make_matrix() -> Matrix<T, 4, 4> {
+        return Transform::scale_4x4(Vector<T, 3>{2, 3, 4}) *
+               Transform::rotate_x<T, 4>(Luminol::Units::Angle<
+                                         T,
+                                         Luminol::Units::Radian>{T{0.5}}) *
+               Transform::rotate_z<T, 4>(Luminol::Units::Angle<
+                                         T,
+                                         Luminol::Units::Radian>{T{-1.25}}) *
+               Transform::translate_4x4(Vector<T, 3>{-1, 5, 7});
+    }
+
+    [[nodiscard]] static auto make_points() -> std::vector<Vector<T, 3>> {
+        auto points = std::vector<Vector<T, 3>>{};
+        for (size_t i = 0; i < count; ++i) {
+            const auto value = static_cast<T>(i);
+            points.emplace_back(value, T{1} - value, value * T{0.5});
+        }
+        return points;
+    }
+
+    /// Multiplies the row vector `[x, y, z, w]` by the matrix.
+    [[nodiscard]] static auto reference(
+        const Matrix<T, 4, 4>& matrix, const std::array<T, 4>& vector
+    ) -> std::array<T, 4> {
+        auto result = std::array<T, 4>{};
+        for (size_t j = 0; j < 4; ++j) {
+            for (size_t k = 0; k < 4; ++k) {
+                result.at(j) += vector.at(k) * matrix[k].at(j);
+            }
+        }
+        return result;
+    }
+
+    static auto expect_near(
+        const Vector<T, 3>& value,
+        const std::array<T, 4>& expected,
+        size_t index
+    ) -> void {
+        for (size_t j = 0; j < 3; ++j) {
+            EXPECT_NEAR(value[j], expected.at(j), epsilon)
+                << std::format("Component {} of vector {} differs", j, index);
+        }
+    }
+};
+
+using TransformBatchStorageTypes = ::testing::Types<float, double>;
+
+TYPED_TEST_SUITE(TransformBatchTests, TransformBatchStorageTypes);
+
+}  // namespace
+
+TYPED_TEST(TransformBatchTests, Points) {
+    const auto matrix = TestFixture::make_matrix();
+    const auto points = TestFixture::make_points();
+
+    auto out = std::vector<Vector<TypeParam, 3>>(points.size());
+    Transform::transform_points(matrix, points, out);
+
+    auto in_place = points;
+    Transform::transform_points(matrix, in_place);
+
+    for (size_t i = 0; i < points.size(); ++i) {
+        const auto& point = points[i];
+        const auto expected = TestFixture::reference(
+            matrix, {point.x(), point.y(), point.z(), TypeParam{1}}
+        );
+
+        TestFixture::expect_near(out[i], expected, i);
+        TestFixture::expect_near(in_place[i], expected, i);
+    }
+}
+
+TYPED_TEST(TransformBatchTests, Directions) {
+    const auto matrix = TestFixture::make_matrix();
+    const auto directions = TestFixture::make_points();
+
+    auto out = std::vector<Vector<TypeParam, 3>>(directions.size());
+    Transform::transform_directions(matrix, directions, out);
+
+    auto in_place = directions;
+    Transform::transform_directions(matrix, in_place);
+
+    for (size_t i = 0; i < directions.size(); ++i) {
+        const auto& direction = directions[i];
+        const auto expected = TestFixture::reference(
+            matrix, {direction.x(), direction.y(), direction.z(), TypeParam{0}}
+        );
+
+        TestFixture::expect_near(out[i], expected, i);
+        TestFixture::expect_near(in_place[i], expected, i);
+    }
+}
+
+TYPED_TEST(TransformBatchTests, HomogeneousVectors) {
+    const auto matrix = TestFixture::make_matrix();
+
+    auto vectors = std::vector<Vector<TypeParam, 4>>{};
+    for (const auto& point : TestFixture::make_points()) {
+        vectors.emplace_back(point.x(), point.y(), point.z(), point.x() - 2);
+    }
+
+    auto out = std::vector<Vector<TypeParam, 4>>(vectors.size());
+    Transform::transform_vectors(matrix, vectors, out);
+
+    for (size_t i = 0; i < vectors.size(); ++i) {
+        const auto& vector = vectors[i];
+        const auto expected = TestFixture::reference(
+            matrix, {vector.x(), vector.y(), vector.z(), vector.w()}
+        );
+
+        for (size_t j = 0; j < 4; ++j) {
+            EXPECT_NEAR(out[i][j], expected.at(j), TestFixture::epsilon)
+                << std::format("Component {} of vector {} differs", j, i);
+        }
+    }
+}
+
+TYPED_TEST(TransformBatchTests, Batches) {
+    const auto matrix = TestFixture::make_matrix();
+    const auto points = TestFixture::make_points();
+
+    const auto batch = VectorBatch<TypeParam, 3>{points};
+
+    auto out = VectorBatch<TypeParam, 3>{};
+    Transform::transform_points(matrix, batch, out);
+
+    auto directions = batch;
+    Transform::transform_directions(matrix, directions);
+
+    ASSERT_EQ(out.size(), points.size());
+
+    for (size_t i = 0; i < points.size(); ++i) {
+        const auto& point = points[i];
+
+        TestFixture::expect_near(
+            out.get(i),
+            TestFixture::reference(
+                matrix, {point.x(), point.y(), point.z(), TypeParam{1}}
+            ),
+            i
+        );
+        TestFixture::expect_near(
+            directions.get(i),
+            TestFixture::reference(
+                matrix, {point.x(), point.y(), point.z(), TypeParam{0}}
+            ),
+            i
+        );
+    }
+}
+
+TYPED_TEST(TransformBatchTests, SizeMismatch) {
+    const auto matrix = TestFixture::make_matrix();
+    const auto points = TestFixture::make_points();
+
+    auto out = std::vector<Vector<TypeParam, 3>>(points.size() - 1);
+
+    EXPECT_THROW(
+        Transform::transform_points(matrix, points, out), std::invalid_argument
+    );
+}
@@ -0,0 +1,181 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <format>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#include <TestUtils.hpp>
+#include <LuminolMaths/ExecutionStd.hpp>
+#include <LuminolMaths/TransformHierarchy.hpp>
+
+using namespace Luminol::Maths;
+
+namespace {
+
+template <std::floating_point T>
+struct TransformHierarchyTests : public ::testing::Test {
+    using Radians = Luminol::Units::Angle<T, Luminol::Units::Radian>;
+    using Local = typename TransformHierarchy<T>::Local;
+
+    constexpr static auto epsilon = T{1e-4};
+
+    [[nodiscard]] static auto make_local(size_t index) -> Local {
+        const auto value = static_cast<T>(index % 11);
+        const auto axis = Vector<T, 3>{T{1}, value - T{5}, T{2}}.normalized();
+
+        return Local{
+            .translation = {value - T{3}, T{0.5} * value, T{1}},
+            .rotation = Quaternion<T>::from_axis_angle(
+                axis, Radians{value * T{0.3}}
+            ),
+            .scale = {T{1}, T{1} + value * T{0.01}, T{0.9}},
+        };
+    }
+
+    [[nodiscard]] static auto to_matrix(const Local& local)
+        -> Matrix<T, 4, 4> {
+        return Transform::scale_4x4(local.scale) *
+               local.rotation.to_matrix_4x4() *
+               Transform::translate_4x4(local.translation);
+    }
+
+    /// Computes every world matrix from scratch, walking up to the root.
+    [[nodiscard]] static auto expected_world(
+        const TransformHierarchy<T>& hierarchy, uint32_t index
+    ) -> Matrix<T, 4, 4> {
+        auto world = to_matrix(hierarchy.local(index));
+        for (auto parent = hierarchy.parent(index);
+             parent != TransformHierarchy<T>::no_parent;
+             parent = hierarchy.parent(parent)) {
+            world = world * to_matrix(hierarchy.local(parent));
+        }
+        return world;
+    }
+
+    static auto expect_worlds(const TransformHierarchy<T>& hierarchy)
+        -> void {
+        for (uint32_t i = 0; i < hierarchy.size(); ++i) {
+            Luminol::TestUtils::expect_matrix_nearly_equal(
+                hierarchy.world(i),
+                expected_world(hierarchy, i),
+                epsilon,
+                std::format("Node {}", i)
+            );
+        }
+    }
+
+    /// A random forest where every node picks one of the earlier nodes, or
+    /// no parent, as its parent.
+    [[nodiscard]] static auto make_forest(size_t count)
+        -> TransformHierarchy<T> {
+        auto generator = std::mt19937{1};
+        auto hierarchy = TransformHierarchy<T>{};
+        hierarchy.reserve(count);
+
+        for (size_t i = 0; i < count; ++i) {
+            auto parent = TransformHierarchy<T>::no_parent;
+            if (i % 50 != 0) {
+                parent = static_cast<uint32_t>(generator() % i);
+            }
+            hierarchy.add(make_local(i), parent);
+        }
+        return hierarchy;
+    }
+};
+
+using TransformHierarchyStorageTypes = ::testing::Types<float, double>;
+
+TYPED_TEST_SUITE(TransformHierarchyTests, TransformHierarchyStorageTypes);
+
+}  // namespace
+
+TYPED_TEST(TransformHierarchyTests, Update) {
+    auto hierarchy = TransformHierarchy<TypeParam>{};
+
+    const auto root = hierarchy.add(TestFixture::make_local(1));
+    const auto child = hierarchy.add(TestFixture::make_local(2), root);
+    const auto grandchild = hierarchy.add(TestFixture::make_local(3), child);
+    const auto other_root = hierarchy.add(TestFixture::make_local(4));
+    const auto sibling = hierarchy.add(TestFixture::make_local(5), root);
+
+    EXPECT_EQ(hierarchy.size(), size_t{5});
+    EXPECT_EQ(hierarchy.parent(grandchild), child);
+    EXPECT_EQ(
+        hierarchy.parent(other_root), TransformHierarchy<TypeParam>::no_parent
+    );
+
+    EXPECT_EQ(hierarchy.update(), size_t{5});
+    TestFixture::expect_worlds(hierarchy);
+    EXPECT_EQ(hierarchy.update(), size_t{0});
+
+    // Moving a node recomputes its subtree only.
+    hierarchy.set_translation(child, {4, -2, 1});
+    EXPECT_EQ(hierarchy.update(), size_t{2});
+    TestFixture::expect_worlds(hierarchy);
+
+    hierarchy.set_rotation(root, Quaternion<TypeParam>::identity());
+    hierarchy.set_scale(sibling, {2, 2, 2});
+    EXPECT_EQ(hierarchy.update(), size_t{4});
+    TestFixture::expect_worlds(hierarchy);
+
+    hierarchy.set_local(other_root, TestFixture::make_local(9));
+    EXPECT_EQ(hierarchy.update(), size_t{1});
+    TestFixture::expect_worlds(hierarchy);
+
+    hierarchy.invalidate();
+    EXPECT_EQ(hierarchy.update(), size_t{5});
+    EXPECT_EQ(hierarchy.world_matrices().size(), size_t{5});
+}
+
+TYPED_TEST(TransformHierarchyTests, ParallelUpdate) {
+    constexpr auto count = size_t{5000};
+
+    auto serial = TestFixture::make_forest(count);
+    auto parallel = TestFixture::make_forest(count);
+    auto pool = Execution::ThreadPool{4};
+
+    EXPECT_EQ(serial.update(), count);
+    EXPECT_EQ(parallel.update(pool), count);
+
+    // Moves one node in twenty, as a typical frame does.
+    for (uint32_t i = 0; i < count; i += 20) {
+        const auto translation = Vector<TypeParam, 3>{
+            static_cast<TypeParam>(i % 13), TypeParam{1}, TypeParam{-2}
+        };
+        serial.set_translation(i, translation);
+        parallel.set_translation(i, translation);
+    }
+
+    const auto updated = serial.update();
+    EXPECT_GT(updated, count / 20);
+    EXPECT_LT(updated, count);
+    EXPECT_EQ(parallel.update(pool), updated);
+    EXPECT_EQ(parallel.update(std::execution::par_unseq), size_t{0});
+
+    for (uint32_t i = 0; i < count; ++i) {
+        ASSERT_EQ(parallel.world(i), serial.world(i))
+            << std::format("Node {}", i);
+    }
+    TestFixture::expect_worlds(parallel);
+}
+
+TYPED_TEST(TransformHierarchyTests, InvalidIndices) {
+    auto hierarchy = TransformHierarchy<TypeParam>{};
+    const auto root = hierarchy.add({});
+
+    EXPECT_THROW(hierarchy.add({}, root + 1), std::out_of_range);
+    EXPECT_THROW((void)hierarchy.world(root + 1), std::out_of_range);
+    EXPECT_THROW((void)hierarchy.local(root + 1), std::out_of_range);
+    EXPECT_THROW((void)hierarchy.parent(root + 1), std::out_of_range);
+    EXPECT_THROW(hierarchy.set_local(root + 1, {}), std::out_of_range);
+    EXPECT_THROW(
+        hierarchy.set_translation(root + 1, {1, 2, 3}), std::out_of_range
+    );
+    EXPECT_THROW(
+        hierarchy.set_rotation(root + 1, Quaternion<TypeParam>::identity()),
+        std::out_of_range
+    );
+    EXPECT_THROW(hierarchy.set_scale(root + 1, {1, 1, 1}), std::out_of_range);
+}
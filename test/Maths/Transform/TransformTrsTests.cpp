@@ -0,0 +1,169 @@
+#include <gtest/gtest.h>
+
+#include <format>
+#include <vector>
+
+#include <TestUtils.hpp>
+#include <LuminolMaths/TransformTrs.hpp>
+
+using namespace Luminol::Maths;
+
+namespace {
+
+template <std::floating_point T>
+struct TransformTrsTests : public ::testing::Test {
+    using Radians = Luminol::Units::Angle<T, Luminol::Units::Radian>;
+
+    /// Not a multiple of the block size, so the batches also run a tail.
+    constexpr static auto count = size_t{75};
+
+    constexpr static auto epsilon = T{1e-5};
+
+    [[nodiscard]] static auto make_translation(size_t index) -> Vector<T, 3> {
+        const auto value = static_cast<T>(index);
+        return {value - T{3}, T{2} * value, T{0.5} - value};
+    }
+
+    [[nodiscard]] static auto make_angles(size_t index) -> Vector<T, 3> {
+        const auto value = static_cast<T>(index) * T{0.37};
+        return {value - T{4}, T{1.5} - value, value * T{0.5}};
+    }
+
+    [[nodiscard]] static auto make_scale(size_t index) -> Vector<T, 3> {
+        const auto value = static_cast<T>(index % 7);
+        return {value + T{1}, T{0.5}, T{2} - value * T{0.25}};
+    }
+
+    [[nodiscard]] static auto make_quaternion(size_t index) -> Quaternion<T> {
+        const auto axis =
+            Vector<T, 3>{T{1}, static_cast<T>(index) - T{5}, T{2}}.normalized();
+        return Quaternion<T>::from_axis_angle(
+            axis, Radians{static_cast<T>(index) * T{0.21}}
+        );
+    }
+
+    /// Composes the model matrix from the separate transformation matrices.
+    [[nodiscard]] static auto reference(
+        const Vector<T, 3>& translation,
+        const Vector<T, 3>& angles,
+        const Vector<T, 3>& scale
+    ) -> Matrix<T, 4, 4> {
+        return Transform::scale_4x4(scale) *
+               Transform::rotate_x<T, 4>(Radians{angles.x()}) *
+               Transform::rotate_y<T, 4>(Radians{angles.y()}) *
+               Transform::rotate_z<T, 4>(Radians{angles.z()}) *
+               Transform::translate_4x4(translation);
+    }
+
+    [[nodiscard]] static auto to_euler(const Vector<T, 3>& angles)
+        -> Transform::EulerAngles<T> {
+        return {Radians{angles.x()}, Radians{angles.y()}, Radians{angles.z()}};
+    }
+};
+
+using TransformTrsStorageTypes = ::testing::Types<float, double>;
+
+TYPED_TEST_SUITE(TransformTrsTests, TransformTrsStorageTypes);
+
+}  // namespace
+
+TYPED_TEST(TransformTrsTests, EulerAngles) {
+    for (size_t i = 0; i < TestFixture::count; ++i) {
+        const auto translation = TestFixture::make_translation(i);
+        const auto angles = TestFixture::make_angles(i);
+        const auto scale = TestFixture::make_scale(i);
+        const auto expected =
+            TestFixture::reference(translation, angles, scale);
+        const auto message = std::format("TRS matrix {} differs", i);
+
+        Luminol::TestUtils::expect_matrix_nearly_equal(
+            Transform::trs(translation, TestFixture::to_euler(angles), scale),
+            expected,
+            TestFixture::epsilon,
+            message
+        );
+        Luminol::TestUtils::expect_matrix_nearly_equal(
+            Transform::trs<Precision::Fast>(
+                translation, TestFixture::to_euler(angles), scale
+            ),
+            expected,
+            TestFixture::epsilon,
+            message
+        );
+    }
+}
+
+TYPED_TEST(TransformTrsTests, Quaternion) {
+    for (size_t i = 0; i < TestFixture::count; ++i) {
+        const auto translation = TestFixture::make_translation(i);
+        const auto rotation = TestFixture::make_quaternion(i);
+        const auto scale = TestFixture::make_scale(i);
+
+        Luminol::TestUtils::expect_matrix_nearly_equal(
+            Transform::trs(translation, rotation, scale),
+            Transform::scale_4x4(scale) * rotation.to_matrix_4x4() *
+                Transform::translate_4x4(translation),
+            TestFixture::epsilon,
+            std::format("TRS matrix {} differs", i)
+        );
+    }
+}
+
+TYPED_TEST(TransformTrsTests, Batches) {
+    auto translations = VectorBatch<TypeParam, 3>{};
+    auto angles = VectorBatch<TypeParam, 3>{};
+    auto quaternions = VectorBatch<TypeParam, 4>{};
+    auto scales = VectorBatch<TypeParam, 3>{};
+
+    for (size_t i = 0; i < TestFixture::count; ++i) {
+        translations.push_back(TestFixture::make_translation(i));
+        angles.push_back(TestFixture::make_angles(i));
+        quaternions.push_back(TestFixture::make_quaternion(i).as_vector());
+        scales.push_back(TestFixture::make_scale(i));
+    }
+
+    const auto zero = Matrix<TypeParam, 4, 4>::zero();
+    auto euler_out = std::vector(TestFixture::count, zero);
+    auto fast_out = std::vector(TestFixture::count, zero);
+    auto quaternion_out = std::vector(TestFixture::count, zero);
+
+    Transform::trs(translations, angles, scales, euler_out);
+    Transform::trs<Precision::Fast>(translations, angles, scales, fast_out);
+    Transform::trs(translations, quaternions, scales, quaternion_out);
+
+    for (size_t i = 0; i < TestFixture::count; ++i) {
+        const auto message = std::format("TRS matrix {} differs", i);
+
+        const auto expected = TestFixture::reference(
+            translations.get(i), angles.get(i), scales.get(i)
+        );
+        Luminol::TestUtils::expect_matrix_nearly_equal(
+            euler_out[i], expected, TestFixture::epsilon, message
+        );
+        Luminol::TestUtils::expect_matrix_nearly_equal(
+            fast_out[i], expected, TestFixture::epsilon, message
+        );
+
+        Luminol::TestUtils::expect_matrix_nearly_equal(
+            quaternion_out[i],
+            Transform::trs(
+                translations.get(i),
+                TestFixture::make_quaternion(i),
+                scales.get(i)
+            ),
+            TestFixture::epsilon,
+            message
+        );
+    }
+}
+
+TYPED_TEST(TransformTrsTests, SizeMismatch) {
+    const auto batch = VectorBatch<TypeParam, 3>{TestFixture::count};
+    auto out = std::vector(
+        TestFixture::count - 1, Matrix<TypeParam, 4, 4>::zero()
+    );
+
+    EXPECT_THROW(
+        Transform::trs(batch, batch, batch, out), std::invalid_argument
+    );
+}
@@ -0,0 +1,61 @@
+#include "VectorTests.hpp"
+
+#include <format>
+
+#include <TestUtils.hpp>
+#include <LuminolMaths/Vector.hpp>
+
+using namespace Luminol::Maths;
+
+TYPED_TEST(VectorTests, Arithmetic) {
+    constexpr auto vector_a = Vector<TypeParam, 4>{1, -2, 3, 4};
+    constexpr auto vector_b = Vector<TypeParam, 4>{5, 6, -7, 8};
+    constexpr auto scalar = TypeParam{2};
+
+    // The runtime results may go through the SIMD kernels, the constant
+    // evaluated results always go through the scalar loops.
+    constexpr auto expected_sum = vector_a + vector_b;
+    constexpr auto expected_difference = vector_a - vector_b;
+    constexpr auto expected_product = vector_a * vector_b;
+    constexpr auto expected_scaled = vector_a * scalar;
+    constexpr auto expected_divided = vector_a / scalar;
+    constexpr auto expected_negated = -vector_a;
+
+    EXPECT_EQ(expected_sum, (Vector<TypeParam, 4>{6, 4, -4, 12}));
+
+    EXPECT_EQ(vector_a + vector_b, expected_sum) << std::format(
+        "Sum of {} and {} is not as expected.",
+        to_string(vector_a),
+        to_string(vector_b)
+    );
+    EXPECT_EQ(vector_a - vector_b, expected_difference) << std::format(
+        "Difference of {} and {} is not as expected.",
+        to_string(vector_a),
+        to_string(vector_b)
+    );
+    EXPECT_EQ(vector_a * vector_b, expected_product) << std::format(
+        "Product of {} and {} is not as expected.",
+        to_string(vector_a),
+        to_string(vector_b)
+    );
+    EXPECT_EQ(vector_a * scalar, expected_scaled) << std::format(
+        "{} scaled by {} is not as expected.", to_string(vector_a), scalar
+    );
+    EXPECT_EQ(vector_a / scalar, expected_divided) << std::format(
+        "{} divided by {} is not as expected.", to_string(vector_a), scalar
+    );
+    EXPECT_EQ(-vector_a, expected_negated) << std::format(
+        "Negation of {} is not as expected.", to_string(vector_a)
+    );
+
+    auto compound = vector_a;
+    compound += vector_b;
+    compound -= vector_a;
+    compound *= vector_a;
+    compound *= scalar;
+    compound /= scalar;
+
+    EXPECT_EQ(compound, expected_product);
+
+    EXPECT_THROW((void)(vector_a / TypeParam{0}), std::runtime_error);
+}
@@ -0,0 +1,40 @@
+#include "VectorTests.hpp"
+
+#include <format>
+#include <stdexcept>
+
+#include <TestUtils.hpp>
+#include <LuminolMaths/Vector.hpp>
+
+using namespace Luminol::Maths;
+
+TYPED_TEST(VectorTests, Data) {
+    auto vector = Vector<TypeParam, 4>{1, 2, 3, 4};
+
+    auto* data = vector.data();
+    for (size_t i = 0; i < 4; ++i) {
+        Luminol::TestUtils::expect_floating_equal(
+            data[i],
+            vector[i],
+            std::format("Component {} of {} differs", i, to_string(vector))
+        );
+        data[i] *= 2;
+    }
+
+    EXPECT_TRUE((vector == Vector<TypeParam, 4>{2, 4, 6, 8})) << std::format(
+        "Vector {} was not written through data", to_string(vector)
+    );
+}
+
+TYPED_TEST(VectorTests, CheckedAccess) {
+    auto vector = Vector<TypeParam, 3>{1, 2, 3};
+    const auto& constant = vector;
+
+    static_assert(noexcept(vector[0]) == !Config::checked_access);
+    static_assert(noexcept(constant[0]) == !Config::checked_access);
+
+    if constexpr (Config::checked_access) {
+        EXPECT_THROW(static_cast<void>(vector[3]), std::out_of_range);
+        EXPECT_THROW(static_cast<void>(constant[3]), std::out_of_range);
+    }
+}
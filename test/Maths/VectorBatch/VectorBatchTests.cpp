@@ -0,0 +1,132 @@
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstdint>
+#include <format>
+#include <vector>
+
+#include <TestUtils.hpp>
+#include <LuminolMaths/VectorBatch.hpp>
+
+using namespace Luminol::Maths;
+
+namespace {
+
+template <std::floating_point T>
+struct VectorBatchTests : public ::testing::Test {
+    /// An odd number of vectors, so the SIMD kernels also run their tails.
+    constexpr static auto count = size_t{19};
+
+    [[nodiscard]] static auto make_vectors(T offset)
+        -> std::vector<Vector<T, 3>> {
+        auto vectors = std::vector<Vector<T, 3>>{};
+        for (size_t i = 0; i < count; ++i) {
+            const auto value = static_cast<T>(i) + offset;
+            vectors.emplace_back(value, -value * T{2}, T{1} - value);
+        }
+        return vectors;
+    }
+};
+
+using VectorBatchStorageTypes = ::testing::Types<float, double>;
+
+TYPED_TEST_SUITE(VectorBatchTests, VectorBatchStorageTypes);
+
+}  // namespace
+
+TYPED_TEST(VectorBatchTests, RoundTrip) {
+    const auto vectors = TestFixture::make_vectors(TypeParam{0.5});
+
+    const auto batch = VectorBatch<TypeParam, 3>{vectors};
+
+    ASSERT_EQ(batch.size(), vectors.size());
+    EXPECT_EQ(batch.to_vectors(), vectors);
+
+    for (size_t i = 0; i < vectors.size(); ++i) {
+        EXPECT_EQ(batch.x()[i], vectors[i].x());
+        EXPECT_EQ(batch.y()[i], vectors[i].y());
+        EXPECT_EQ(batch.z()[i], vectors[i].z());
+        EXPECT_EQ(batch.get(i), vectors[i]);
+    }
+
+    auto appended = VectorBatch<TypeParam, 3>{};
+    for (const auto& vector : vectors) {
+        appended.push_back(vector);
+    }
+
+    EXPECT_EQ(appended.to_vectors(), vectors);
+    EXPECT_THROW((void)appended.get(vectors.size()), std::out_of_range);
+}
+
+TYPED_TEST(VectorBatchTests, MatchesVector) {
+    const auto vectors_a = TestFixture::make_vectors(TypeParam{1});
+    const auto vectors_b = TestFixture::make_vectors(TypeParam{-3});
+
+    const auto batch_a = VectorBatch<TypeParam, 3>{vectors_a};
+    const auto batch_b = VectorBatch<TypeParam, 3>{vectors_b};
+
+    const auto dots = batch_a.dot(batch_b);
+    const auto lengths = batch_a.length();
+    const auto crosses = batch_a.cross(batch_b);
+    const auto normalized = batch_a.normalized();
+    const auto sums = batch_a + batch_b;
+    const auto differences = batch_a - batch_b;
+    const auto scaled = batch_a * TypeParam{3};
+
+    for (size_t i = 0; i < vectors_a.size(); ++i) {
+        const auto& vector_a = vectors_a[i];
+        const auto& vector_b = vectors_b[i];
+
+        const auto message = std::format("Batch element {} differs", i);
+
+        Luminol::TestUtils::expect_floating_equal(
+            dots[i], vector_a.dot(vector_b), message
+        );
+        Luminol::TestUtils::expect_floating_equal(
+            lengths[i], vector_a.length(), message
+        );
+
+        EXPECT_EQ(crosses.get(i), vector_a.cross(vector_b)) << message;
+        EXPECT_EQ(sums.get(i), vector_a + vector_b) << message;
+        EXPECT_EQ(differences.get(i), vector_a - vector_b) << message;
+        EXPECT_EQ(scaled.get(i), vector_a * TypeParam{3}) << message;
+
+        const auto expected_normalized = vector_a.normalized();
+        for (size_t j = 0; j < 3; ++j) {
+            Luminol::TestUtils::expect_floating_equal(
+                normalized.get(i)[j], expected_normalized[j], message
+            );
+        }
+    }
+}
+
+TYPED_TEST(VectorBatchTests, NormalizeZeroVector) {
+    auto batch = VectorBatch<TypeParam, 3>{size_t{3}};
+    batch.set(1, Vector<TypeParam, 3>{0, 3, 4});
+
+    batch.normalize();
+
+    EXPECT_EQ(batch.get(0), (Vector<TypeParam, 3>{0, 0, 0}));
+    EXPECT_EQ(batch.get(1), (Vector<TypeParam, 3>{0, 3, 4}.normalized()));
+    EXPECT_EQ(batch.get(2), (Vector<TypeParam, 3>{0, 0, 0}));
+}
+
+TYPED_TEST(VectorBatchTests, SizeMismatch) {
+    const auto batch_a = VectorBatch<TypeParam, 3>{size_t{3}};
+    const auto batch_b = VectorBatch<TypeParam, 3>{size_t{4}};
+
+    EXPECT_THROW((void)(batch_a + batch_b), std::invalid_argument);
+    EXPECT_THROW((void)batch_a.dot(batch_b), std::invalid_argument);
+    EXPECT_THROW((void)(batch_a / TypeParam{0}), std::runtime_error);
+}
+
+TEST(VectorBatch, LaneAlignment) {
+    const auto batch = VectorBatch4f{size_t{5}};
+
+    for (size_t i = 0; i < 4; ++i) {
+        const auto address = reinterpret_cast<std::uintptr_t>(
+            batch.lane(i).data()
+        );
+        EXPECT_EQ(address % 64, 0U) << std::format("Lane {} misaligned", i);
+    }
+}
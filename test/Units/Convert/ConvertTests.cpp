@@ -0,0 +1,119 @@
+#include <gtest/gtest.h>
+
+#include <format>
+#include <stdexcept>
+#include <vector>
+
+#include <TestUtils.hpp>
+#include <LuminolMaths/Units/Angle.hpp>
+#include <LuminolMaths/Units/Convert.hpp>
+#include <LuminolMaths/Units/Energy.hpp>
+#include <LuminolMaths/Units/Length.hpp>
+#include <LuminolMaths/Units/Mass.hpp>
+#include <LuminolMaths/Units/Time.hpp>
+#include <LuminolMaths/Units/Velocity.hpp>
+
+using namespace Luminol::Units;
+
+namespace {
+
+template <std::floating_point T>
+struct ConvertTests : public ::testing::Test {
+    /// Not a multiple of the SIMD width, so the kernels run their tail.
+    constexpr static auto count = size_t{1003};
+
+    [[nodiscard]] static auto make_values() -> std::vector<T> {
+        auto values = std::vector<T>(count);
+        for (size_t i = 0; i < count; ++i) {
+            values[i] = static_cast<T>(i % 97) * T{0.75} - T{30};
+        }
+        return values;
+    }
+
+    /// Checks the bulk conversion against `Unit::as`, value by value.
+    template <typename FromU, typename ToU>
+    static auto test_conversion() -> void {
+        const auto values = make_values();
+
+        auto out = std::vector<T>(count);
+        convert<FromU, ToU>(values, out);
+
+        auto in_place = values;
+        convert<FromU, ToU>(in_place);
+
+        for (size_t i = 0; i < count; ++i) {
+            const auto expected =
+                Unit<T, FromU>{values[i]}.template as<ToU>().get_value();
+            const auto message = std::format("Value {}", values[i]);
+
+            Luminol::TestUtils::expect_floating_equal(
+                out[i], expected, message
+            );
+            Luminol::TestUtils::expect_floating_equal(
+                in_place[i], expected, message
+            );
+        }
+    }
+};
+
+using ConvertStorageTypes = ::testing::Types<float, double>;
+
+TYPED_TEST_SUITE(ConvertTests, ConvertStorageTypes);
+
+}  // namespace
+
+TYPED_TEST(ConvertTests, ConversionFactor) {
+    EXPECT_EQ((conversion_factor<Kilometer, Meter, TypeParam>), 1000);
+    EXPECT_EQ((conversion_factor<Meter, Meter, TypeParam>), 1);
+    EXPECT_EQ((conversion_factor<Hour, Second, TypeParam>), 3600);
+    EXPECT_EQ(
+        (conversion_factor<KilometerPerHour, MeterPerSecond, TypeParam>),
+        static_cast<TypeParam>(1000.0L / 3600.0L)
+    );
+}
+
+TYPED_TEST(ConvertTests, UnitFamilies) {
+    TestFixture::template test_conversion<Kilometer, Millimeter>();
+    TestFixture::template test_conversion<Nanometer, Meter>();
+    TestFixture::template test_conversion<Hour, Millisecond>();
+    TestFixture::template test_conversion<KilometerPerHour, MeterPerSecond>();
+    TestFixture::template test_conversion<Kilogram, Gram>();
+    TestFixture::template test_conversion<Kilojoule, Millijoule>();
+    TestFixture::template test_conversion<Degree, Radian>();
+    TestFixture::template test_conversion<Radian, Degree>();
+    TestFixture::template test_conversion<Meter, Meter>();
+}
+
+TYPED_TEST(ConvertTests, Units) {
+    const auto values = TestFixture::make_values();
+    const auto lengths = std::vector<Length<TypeParam, Kilometer>>(
+        values.begin(), values.end()
+    );
+
+    auto out = std::vector<Length<TypeParam, Meter>>(
+        lengths.size(), TypeParam{0}
+    );
+    convert<Meter>(lengths, out);
+
+    for (size_t i = 0; i < lengths.size(); ++i) {
+        Luminol::TestUtils::expect_floating_equal(
+            out[i].get_value(),
+            lengths[i].template as<Meter>().get_value(),
+            std::format("Length {}", lengths[i].get_value())
+        );
+    }
+}
+
+TYPED_TEST(ConvertTests, SizeMismatch) {
+    const auto values = TestFixture::make_values();
+    auto out = std::vector<TypeParam>(values.size() - 1);
+
+    EXPECT_THROW(
+        (convert<Kilometer, Meter>(values, out)), std::invalid_argument
+    );
+    EXPECT_THROW(
+        (convert<Kilometer, Meter>(std::span<const TypeParam>{values}, out)),
+        std::invalid_argument
+    );
+    EXPECT_THROW((convert<Meter, Meter>(values, out)), std::invalid_argument);
+}
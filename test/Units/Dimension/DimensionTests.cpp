@@ -0,0 +1,192 @@
+#include <gtest/gtest.h>
+
+#include <concepts>
+#include <numbers>
+#include <ratio>
+#include <vector>
+
+#include <TestUtils.hpp>
+#include <LuminolMaths/Units/Acceleration.hpp>
+#include <LuminolMaths/Units/Angle.hpp>
+#include <LuminolMaths/Units/Convert.hpp>
+#include <LuminolMaths/Units/Density.hpp>
+#include <LuminolMaths/Units/Energy.hpp>
+#include <LuminolMaths/Units/Force.hpp>
+#include <LuminolMaths/Units/Impulse.hpp>
+#include <LuminolMaths/Units/Length.hpp>
+#include <LuminolMaths/Units/Mass.hpp>
+#include <LuminolMaths/Units/Time.hpp>
+#include <LuminolMaths/Units/Velocity.hpp>
+#include <LuminolMaths/Units/Volume.hpp>
+
+using namespace Luminol::Units;
+
+namespace {
+
+template <typename T, typename U>
+concept ConvertibleTo = requires(const T& value) {
+    value.template as<U>();
+};
+
+// Products and quotients with a unit family land in that family, with the
+// scale folded into the ratio.
+static_assert(std::same_as<
+              UnitQuotient<Kilometer, Hour>,
+              UnitType<UnitEnum::Velocity, KilometerPerHour::ratio>>);
+static_assert(std::same_as<UnitQuotient<Meter, Second>, MeterPerSecond>);
+static_assert(std::same_as<
+              UnitProduct<Kilogram, MeterPerSecondSquared>,
+              UnitType<UnitEnum::Force, std::ratio<1>>>);
+static_assert(std::same_as<
+              UnitProduct<Gram, MeterPerSecond>,
+              UnitType<UnitEnum::Impulse, std::milli>>);
+static_assert(UnitQuotient<Kilogram, CubicMeter>::type == UnitEnum::Density);
+
+// Other dimensions get a derived unit instead of a new family.
+static_assert(
+    UnitProduct<Meter, Second>::dimension == Dimension{.length = 1, .time = 1}
+);
+static_assert(UnitQuotient<Meter, Kilometer>::dimension == dimensionless);
+
+// Only quantities of the same dimension convert.
+static_assert(ConvertibleTo<Length<float, Meter>, Kilometer>);
+static_assert(
+    ConvertibleTo<Unit<float, UnitProduct<Newton, Meter>>, Kilojoule>
+);
+static_assert(!ConvertibleTo<Length<float, Meter>, Second>);
+static_assert(!ConvertibleTo<Unit<float, UnitProduct<Meter, Second>>, Meter>);
+
+// Products that would overflow a std::ratio fall back to floating point terms.
+static_assert(!Detail::ExactRatio<
+              RatioProduct<std::ratio<1, 1'000'000'000'000>, std::nano>>);
+
+template <std::floating_point T>
+struct DimensionTests : public ::testing::Test {};
+
+using DimensionStorageTypes = ::testing::Types<float, double>;
+
+TYPED_TEST_SUITE(DimensionTests, DimensionStorageTypes);
+
+}  // namespace
+
+TYPED_TEST(DimensionTests, Products) {
+    const auto mass = Mass<TypeParam, Gram>{TypeParam{2500}};
+    const auto acceleration =
+        Acceleration<TypeParam, MeterPerSecondSquared>{TypeParam{4}};
+
+    // 2.5 kg at 4 m/s^2, kept in millinewtons until converted.
+    const auto force = mass * acceleration;
+    Luminol::TestUtils::expect_floating_equal(
+        force.get_value(), TypeParam{10'000}, "Force in millinewtons"
+    );
+    Luminol::TestUtils::expect_floating_equal(
+        force.template as<Newton>().get_value(), TypeParam{10}, "Force"
+    );
+
+    const auto newtons = Force<TypeParam, Newton>{force};
+    Luminol::TestUtils::expect_floating_equal(
+        newtons.get_value(), TypeParam{10}, "Assigned force"
+    );
+
+    const auto impulse = mass * Velocity<TypeParam, KilometerPerHour>{36};
+    Luminol::TestUtils::expect_floating_equal(
+        impulse.template as<NewtonSecond>().get_value(),
+        TypeParam{25},
+        "Impulse"
+    );
+
+    // The work of the force over a distance is an energy.
+    const auto work = newtons * Length<TypeParam, Centimeter>{TypeParam{50}};
+    Luminol::TestUtils::expect_floating_equal(
+        work.template as<Joule>().get_value(), TypeParam{5}, "Work"
+    );
+}
+
+TYPED_TEST(DimensionTests, Quotients) {
+    const auto length = Length<TypeParam, Kilometer>{TypeParam{90}};
+    const auto time = Time<TypeParam, Hour>{TypeParam{2}};
+
+    const auto velocity = length / time;
+    static_assert(std::same_as<
+                  decltype(velocity),
+                  const Velocity<TypeParam, KilometerPerHour>>);
+    Luminol::TestUtils::expect_floating_equal(
+        velocity.get_value(), TypeParam{45}, "Velocity"
+    );
+    Luminol::TestUtils::expect_floating_equal(
+        velocity.template as<MeterPerSecond>().get_value(),
+        TypeParam{12.5},
+        "Velocity in meters per second"
+    );
+
+    const auto acceleration = velocity / Time<TypeParam, Second>{TypeParam{5}};
+    Luminol::TestUtils::expect_floating_equal(
+        acceleration.template as<MeterPerSecondSquared>().get_value(),
+        TypeParam{2.5},
+        "Acceleration"
+    );
+
+    const auto density = Mass<TypeParam, Kilogram>{TypeParam{3}} /
+                         Volume<TypeParam, CubicMeter>{TypeParam{2}};
+    Luminol::TestUtils::expect_floating_equal(
+        density.template as<KilogramPerCubicMeter>().get_value(),
+        TypeParam{1.5},
+        "Density"
+    );
+
+    const auto ratio = Length<TypeParam, Meter>{TypeParam{250}} / length;
+    Luminol::TestUtils::expect_floating_equal(
+        ratio.template as<DerivedUnitType<dimensionless, std::ratio<1>>>()
+            .get_value(),
+        TypeParam{250} / TypeParam{90'000},
+        "Dimensionless ratio"
+    );
+}
+
+TYPED_TEST(DimensionTests, DerivedUnits) {
+    using DegreePerSecond = UnitQuotient<Degree, Second>;
+    using RadianPerMinute = UnitQuotient<Radian, Minute>;
+
+    // Radians have a floating point ratio, their products keep one.
+    const auto angular_velocity =
+        Angle<TypeParam, Radian>{std::numbers::pi_v<TypeParam>} /
+        Time<TypeParam, Minute>{TypeParam{1}};
+    static_assert(std::same_as<
+                  decltype(angular_velocity),
+                  const Unit<TypeParam, RadianPerMinute>>);
+
+    Luminol::TestUtils::expect_floating_equal(
+        angular_velocity.template as<DegreePerSecond>().get_value(),
+        TypeParam{3},
+        "Angular velocity"
+    );
+
+    auto values = std::vector<TypeParam>{TypeParam{360}, TypeParam{-60}};
+    convert<DegreePerSecond, RadianPerMinute, TypeParam>(values);
+    Luminol::TestUtils::expect_floating_equal(
+        values[0],
+        TypeParam{120} * std::numbers::pi_v<TypeParam>,
+        "Converted angular velocity"
+    );
+    Luminol::TestUtils::expect_floating_equal(
+        values[1],
+        TypeParam{-20} * std::numbers::pi_v<TypeParam>,
+        "Converted angular velocity"
+    );
+}
+
+TYPED_TEST(DimensionTests, Energy) {
+    const auto mass = Mass<TypeParam, Kilogram>{TypeParam{4}};
+    const auto velocity = Velocity<TypeParam, MeterPerSecond>{TypeParam{3}};
+
+    Luminol::TestUtils::expect_floating_equal(
+        Energy<TypeParam, Joule>{mass, velocity}.get_value(),
+        TypeParam{18},
+        "Kinetic energy"
+    );
+    Luminol::TestUtils::expect_floating_equal(
+        Energy<TypeParam, Millijoule>{mass, velocity}.get_value(),
+        TypeParam{18'000},
+        "Kinetic energy in millijoules"
+    );
+}
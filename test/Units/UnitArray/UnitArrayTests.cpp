@@ -0,0 +1,197 @@
+#include <gtest/gtest.h>
+
+#include <concepts>
+#include <format>
+#include <memory_resource>
+#include <stdexcept>
+#include <vector>
+
+#include <TestUtils.hpp>
+#include <LuminolMaths/MemoryResource.hpp>
+#include <LuminolMaths/Units/Length.hpp>
+#include <LuminolMaths/Units/Time.hpp>
+#include <LuminolMaths/Units/UnitArray.hpp>
+#include <LuminolMaths/Units/Velocity.hpp>
+
+using namespace Luminol::Units;
+
+namespace {
+
+template <std::floating_point T>
+struct UnitArrayTests : public ::testing::Test {
+    /// Not a multiple of the SIMD width, so the kernels run their tail.
+    constexpr static auto count = size_t{1003};
+
+    [[nodiscard]] static auto make_values(T offset) -> std::vector<T> {
+        auto values = std::vector<T>(count);
+        for (size_t i = 0; i < count; ++i) {
+            values[i] = static_cast<T>(i % 89) * T{0.5} + offset;
+        }
+        return values;
+    }
+
+    template <typename U, typename Allocator>
+    static auto expect_values(
+        const UnitArray<T, U, Allocator>& array, const std::vector<T>& expected
+    ) -> void {
+        ASSERT_EQ(array.size(), expected.size());
+        for (size_t i = 0; i < expected.size(); ++i) {
+            Luminol::TestUtils::expect_floating_equal(
+                array.values()[i], expected[i], std::format("Value {}", i)
+            );
+        }
+    }
+};
+
+using UnitArrayStorageTypes = ::testing::Types<float, double>;
+
+TYPED_TEST_SUITE(UnitArrayTests, UnitArrayStorageTypes);
+
+}  // namespace
+
+TYPED_TEST(UnitArrayTests, Storage) {
+    const auto values = TestFixture::make_values(TypeParam{1});
+    auto meters = UnitArray<TypeParam, Meter>{std::span{values}};
+
+    EXPECT_EQ(meters.size(), values.size());
+    EXPECT_FALSE(meters.empty());
+    EXPECT_EQ(meters.get(3).get_value(), values[3]);
+
+    // The raw values are the storage itself.
+    meters.values()[3] = TypeParam{42};
+    EXPECT_EQ(meters.get(3).get_value(), TypeParam{42});
+
+    meters.set(4, Length<TypeParam, Kilometer>{TypeParam{2}});
+    EXPECT_EQ(meters.get(4).get_value(), TypeParam{2000});
+
+    meters.push_back(Length<TypeParam, Centimeter>{TypeParam{150}});
+    EXPECT_EQ(meters.size(), values.size() + 1);
+    EXPECT_EQ(meters.get(values.size()).get_value(), TypeParam{1.5});
+
+    EXPECT_THROW((void)meters.get(meters.size()), std::out_of_range);
+    EXPECT_THROW(meters.set(meters.size(), TypeParam{1}), std::out_of_range);
+
+    meters.clear();
+    EXPECT_TRUE(meters.empty());
+}
+
+TYPED_TEST(UnitArrayTests, Arithmetic) {
+    const auto meter_values = TestFixture::make_values(TypeParam{-20});
+    const auto centimeter_values = TestFixture::make_values(TypeParam{3});
+
+    const auto meters = UnitArray<TypeParam, Meter>{std::span{meter_values}};
+    const auto centimeters =
+        UnitArray<TypeParam, Centimeter>{std::span{centimeter_values}};
+
+    auto expected_sum = std::vector<TypeParam>(meter_values.size());
+    auto expected_difference = expected_sum;
+    for (size_t i = 0; i < meter_values.size(); ++i) {
+        const auto centimeter = Length<TypeParam, Centimeter>{
+            centimeter_values[i],
+        };
+        const auto converted = centimeter.template as<Meter>().get_value();
+        expected_sum[i] = meter_values[i] + converted;
+        expected_difference[i] = meter_values[i] - converted;
+    }
+
+    TestFixture::expect_values(meters + centimeters, expected_sum);
+    TestFixture::expect_values(meters - centimeters, expected_difference);
+
+    auto scaled = meters * TypeParam{4};
+    scaled /= TypeParam{2};
+    for (size_t i = 0; i < meter_values.size(); ++i) {
+        EXPECT_EQ(scaled.values()[i], meter_values[i] * TypeParam{2});
+    }
+    EXPECT_THROW(scaled /= TypeParam{0}, std::runtime_error);
+
+    const auto shorter = UnitArray<TypeParam, Meter>(meters.size() - 1);
+    EXPECT_THROW((void)(meters + shorter), std::invalid_argument);
+    EXPECT_THROW((void)(meters * shorter), std::invalid_argument);
+}
+
+TYPED_TEST(UnitArrayTests, ProductsAndQuotients) {
+    const auto length_values = TestFixture::make_values(TypeParam{1});
+    const auto time_values = TestFixture::make_values(TypeParam{2});
+
+    const auto kilometers =
+        UnitArray<TypeParam, Kilometer>{std::span{length_values}};
+    const auto hours = UnitArray<TypeParam, Hour>{std::span{time_values}};
+
+    const auto velocities = kilometers / hours;
+    static_assert(std::same_as<
+                  decltype(velocities),
+                  const UnitArray<TypeParam, KilometerPerHour>>);
+
+    auto expected = std::vector<TypeParam>(length_values.size());
+    for (size_t i = 0; i < length_values.size(); ++i) {
+        expected[i] = length_values[i] / time_values[i];
+    }
+    TestFixture::expect_values(velocities, expected);
+
+    const auto distances = velocities * hours;
+    TestFixture::expect_values(distances, length_values);
+}
+
+TYPED_TEST(UnitArrayTests, Views) {
+    const auto values = TestFixture::make_values(TypeParam{-7});
+    const auto kilometers = UnitArray<TypeParam, Kilometer>{std::span{values}};
+
+    const auto meters = kilometers.template as<Meter>();
+    EXPECT_EQ(meters.size(), values.size());
+    EXPECT_EQ(meters.raw_values().data(), kilometers.values().data());
+    EXPECT_EQ(meters.factor(), TypeParam{1000});
+    EXPECT_EQ(meters.get(5).get_value(), values[5] * TypeParam{1000});
+    EXPECT_THROW((void)meters.get(meters.size()), std::out_of_range);
+
+    // Views compose their factors instead of converting twice.
+    const auto centimeters = meters.template as<Centimeter>();
+    EXPECT_EQ(centimeters.factor(), TypeParam{100'000});
+
+    const auto materialized = centimeters.to_array();
+    auto expected = std::vector<TypeParam>(values.size());
+    for (size_t i = 0; i < values.size(); ++i) {
+        expected[i] = values[i] * TypeParam{100'000};
+    }
+    TestFixture::expect_values(materialized, expected);
+
+    auto short_out = std::vector<TypeParam>(values.size() - 1);
+    EXPECT_THROW(centimeters.copy_to(short_out), std::invalid_argument);
+
+    // Adding a view scales it once, in the unit of the array.
+    auto sum = UnitArray<TypeParam, Meter>(values.size());
+    sum += meters;
+    sum -= kilometers.template as<Millimeter>();
+    sum += kilometers;
+
+    auto expected_meters = std::vector<TypeParam>(values.size());
+    meters.copy_to(expected_meters);
+    TestFixture::expect_values(sum, expected_meters);
+}
+
+TYPED_TEST(UnitArrayTests, Allocators) {
+    using Allocator = std::pmr::polymorphic_allocator<TypeParam>;
+
+    auto arena = Luminol::Maths::ArenaResource{};
+    const auto allocator = Allocator{&arena};
+
+    const auto values = TestFixture::make_values(TypeParam{1});
+    const auto kilometers = UnitArray<TypeParam, Kilometer, Allocator>{
+        std::span{values}, allocator
+    };
+    const auto hours =
+        UnitArray<TypeParam, Hour, Allocator>{std::span{values}, allocator};
+    EXPECT_EQ(kilometers.get_allocator().resource(), &arena);
+
+    // Every result stays on the arena of the left operand instead of moving
+    // to the default resource.
+    EXPECT_EQ((kilometers / hours).get_allocator().resource(), &arena);
+    EXPECT_EQ((kilometers * hours).get_allocator().resource(), &arena);
+    EXPECT_EQ((kilometers + kilometers).get_allocator().resource(), &arena);
+    EXPECT_EQ((kilometers - kilometers).get_allocator().resource(), &arena);
+    EXPECT_EQ((kilometers * TypeParam{2}).get_allocator().resource(), &arena);
+    EXPECT_EQ((kilometers / TypeParam{2}).get_allocator().resource(), &arena);
+
+    const auto meters = kilometers.template as<Meter>().to_array(allocator);
+    EXPECT_EQ(meters.get_allocator().resource(), &arena);
+    EXPECT_EQ(meters.get(3).get_value(), values[3] * TypeParam{1000});
+}
@@ -0,0 +1,133 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <concepts>
+#include <stdexcept>
+#include <string_view>
+
+#include <TestUtils.hpp>
+#include <LuminolMaths/Units/Acceleration.hpp>
+#include <LuminolMaths/Units/Length.hpp>
+#include <LuminolMaths/Units/Time.hpp>
+#include <LuminolMaths/Units/Velocity.hpp>
+#include <LuminolMaths/Units/VectorQuantity.hpp>
+
+using namespace Luminol::Units;
+using Luminol::Maths::Vector;
+
+namespace {
+
+template <typename T, typename V>
+concept Addable = requires(const T& lhs, const V& rhs) {
+    lhs + rhs;
+};
+
+using Position = VectorQuantity<float, Meter, 3>;
+using Velocity3 = VectorQuantity<float, MeterPerSecond, 3>;
+
+static_assert(sizeof(Position) == sizeof(Vector<float, 3>));
+static_assert(Addable<Position, VectorQuantity<float, Kilometer, 3>>);
+static_assert(!Addable<Position, Velocity3>);
+
+template <std::floating_point T>
+struct VectorQuantityTests : public ::testing::Test {
+    template <typename U, size_t N>
+    static auto expect_components(
+        const VectorQuantity<T, U, N>& value,
+        const Vector<T, N>& expected,
+        const std::string_view message
+    ) -> void {
+        for (size_t i = 0; i < N; ++i) {
+            Luminol::TestUtils::expect_floating_equal(
+                value[i].get_value(), expected[i], message
+            );
+        }
+    }
+};
+
+using VectorQuantityStorageTypes = ::testing::Types<float, double>;
+
+TYPED_TEST_SUITE(VectorQuantityTests, VectorQuantityStorageTypes);
+
+}  // namespace
+
+TYPED_TEST(VectorQuantityTests, Conversions) {
+    using Kilometers = VectorQuantity<TypeParam, Kilometer, 3>;
+    using Meters = VectorQuantity<TypeParam, Meter, 3>;
+
+    const auto kilometers = Kilometers{Vector<TypeParam, 3>{1, -2, 0.5}};
+
+    TestFixture::expect_components(
+        kilometers.template as<Meter>(), {1000, -2000, 500}, "Meters"
+    );
+
+    const auto meters = Meters{kilometers};
+    EXPECT_EQ(meters, kilometers);
+    EXPECT_EQ(meters[1], (Length<TypeParam, Meter>{-2000}));
+    if constexpr (Luminol::Maths::Config::checked_access) {
+        EXPECT_THROW((void)meters[3], std::out_of_range);
+    }
+
+    const auto sum = meters + kilometers;
+    TestFixture::expect_components(sum, {2000, -4000, 1000}, "Sum");
+
+    auto difference = kilometers;
+    difference -= Meters{Vector<TypeParam, 3>{500, 0, 500}};
+    TestFixture::expect_components(difference, {0.5, -2, 0}, "Difference");
+
+    TestFixture::expect_components(
+        -(meters * TypeParam{2}) / TypeParam{4}, {-500, 1000, -250}, "Scaled"
+    );
+}
+
+TYPED_TEST(VectorQuantityTests, Products) {
+    using Velocity = VectorQuantity<TypeParam, KilometerPerHour, 3>;
+
+    const auto velocity = Velocity{Vector<TypeParam, 3>{36, 0, -72}};
+    const auto time = Time<TypeParam, Hour>{TypeParam{0.5}};
+
+    // A velocity over a time is a displacement, without a conversion.
+    const auto displacement = velocity * time;
+    static_assert(std::same_as<
+                  decltype(displacement),
+                  const VectorQuantity<TypeParam, Kilometer, 3>>);
+    TestFixture::expect_components(displacement, {18, 0, -36}, "Displacement");
+    EXPECT_EQ(time * velocity, displacement);
+
+    const auto acceleration =
+        velocity.template as<MeterPerSecond>() / Time<TypeParam, Second>{2};
+    TestFixture::expect_components(
+        acceleration.template as<MeterPerSecondSquared>(),
+        {5, 0, -10},
+        "Acceleration"
+    );
+
+    const auto length = displacement.length();
+    Luminol::TestUtils::expect_floating_equal(
+        length.template as<Meter>().get_value(),
+        std::sqrt(TypeParam{18 * 18 + 36 * 36}) * TypeParam{1000},
+        "Length"
+    );
+    Luminol::TestUtils::expect_floating_equal(
+        displacement.direction().length(), TypeParam{1}, "Direction"
+    );
+}
+
+TYPED_TEST(VectorQuantityTests, DotAndCross) {
+    using Meters = VectorQuantity<TypeParam, Meter, 3>;
+    using Centimeters = VectorQuantity<TypeParam, Centimeter, 3>;
+
+    const auto lhs = Meters{Vector<TypeParam, 3>{1, 2, 3}};
+    const auto rhs = Centimeters{Vector<TypeParam, 3>{400, -500, 600}};
+
+    // The dot product of two lengths is an area, in meter centimeters here.
+    const auto area = lhs.dot(rhs);
+    Luminol::TestUtils::expect_floating_equal(
+        area.template as<UnitProduct<Meter, Meter>>().get_value(),
+        TypeParam{12},
+        "Dot product"
+    );
+
+    const auto normal = lhs.cross(rhs).template as<UnitProduct<Meter, Meter>>();
+    TestFixture::expect_components(normal, {27, 6, -13}, "Cross product");
+}